@@ -24,6 +24,84 @@ using namespace std;
 
 namespace gd {
 
+namespace {
+
+bool IsIdentifierCharacter(char character) {
+  return (character >= 'a' && character <= 'z') ||
+         (character >= 'A' && character <= 'Z') ||
+         (character >= '0' && character <= '9') || character == '_' ||
+         character == '$';
+}
+
+/**
+ * Split the code around the usages of the objects list, i.e: occurrences of
+ * its name not being a part of a longer identifier.
+ */
+std::vector<std::string> SplitAroundObjectsList(
+    const std::string& code, const std::string& objectsListName) {
+  std::vector<std::string> segments;
+  if (objectsListName.empty()) {
+    segments.push_back(code);
+    return segments;
+  }
+
+  std::size_t segmentStart = 0;
+  std::size_t searchStart = 0;
+  std::size_t position;
+  while ((position = code.find(objectsListName, searchStart)) !=
+         std::string::npos) {
+    const std::size_t end = position + objectsListName.size();
+    const bool isStartOfIdentifier =
+        position == 0 || (!IsIdentifierCharacter(code[position - 1]) &&
+                          code[position - 1] != '.');
+    const bool isEndOfIdentifier =
+        end == code.size() || !IsIdentifierCharacter(code[end]);
+    if (isStartOfIdentifier && isEndOfIdentifier) {
+      segments.push_back(code.substr(segmentStart, position - segmentStart));
+      segmentStart = end;
+    }
+    searchStart = end;
+  }
+  segments.push_back(code.substr(segmentStart));
+  return segments;
+}
+
+}  // namespace
+
+gd::String EventsCodeGenerator::GenerateObjectsCode(
+    const std::vector<gd::String>& objectsListNames,
+    const std::vector<gd::String>& objectsCodes) {
+  if (objectsCodes.size() > 1) {
+    // Check if the codes are the same, except for the objects list they use.
+    const std::vector<std::string> segments =
+        SplitAroundObjectsList(objectsCodes[0].Raw(), objectsListNames[0].Raw());
+    bool sameCodeForAllObjects = true;
+    for (std::size_t i = 1; i < objectsCodes.size() && sameCodeForAllObjects;
+         ++i) {
+      sameCodeForAllObjects =
+          SplitAroundObjectsList(objectsCodes[i].Raw(),
+                                 objectsListNames[i].Raw()) == segments;
+    }
+
+    if (sameCodeForAllObjects) {
+      gd::String loopCode = GenerateObjectsListsLoop(
+          objectsListNames, [&segments](const gd::String& objectsList) {
+            std::string code = segments[0];
+            for (std::size_t i = 1; i < segments.size(); ++i) {
+              code += objectsList.Raw();
+              code += segments[i];
+            }
+            return gd::String::FromUTF8(code);
+          });
+      if (!loopCode.empty()) return loopCode;
+    }
+  }
+
+  gd::String code;
+  for (auto& objectCode : objectsCodes) code += objectCode;
+  return code;
+}
+
 /**
  * Generate call using a relational operator.
  * Relational operator position is deduced from parameters type.
@@ -363,6 +441,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
     if (!objectName.empty() && instrInfos.parameters.GetParametersCount() > 0) {
       std::vector<gd::String> realObjects =
           GetObjectsContainersList().ExpandObjectName(objectName, context.GetCurrentObject());
+      std::vector<gd::String> objectsListNames;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Set up the context
         gd::String objectType = GetObjectsContainersList().GetTypeOfObject(realObjects[i]);
@@ -376,16 +456,19 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
           // Prepare arguments and generate the condition whole code
           vector<gd::String> arguments = GenerateParametersCodes(
               condition.GetParameters(), instrInfos.parameters, context);
-          conditionCode += GenerateObjectCondition(realObjects[i],
-                                                   objInfo,
-                                                   arguments,
-                                                   instrInfos,
-                                                   returnBoolean,
-                                                   condition.IsInverted(),
-                                                   context);
+          objectsCodes.push_back(GenerateObjectCondition(realObjects[i],
+                                                         objInfo,
+                                                         arguments,
+                                                         instrInfos,
+                                                         returnBoolean,
+                                                         condition.IsInverted(),
+                                                         context));
+          objectsListNames.push_back(
+              GetObjectListName(realObjects[i], context));
 
           context.SetNoCurrentObject();
       }
+      conditionCode += GenerateObjectsCode(objectsListNames, objectsCodes);
     }
   } else if (instrInfos.IsBehaviorInstruction()) {
     if (instrInfos.parameters.GetParametersCount() >= 2) {
@@ -402,6 +485,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
       const BehaviorMetadata &autoInfo =
           MetadataProvider::GetBehaviorMetadata(platform, actualBehaviorType);
 
+      std::vector<gd::String> objectsListNames;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         AddIncludeFiles(autoInfo.includeFiles);
@@ -411,7 +496,7 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
         // Prepare arguments and generate the whole condition code
         vector<gd::String> arguments = GenerateParametersCodes(
             condition.GetParameters(), instrInfos.parameters, context);
-        conditionCode += GenerateBehaviorCondition(
+        objectsCodes.push_back(GenerateBehaviorCondition(
             realObjects[i],
             behaviorName,
             autoInfo,
@@ -419,10 +504,12 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
             instrInfos,
             returnBoolean,
             condition.IsInverted(),
-            context);
+            context));
+        objectsListNames.push_back(GetObjectListName(realObjects[i], context));
 
         context.SetNoCurrentObject();
       }
+      conditionCode += GenerateObjectsCode(objectsListNames, objectsCodes);
     }
   } else {
     std::vector<std::pair<gd::String, gd::String> >
@@ -587,6 +674,8 @@ gd::String EventsCodeGenerator::GenerateActionCode(
     if (instrInfos.parameters.GetParametersCount() > 0) {
       std::vector<gd::String> realObjects =
           GetObjectsContainersList().ExpandObjectName(objectName, context.GetCurrentObject());
+      std::vector<gd::String> objectsListNames;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         gd::String objectType = GetObjectsContainersList().GetTypeOfObject(realObjects[i]);
@@ -600,16 +689,19 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           // Prepare arguments and generate the whole action code
           vector<gd::String> arguments = GenerateParametersCodes(
               action.GetParameters(), instrInfos.parameters, context);
-          actionCode += GenerateObjectAction(realObjects[i],
-                                             objInfo,
-                                             functionCallName,
-                                             arguments,
-                                             instrInfos,
-                                             context,
-                                             optionalAsyncCallbackName);
+          objectsCodes.push_back(GenerateObjectAction(realObjects[i],
+                                                      objInfo,
+                                                      functionCallName,
+                                                      arguments,
+                                                      instrInfos,
+                                                      context,
+                                                      optionalAsyncCallbackName));
+          objectsListNames.push_back(
+              GetObjectListName(realObjects[i], context));
 
           context.SetNoCurrentObject();
       }
+      actionCode += GenerateObjectsCode(objectsListNames, objectsCodes);
     }
   } else if (instrInfos.IsBehaviorInstruction()) {
     if (instrInfos.parameters.GetParametersCount() >= 2) {
@@ -626,6 +718,8 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           MetadataProvider::GetBehaviorMetadata(platform, actualBehaviorType);
 
       AddIncludeFiles(autoInfo.includeFiles);
+      std::vector<gd::String> objectsListNames;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         context.SetCurrentObject(realObjects[i]);
@@ -634,7 +728,7 @@ gd::String EventsCodeGenerator::GenerateActionCode(
         // Prepare arguments and generate the whole action code
         vector<gd::String> arguments = GenerateParametersCodes(
             action.GetParameters(), instrInfos.parameters, context);
-        actionCode +=
+        objectsCodes.push_back(
             GenerateBehaviorAction(realObjects[i],
                                    behaviorName,
                                    autoInfo,
@@ -642,10 +736,12 @@ gd::String EventsCodeGenerator::GenerateActionCode(
                                    arguments,
                                    instrInfos,
                                    context,
-                                   optionalAsyncCallbackName);
+                                   optionalAsyncCallbackName));
+        objectsListNames.push_back(GetObjectListName(realObjects[i], context));
 
         context.SetNoCurrentObject();
       }
+      actionCode += GenerateObjectsCode(objectsListNames, objectsCodes);
     }
   } else {
     vector<gd::String> arguments = GenerateParametersCodes(
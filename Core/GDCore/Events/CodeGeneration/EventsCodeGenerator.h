@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <functional>
 #include <set>
 #include <utility>
 #include <vector>
@@ -435,6 +436,25 @@ class GD_CORE_API EventsCodeGenerator {
   virtual gd::String GetObjectListName(
       const gd::String& name, const gd::EventsCodeGenerationContext& context);
 
+  /**
+   * \brief Generate a loop running the same code for each of the given
+   * objects lists. Used for instructions on the objects of a group.
+   *
+   * \param objectsListNames The full names of the objects lists (see
+   * GetObjectListName).
+   * \param generateCode Generate the code to be run for an objects list,
+   * given the expression to be used to access it.
+   *
+   * Default implementation returns an empty string, meaning that loops are not
+   * supported: the code is then repeated for each objects list.
+   */
+  virtual gd::String GenerateObjectsListsLoop(
+      const std::vector<gd::String>& objectsListNames,
+      const std::function<gd::String(const gd::String& objectsList)>&
+          generateCode) {
+    return "";
+  };
+
   /**
    * \brief Generate the code to notify the profiler of the beginning of a
    * section.
@@ -768,6 +788,22 @@ protected:
       gd::EventsCodeGenerationContext& context,
       const gd::String& optionalAsyncCallbackName = "");
 
+  /**
+   * \brief Generate the code of an instruction for the objects of a group,
+   * given the code generated for each of them.
+   *
+   * When the codes are the same except for the objects list they use, a single
+   * loop over the objects lists is generated (see GenerateObjectsListsLoop)
+   * instead of a copy of the code for each object.
+   *
+   * \param objectsListNames The full name of the objects list used by each
+   * code (see GetObjectListName).
+   * \param objectsCodes The code generated for each object.
+   */
+  gd::String GenerateObjectsCode(
+      const std::vector<gd::String>& objectsListNames,
+      const std::vector<gd::String>& objectsCodes);
+
   gd::String GenerateRelationalOperatorCall(
       const gd::InstructionMetadata& instrInfos,
       const std::vector<gd::String>& arguments,
@@ -28,6 +28,7 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/VariablesContainersList.h"
 #include "GDCore/Project/ObjectsContainersList.h"
+#include "GDCore/Tools/Tracing.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariableOwnerFinder.h"
@@ -56,7 +57,10 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
                                     codeGenerator.GetProjectScopedContainers(),
                                     rootType,
                                     extraInfo);
-  node->Visit(validator);
+  {
+    gd::TraceScope traceScope("CodeGeneration", "ExpressionValidator");
+    node->Visit(validator);
+  }
   if (!validator.GetFatalErrors().empty()) {
     std::cout << "Error: \"" << validator.GetFatalErrors()[0]->GetMessage()
               << "\" in: \"" << expression.GetPlainString() << "\" ("
@@ -22,12 +22,21 @@ Expression::Expression(const char* plainString_)
 Expression::Expression(const Expression& copy)
     : node(nullptr), plainString{copy.plainString} {};
 
+Expression::Expression(Expression&& other) noexcept
+    : node(std::move(other.node)), plainString(std::move(other.plainString)) {};
+
 Expression& Expression::operator=(const Expression& expression) {
   plainString = expression.plainString;
   node = nullptr;
   return *this;
 };
 
+Expression& Expression::operator=(Expression&& other) noexcept {
+  plainString = std::move(other.plainString);
+  node = std::move(other.node);
+  return *this;
+};
+
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
@@ -38,4 +47,22 @@ ExpressionNode* Expression::GetRootNode() const {
   return node.get();
 }
 
+bool Expression::MayContainName(const gd::String& name) const {
+  const std::string& rawName = name.Raw();
+  // A name in a text can be written with escaped characters, so it's not
+  // searched.
+  if (rawName.find_first_of("\"\\") != std::string::npos) return true;
+
+  // Spaces can be written around the namespace separator of a name (like in
+  // "MyExtension::MyFunction"), so only the part after it is searched.
+  std::size_t namespaceSeparatorPosition = rawName.rfind("::");
+  std::size_t searchedPosition = namespaceSeparatorPosition == std::string::npos
+                                     ? 0
+                                     : namespaceSeparatorPosition + 2;
+  if (searchedPosition >= rawName.size()) return true;
+
+  return plainString.Raw().find(rawName.c_str() + searchedPosition) !=
+         std::string::npos;
+}
+
 }  // namespace gd
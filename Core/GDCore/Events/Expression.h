@@ -49,11 +49,23 @@ class GD_CORE_API Expression {
    */
   Expression(const Expression& copy);
 
+  /**
+   * \brief Move construct an expression, keeping its expression node if it
+   * was already parsed.
+   */
+  Expression(Expression&& other) noexcept;
+
   /**
    * \brief Expression affectation overriding.
    */
   Expression& operator=(const Expression& expression);
 
+  /**
+   * \brief Move an expression, keeping its expression node if it was already
+   * parsed.
+   */
+  Expression& operator=(Expression&& other) noexcept;
+
   /**
    * \brief Get the plain string representing the expression
    */
@@ -65,12 +77,21 @@ class GD_CORE_API Expression {
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * \brief Return false if the expression can't contain the given name (of
+   * an object, a variable, a function...), without parsing it.
+   *
+   * This allows refactoring tools to skip the expressions that can't be
+   * changed by a renaming. It can return true even if the name is not used.
+   */
+  bool MayContainName(const gd::String& name) const;
+
   /**
    * \brief Mimics std::string::c_str
    */
   inline const char* c_str() const { return plainString.c_str(); };
 
-  virtual ~Expression();
+  ~Expression();
 
  private:
   gd::String plainString;  ///< The expression string
@@ -142,6 +142,13 @@ class GD_CORE_API Instruction {
     parameters = val;
   }
 
+  /** \brief Replace all the parameters by new ones, without copying them.
+   * \param val A vector containing the new parameters.
+   */
+  inline void SetParameters(std::vector<gd::Expression>&& val) {
+    parameters = std::move(val);
+  }
+
   /**
    * \brief Return a reference to the vector containing sub instructions
    */
@@ -27,10 +27,302 @@ using namespace gd::GrammarTerminals;
 namespace gd {
 
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
+std::u32string ExpressionParser2::NAMESPACE_SEPARATOR_UTF32 = U"::";
+
+namespace {
+
+/**
+ * \brief Find the innermost function call (or parenthesis) of which the
+ * parameters (or content) contain the given range of the expression.
+ */
+class ReparsableNodeFinder : public ExpressionParser2NodeWorker {
+ public:
+  ReparsableNodeFinder(const std::u32string &expression_,
+                       size_t editStartPosition_,
+                       size_t editEndPosition_)
+      : functionCall(nullptr),
+        subExpression(nullptr),
+        expression(expression_),
+        editStartPosition(editStartPosition_),
+        editEndPosition(editEndPosition_){};
+  virtual ~ReparsableNodeFinder(){};
+
+  FunctionCallNode *functionCall;
+  SubExpressionNode *subExpression;
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    // The closing parenthesis is just after the content, if any.
+    size_t endPosition = node.location.GetEndPosition();
+    if (!node.diagnostic && endPosition < expression.size() &&
+        IsClosingParenthesis(expression[endPosition]) &&
+        IsInside(node.location.GetStartPosition(), endPosition)) {
+      functionCall = nullptr;
+      subExpression = &node;
+    }
+    VisitIfContainingEdit(node.expression);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    VisitIfContainingEdit(node.leftHandSide);
+    VisitIfContainingEdit(node.rightHandSide);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    VisitIfContainingEdit(node.factor);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    VisitIfContainingEdit(node.child);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    VisitIfContainingEdit(node.child);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    VisitIfContainingEdit(node.expression);
+    VisitIfContainingEdit(node.child);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    if (node.openingParenthesisLocation.IsValid() &&
+        node.closingParenthesisLocation.IsValid() &&
+        IsInside(node.openingParenthesisLocation.GetEndPosition(),
+                 node.closingParenthesisLocation.GetStartPosition())) {
+      functionCall = &node;
+      subExpression = nullptr;
+    }
+    for (auto &parameter : node.parameters) VisitIfContainingEdit(parameter);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+
+ private:
+  bool IsInside(size_t startPosition, size_t endPosition) {
+    return startPosition <= editStartPosition &&
+           editEndPosition <= endPosition;
+  }
+
+  template <class T>
+  void VisitIfContainingEdit(std::unique_ptr<T> &node) {
+    if (node && node->location.IsValid() &&
+        IsInside(node->location.GetStartPosition(),
+                 node->location.GetEndPosition()))
+      node->Visit(*this);
+  }
+
+  const std::u32string &expression;
+  size_t editStartPosition;
+  size_t editEndPosition;
+};
+
+/**
+ * \brief Move the locations of the nodes (and of their errors) that are
+ * after the given position.
+ */
+class NodeLocationsShifter : public ExpressionParser2NodeWorker {
+ public:
+  NodeLocationsShifter(size_t fromPosition_, std::ptrdiff_t offset_)
+      : fromPosition(fromPosition_), offset(offset_){};
+  virtual ~NodeLocationsShifter(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    Shift(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    Shift(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    Shift(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override { Shift(node); }
+  void OnVisitTextNode(TextNode &node) override { Shift(node); }
+  void OnVisitVariableNode(VariableNode &node) override {
+    Shift(node);
+    Shift(node.nameLocation);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    Shift(node);
+    Shift(node.nameLocation);
+    Shift(node.dotLocation);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    Shift(node);
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    Shift(node);
+    Shift(node.identifierNameLocation);
+    Shift(node.identifierNameDotLocation);
+    Shift(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    Shift(node);
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.objectFunctionOrBehaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    Shift(node);
+    Shift(node.functionNameLocation);
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.behaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.openingParenthesisLocation);
+    Shift(node.closingParenthesisLocation);
+    for (auto &parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override { Shift(node); }
+
+ private:
+  void Shift(ExpressionNode &node) {
+    Shift(node.location);
+    if (node.diagnostic)
+      node.diagnostic->ShiftPositionsFrom(fromPosition, offset);
+  }
+  void Shift(ExpressionParserLocation &location) {
+    location.ShiftPositionsFrom(fromPosition, offset);
+  }
+
+  size_t fromPosition;
+  std::ptrdiff_t offset;
+};
+
+bool IsUTF8ContinuationByte(char byte) { return (byte & 0xC0) == 0x80; }
+
+/**
+ * \brief Return the number of characters in the given range of bytes of an
+ * UTF-8 encoded string.
+ */
+size_t CountUTF8Characters(const std::string &str,
+                           size_t startByte,
+                           size_t endByte) {
+  size_t count = 0;
+  for (size_t i = startByte; i < endByte; ++i)
+    if (!IsUTF8ContinuationByte(str[i])) count++;
+
+  return count;
+}
+
+}  // namespace
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
-      currentPosition(0) {}
+    : currentPosition(0) {}
+
+std::unique_ptr<ExpressionNode> ExpressionParser2::ReparseExpression(
+    const gd::String &previousExpression,
+    std::unique_ptr<ExpressionNode> previousNode,
+    const gd::String &expression_) {
+  if (!previousNode) return ParseExpression(expression_);
+
+  // Find the edited range: the characters before and after it are unchanged.
+  // The bytes are compared, without decoding the expressions.
+  const std::string &previousBytes = previousExpression.Raw();
+  const std::string &bytes = expression_.Raw();
+  size_t commonBytesCount = std::min(previousBytes.size(), bytes.size());
+  size_t editStartByte = 0;
+  while (editStartByte < commonBytesCount &&
+         previousBytes[editStartByte] == bytes[editStartByte])
+    editStartByte++;
+  while (editStartByte > 0 && editStartByte < bytes.size() &&
+         IsUTF8ContinuationByte(bytes[editStartByte]))
+    editStartByte--;
+  size_t unchangedEndBytesCount = 0;
+  while (unchangedEndBytesCount < commonBytesCount - editStartByte &&
+         previousBytes[previousBytes.size() - 1 - unchangedEndBytesCount] ==
+             bytes[bytes.size() - 1 - unchangedEndBytesCount])
+    unchangedEndBytesCount++;
+  while (unchangedEndBytesCount > 0 &&
+         IsUTF8ContinuationByte(bytes[bytes.size() - unchangedEndBytesCount]))
+    unchangedEndBytesCount--;
+
+  size_t editStartPosition = CountUTF8Characters(bytes, 0, editStartByte);
+  size_t unchangedEndLength = CountUTF8Characters(
+      bytes, bytes.size() - unchangedEndBytesCount, bytes.size());
+
+  // Only decode the edited characters if the previous expression is the last
+  // one that was parsed.
+  std::u32string previous;
+  if (previousExpression == parsedExpression) {
+    previous.swap(expression);
+    expression = previous.substr(0, editStartPosition);
+    expression += gd::String::FromUTF8(
+                      bytes.substr(editStartByte,
+                                   bytes.size() - unchangedEndBytesCount -
+                                       editStartByte))
+                      .ToUTF32();
+    expression.append(previous, previous.size() - unchangedEndLength,
+                      std::u32string::npos);
+  } else {
+    previous = previousExpression.ToUTF32();
+    expression = expression_.ToUTF32();
+  }
+  parsedExpression = expression_;
+
+  size_t previousEditEndPosition = previous.size() - unchangedEndLength;
+  std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(expression.size()) -
+                          static_cast<std::ptrdiff_t>(previous.size());
+
+  ReparsableNodeFinder finder(
+      previous, editStartPosition, previousEditEndPosition);
+  if (previousNode->location.IsValid() &&
+      previousNode->location.GetStartPosition() <= editStartPosition &&
+      previousEditEndPosition <= previousNode->location.GetEndPosition())
+    previousNode->Visit(finder);
+
+  // The parsing only depends on the characters that are read: when the new
+  // parameters (or content of the parenthesis) end where the unchanged text
+  // starts again, the rest of the tree is unchanged, apart from the locations.
+  if (finder.functionCall) {
+    FunctionCallNode &functionCall = *finder.functionCall;
+    size_t previousClosingPosition =
+        functionCall.closingParenthesisLocation.GetStartPosition();
+
+    currentPosition = functionCall.openingParenthesisLocation.GetEndPosition();
+    auto parametersNode = Parameters(
+        &functionCall, functionCall.objectName, functionCall.behaviorName);
+    if (parametersNode.closingParenthesisLocation.IsValid() &&
+        parametersNode.closingParenthesisLocation.GetStartPosition() ==
+            previousClosingPosition + offset) {
+      NodeLocationsShifter shifter(previousClosingPosition, offset);
+      previousNode->Visit(shifter);
+
+      functionCall.parameters = std::move(parametersNode.parameters);
+      functionCall.closingParenthesisLocation =
+          parametersNode.closingParenthesisLocation;
+      return previousNode;
+    }
+  } else if (finder.subExpression) {
+    SubExpressionNode &subExpression = *finder.subExpression;
+    size_t previousEndPosition = subExpression.location.GetEndPosition();
+
+    currentPosition = subExpression.location.GetStartPosition();
+    auto newSubExpression = SubExpression();
+    if (GetCurrentPosition() == previousEndPosition + offset &&
+        CheckIfChar(IsClosingParenthesis)) {
+      NodeLocationsShifter shifter(previousEndPosition, offset);
+      previousNode->Visit(shifter);
+
+      subExpression.expression = std::move(newSubExpression->expression);
+      subExpression.location = newSubExpression->location;
+      return previousNode;
+    }
+  }
+
+  currentPosition = 0;
+  return Start();
+}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
   size_t textStartPosition = GetCurrentPosition();
@@ -39,7 +331,7 @@ std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
     auto text = gd::make_unique<TextNode>("");
 	  // It can't happen.
     text->diagnostic =
-        RaiseSyntaxError(_("A text must start with a double quote (\")."));
+        RaiseSyntaxError(GD_T("A text must start with a double quote (\")."));
     text->location =
         ExpressionParserLocation(textStartPosition, GetCurrentPosition());
     return text;
@@ -80,8 +372,8 @@ std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
       ExpressionParserLocation(textStartPosition, GetCurrentPosition());
   if (!textParsingHasEnded) {
     text->diagnostic =
-        RaiseSyntaxError(_("A text must end with a double quote (\"). Add a "
-                           "double quote to terminate the text."));
+        RaiseSyntaxError(GD_T("A text must end with a double quote (\"). Add a "
+                              "double quote to terminate the text."));
   }
 
   return text;
@@ -136,7 +428,7 @@ std::unique_ptr<NumberNode> ExpressionParser2::ReadNumber() {
       ExpressionParserLocation(numberStartPosition, GetCurrentPosition());
   if (!numberHasStarted || !digitFound) {
     number->diagnostic = RaiseSyntaxError(
-        _("A number was expected. You must enter a number here."));
+        GD_T("A number was expected. You must enter a number here."));
   }
 
   return number;
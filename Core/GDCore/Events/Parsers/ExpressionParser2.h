@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -55,12 +56,38 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    parsedExpression = expression_;
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
   }
 
+  /**
+   * Parse an expression that was edited, reusing the tree of nodes of the
+   * expression before it was edited.
+   *
+   * Only the parameters of the innermost function call (or the content of the
+   * innermost parenthesis) containing the edited text are parsed again. The
+   * other nodes are kept, and their locations are moved if needed. If the edit
+   * is not inside a function call or a parenthesis, or changes where it ends,
+   * the whole expression is parsed again.
+   *
+   * The result is the same as parsing the edited expression with
+   * ParseExpression.
+   *
+   * \param previousExpression The expression before it was edited.
+   * \param previousNode The tree of nodes given by the parsing of the
+   * expression before it was edited. It must not have been modified.
+   * \param expression The edited expression.
+   *
+   * \return The node representing the edited expression as a parsed tree.
+   */
+  std::unique_ptr<ExpressionNode> ReparseExpression(
+      const gd::String &previousExpression,
+      std::unique_ptr<ExpressionNode> previousNode,
+      const gd::String &expression_);
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -94,8 +121,8 @@ class GD_CORE_API ExpressionParser2 {
       op->rightHandSide->parent = op.get();
 
       op->rightHandSide->diagnostic = RaiseSyntaxError(
-          _("The expression has extra character at the end that should be "
-            "removed (or completed if your expression is not finished)."));
+          GD_T("The expression has extra character at the end that should be "
+               "removed (or completed if your expression is not finished)."));
 
       op->location = ExpressionParserLocation(expressionStartPosition,
                                               GetCurrentPosition());
@@ -130,8 +157,8 @@ class GD_CORE_API ExpressionParser2 {
     }
 
     leftHandSide->diagnostic = RaiseSyntaxError(
-        "More than one term was found. Verify that your expression is "
-        "properly written.");
+        GD_T("More than one term was found. Verify that your expression is "
+             "properly written."));
 
     auto op = gd::make_unique<OperatorNode>(' ');
     op->leftHandSide = std::move(leftHandSide);
@@ -204,8 +231,9 @@ class GD_CORE_API ExpressionParser2 {
 
       if (!CheckIfChar(IsClosingParenthesis)) {
         factor->diagnostic =
-            RaiseSyntaxError(_("Missing a closing parenthesis. Add a closing "
-                               "parenthesis for each opening parenthesis."));
+            RaiseSyntaxError(GD_T("Missing a closing parenthesis. Add a "
+                                  "closing parenthesis for each opening "
+                                  "parenthesis."));
       }
       SkipIfChar(IsClosingParenthesis);
       return factor;
@@ -301,8 +329,8 @@ class GD_CORE_API ExpressionParser2 {
 
       if (!CheckIfChar(IsClosingSquareBracket)) {
         child->diagnostic =
-            RaiseSyntaxError(_("Missing a closing bracket. Add a closing "
-                               "bracket for each opening bracket."));
+            RaiseSyntaxError(GD_T("Missing a closing bracket. Add a closing "
+                                  "bracket for each opening bracket."));
       }
       SkipIfChar(IsClosingSquareBracket);
 
@@ -323,7 +351,7 @@ class GD_CORE_API ExpressionParser2 {
       auto child =
           gd::make_unique<VariableAccessorNode>(identifierAndLocation.name);
       if (identifierAndLocation.name.empty()) {
-        child->diagnostic = RaiseSyntaxError(_("A name should be entered after the dot."));
+        child->diagnostic = RaiseSyntaxError(GD_T("A name should be entered after the dot."));
       }
 
       SkipAllWhitespaces();
@@ -342,7 +370,7 @@ class GD_CORE_API ExpressionParser2 {
     // Should never happen, unless a node called this function without checking if the current character
     // was a dot or an opening bracket - this means there is an error in the grammar.
     auto unrecognisedNode = gd::make_unique<VariableAccessorOrVariableBracketAccessorNode>();
-    unrecognisedNode->diagnostic = RaiseSyntaxError(_("A dot or bracket was expected here."));
+    unrecognisedNode->diagnostic = RaiseSyntaxError(GD_T("A dot or bracket was expected here."));
     return std::move(unrecognisedNode);
   }
 
@@ -380,7 +408,7 @@ class GD_CORE_API ExpressionParser2 {
         childIdentifierAndLocation.location;
 
     std::unique_ptr<gd::ExpressionParserError> emptyNameError = childIdentifierName.empty() ?
-      RaiseSyntaxError(_("A name should be entered after the dot.")) : nullptr;
+      RaiseSyntaxError(GD_T("A name should be entered after the dot.")) : nullptr;
 
     SkipAllWhitespaces();
 
@@ -490,7 +518,7 @@ class GD_CORE_API ExpressionParser2 {
       auto node = gd::make_unique<ObjectFunctionNameNode>(
           objectName, behaviorName, functionName);
       node->diagnostic = RaiseSyntaxError(
-          _("An opening parenthesis was expected here to call a function."));
+          GD_T("An opening parenthesis was expected here to call a function."));
 
       node->location = ExpressionParserLocation(
           objectNameLocation.GetStartPosition(), GetCurrentPosition());
@@ -541,8 +569,8 @@ class GD_CORE_API ExpressionParser2 {
     ExpressionParserLocation invalidClosingParenthesisLocation;
     return ParametersNode{
         std::move(parameters),
-        RaiseSyntaxError(_("The list of parameters is not terminated. Add a "
-                           "closing parenthesis to end the parameters.")),
+        RaiseSyntaxError(GD_T("The list of parameters is not terminated. Add a "
+                              "closing parenthesis to end the parameters.")),
         invalidClosingParenthesisLocation};
   }
   ///@}
@@ -555,8 +583,8 @@ class GD_CORE_API ExpressionParser2 {
     }
     return gd::make_unique<ExpressionParserError>(
         gd::ExpressionParserError::ErrorType::InvalidOperator,
-        _("You've used an operator that is not supported. Operator should be "
-          "either +, -, / or *."),
+        GD_T("You've used an operator that is not supported. Operator should "
+             "be either +, -, / or *."),
         GetCurrentPosition());
   }
 
@@ -569,9 +597,9 @@ class GD_CORE_API ExpressionParser2 {
 
     return gd::make_unique<ExpressionParserError>(
         gd::ExpressionParserError::ErrorType::InvalidOperator,
-        _("You've used an \"unary\" operator that is not supported. Operator "
-          "should be "
-          "either + or -."),
+        GD_T("You've used an \"unary\" operator that is not supported. "
+             "Operator should be "
+             "either + or -."),
         position);
   }
   ///@}
@@ -622,8 +650,9 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+            expression.compare(currentPosition,
+                               NAMESPACE_SEPARATOR.size(),
+                               NAMESPACE_SEPARATOR_UTF32) == 0);
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -717,24 +746,27 @@ class GD_CORE_API ExpressionParser2 {
    */
   ///@{
   std::unique_ptr<ExpressionParserError> RaiseSyntaxError(
-      const gd::String &message) {
+      const gd::LocalizableString &message) {
     return std::move(gd::make_unique<ExpressionParserError>(
         gd::ExpressionParserError::ErrorType::SyntaxError, message,
         GetCurrentPosition()));
   }
 
   std::unique_ptr<ExpressionParserError> RaiseTypeError(
-      const gd::String &message, size_t beginningPosition) {
+      const gd::LocalizableString &message, size_t beginningPosition) {
     return std::move(gd::make_unique<ExpressionParserError>(
         gd::ExpressionParserError::ErrorType::MismatchedType, message,
         beginningPosition, GetCurrentPosition()));
   }
   ///@}
 
-  gd::String expression;
+  gd::String parsedExpression;  ///< The expression being parsed.
+  std::u32string expression;  ///< The expression being parsed, decoded once
+                              ///< so that characters are read in constant time.
   std::size_t currentPosition;
 
   static gd::String NAMESPACE_SEPARATOR;
+  static std::u32string NAMESPACE_SEPARATOR_UTF32;
 };
 
 }  // namespace gd
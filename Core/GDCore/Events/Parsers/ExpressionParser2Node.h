@@ -10,6 +10,7 @@
 
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/LocalizableString.h"
 
 namespace gd {
 class Expression;
@@ -34,6 +35,16 @@ struct GD_CORE_API ExpressionParserLocation {
   size_t GetEndPosition() const { return endPosition; }
   bool IsValid() const { return isValid; }
 
+  /**
+   * \brief Move the positions that are after the given one (included), for
+   * example when characters were inserted before them.
+   */
+  void ShiftPositionsFrom(size_t position, std::ptrdiff_t offset) {
+    if (!isValid) return;
+    if (startPosition >= position) startPosition += offset;
+    if (endPosition >= position) endPosition += offset;
+  }
+
  private:
   bool isValid;
   size_t startPosition = 0;
@@ -42,6 +53,10 @@ struct GD_CORE_API ExpressionParserLocation {
 
 /**
  * \brief An error that can be attached to a gd::ExpressionNode.
+ *
+ * The message can be given as a gd::LocalizableString, so that it's only
+ * translated if it's read: errors are often created while the expression is
+ * being typed, without being displayed.
  */
 struct GD_CORE_API ExpressionParserError {
   enum ErrorType {
@@ -76,18 +91,50 @@ struct GD_CORE_API ExpressionParserError {
                         size_t endPosition_)
       : type(type_), message(message_),
         location(startPosition_, endPosition_){};
+  ExpressionParserError(gd::ExpressionParserError::ErrorType type_,
+                        const gd::LocalizableString &message_,
+                        const ExpressionParserLocation &location_,
+                        const gd::String &actualValue_ = "",
+                        const gd::String &objectName_ = "")
+      : type(type_), untranslatedMessage(message_), location(location_),
+        actualValue(actualValue_), objectName(objectName_){};
+  ExpressionParserError(gd::ExpressionParserError::ErrorType type_,
+                        const gd::LocalizableString &message_,
+                        size_t position_)
+      : type(type_), untranslatedMessage(message_), location(position_){};
+  ExpressionParserError(gd::ExpressionParserError::ErrorType type_,
+                        const gd::LocalizableString &message_,
+                        size_t startPosition_, size_t endPosition_)
+      : type(type_), untranslatedMessage(message_),
+        location(startPosition_, endPosition_){};
   virtual ~ExpressionParserError(){};
 
   gd::ExpressionParserError::ErrorType GetType() { return type; }
-  const gd::String &GetMessage() { return message; }
+  const gd::String &GetMessage() {
+    if (!untranslatedMessage.IsEmpty()) {
+      message = untranslatedMessage.GetTranslation();
+      untranslatedMessage = gd::LocalizableString();
+    }
+    return message;
+  }
   const gd::String &GetObjectName() { return objectName; }
   const gd::String &GetActualValue() { return actualValue; }
   size_t GetStartPosition() { return location.GetStartPosition(); }
   size_t GetEndPosition() { return location.GetEndPosition(); }
 
+  /**
+   * \brief Move the location of the error if it's after the given position.
+   * \see gd::ExpressionParserLocation::ShiftPositionsFrom
+   */
+  void ShiftPositionsFrom(size_t position, std::ptrdiff_t offset) {
+    location.ShiftPositionsFrom(position, offset);
+  }
+
 private:
   gd::ExpressionParserError::ErrorType type;
   gd::String message;
+  gd::LocalizableString untranslatedMessage;  ///< The message, if it's not
+                                              ///< translated yet.
   ExpressionParserLocation location;
   gd::String objectName;
   gd::String actualValue;
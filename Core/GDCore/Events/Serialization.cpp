@@ -257,19 +257,22 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
   // end of compatibility code
 
   for (std::size_t i = 0; i < elem.GetChildrenCount(); ++i) {
-    gd::Instruction instruction;
+    // The instruction is built in place, so that it's not copied (with all
+    // its parameters and sub instructions) when inserted in the list.
+    std::shared_ptr<gd::Instruction> instruction =
+        std::make_shared<gd::Instruction>();
     const SerializerElement& instrElement = elem.GetChild(i);
 
-    instruction.SetType(
+    instruction->SetType(
         instrElement.GetChild("type", 0, "Type")
             .GetStringAttribute("value")
             .FindAndReplace("Automatism",
                             "Behavior"));  // Compatibility with GD <= 4
-    instruction.SetInverted(
+    instruction->SetInverted(
         instrElement.GetChild("type", 0, "Type")
             .GetBoolAttribute("inverted", false, "Contraire"));
 
-    instruction.SetAwaited(
+    instruction->SetAwaited(
         instrElement.GetChild("type", 0, "Type").GetBoolAttribute("await"));
 
     // Read parameters
@@ -277,6 +280,7 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
 
     // Compatibility with GD <= 3.3
     if (instrElement.HasChild("Parametre")) {
+      parameters.reserve(instrElement.GetChildrenCount("Parametre"));
       for (std::size_t j = 0; j < instrElement.GetChildrenCount("Parametre");
            ++j)
         parameters.push_back(gd::Expression(
@@ -288,28 +292,29 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
       const SerializerElement& parametersElem =
           instrElement.GetChild("parameters");
       parametersElem.ConsiderAsArrayOf("parameter");
+      parameters.reserve(parametersElem.GetChildrenCount());
       for (std::size_t j = 0; j < parametersElem.GetChildrenCount(); ++j)
         parameters.push_back(
             gd::Expression(parametersElem.GetChild(j).GetValue().GetString()));
     }
 
-    instruction.SetParameters(parameters);
+    instruction->SetParameters(std::move(parameters));
 
     // Read sub instructions
     if (instrElement.HasChild("subInstructions"))
       UnserializeInstructionsFrom(project,
-                                  instruction.GetSubInstructions(),
+                                  instruction->GetSubInstructions(),
                                   instrElement.GetChild("subInstructions"));
     // Compatibility with GD <= 4.0.95
     if (instrElement.HasChild("subConditions", "SubConditions"))
       UnserializeInstructionsFrom(
           project,
-          instruction.GetSubInstructions(),
+          instruction->GetSubInstructions(),
           instrElement.GetChild("subConditions", 0, "SubConditions"));
     if (instrElement.HasChild("subActions", "SubActions"))
       UnserializeInstructionsFrom(
           project,
-          instruction.GetSubInstructions(),
+          instruction->GetSubInstructions(),
           instrElement.GetChild("subActions", 0, "SubActions"));
     // end of compatibility code
 
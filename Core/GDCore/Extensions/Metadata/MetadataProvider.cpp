@@ -32,6 +32,15 @@ gd::PlatformExtension MetadataProvider::badExtension;
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
+  // Behaviors are named after their extension: try it first, so that other
+  // extensions don't have to be declared.
+  auto behaviorExtension = platform.GetExtension(
+      PlatformExtension::GetExtensionFromFullObjectType(behaviorType));
+  if (behaviorExtension && behaviorExtension->HasBehavior(behaviorType))
+    return ExtensionAndMetadata<BehaviorMetadata>(
+        *behaviorExtension,
+        behaviorExtension->GetBehaviorMetadata(behaviorType));
+
   for (auto& extension : platform.GetAllPlatformExtensions()) {
     if (extension->HasBehavior(behaviorType))
       return ExtensionAndMetadata<BehaviorMetadata>(
@@ -49,6 +58,21 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
+  // Objects are named after their extension (or are the extension for
+  // built-in objects): try it first, so that other extensions don't have to
+  // be declared.
+  const gd::String extensionName =
+      PlatformExtension::GetExtensionFromFullObjectType(objectType);
+  auto objectExtension =
+      platform.GetExtension(extensionName.empty() ? objectType : extensionName);
+  if (objectExtension) {
+    auto objectsTypes = objectExtension->GetExtensionObjectsTypes();
+    if (find(objectsTypes.begin(), objectsTypes.end(), objectType) !=
+        objectsTypes.end())
+      return ExtensionAndMetadata<ObjectMetadata>(
+          *objectExtension, objectExtension->GetObjectMetadata(objectType));
+  }
+
   for (auto& extension : platform.GetAllPlatformExtensions()) {
     auto objectsTypes = extension->GetExtensionObjectsTypes();
     for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
@@ -20,7 +20,8 @@ namespace gd {
 InstructionOrExpressionGroupMetadata
     Platform::badInstructionOrExpressionGroupMetadata;
 
-Platform::Platform() : enableExtensionLoadingLogs(false) {}
+Platform::Platform()
+    : nextExtensionPosition(0), enableExtensionLoadingLogs(false) {}
 
 Platform::~Platform() {}
 
@@ -36,7 +37,54 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   }
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
-  extensionsLoaded.push_back(extension);
+  InsertExtension(extension, nextExtensionPosition++);
+  return true;
+}
+
+void Platform::AddLazyExtension(
+    const gd::String& name,
+    std::function<std::shared_ptr<PlatformExtension>()> declareExtension) {
+  if (IsExtensionLoaded(name)) RemoveExtension(name);
+
+  LazyExtension lazyExtension;
+  lazyExtension.name = name;
+  lazyExtension.position = nextExtensionPosition++;
+  lazyExtension.declareExtension = std::move(declareExtension);
+  lazyExtensions.push_back(std::move(lazyExtension));
+}
+
+void Platform::DeclareLazyExtensions() const {
+  while (!lazyExtensions.empty()) DeclareLazyExtension(0);
+}
+
+void Platform::DeclareLazyExtension(std::size_t lazyExtensionIndex) const {
+  // Declaring an extension does not change the extensions seen from outside
+  // the platform, so it's done from const member functions.
+  Platform& platform = const_cast<Platform&>(*this);
+  LazyExtension lazyExtension =
+      std::move(platform.lazyExtensions[lazyExtensionIndex]);
+  platform.lazyExtensions.erase(platform.lazyExtensions.begin() +
+                                lazyExtensionIndex);
+
+  std::shared_ptr<PlatformExtension> extension =
+      lazyExtension.declareExtension();
+  if (!extension) return;
+  if (extension->GetName() != lazyExtension.name) {
+    gd::LogWarning("Extension " + extension->GetName() +
+                   " was added to the platform as " + lazyExtension.name);
+  }
+
+  platform.InsertExtension(extension, lazyExtension.position);
+}
+
+void Platform::InsertExtension(std::shared_ptr<PlatformExtension> extension,
+                               std::size_t position) {
+  std::size_t index = 0;
+  while (index < extensionsPositions.size() &&
+         extensionsPositions[index] < position)
+    index++;
+  extensionsLoaded.insert(extensionsLoaded.begin() + index, extension);
+  extensionsPositions.insert(extensionsPositions.begin() + index, position);
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -50,36 +98,42 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
        extension->GetAllInstructionOrExpressionGroupMetadata()) {
     instructionOrExpressionGroupMetadata[it.first] = it.second;
   }
-
-  return true;
 }
 
 void Platform::RemoveExtension(const gd::String& name) {
-  // Unload all creation/destruction functions for objects provided by the
-  // extension
-  for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
+  lazyExtensions.erase(remove_if(lazyExtensions.begin(),
+                                 lazyExtensions.end(),
+                                 [&name](const LazyExtension& lazyExtension) {
+                                   return lazyExtension.name == name;
+                                 }),
+                       lazyExtensions.end());
+
+  for (std::size_t i = 0; i < extensionsLoaded.size();) {
     auto& extension = extensionsLoaded[i];
-    if (extension->GetName() == name) {
-      vector<gd::String> objectsTypes = extension->GetExtensionObjectsTypes();
-      for (std::size_t i = 0; i < objectsTypes.size(); ++i) {
-        creationFunctionTable.erase(objectsTypes[i]);
-      }
+    if (extension->GetName() != name) {
+      ++i;
+      continue;
+    }
+
+    // Unload all creation/destruction functions for objects provided by the
+    // extension
+    vector<gd::String> objectsTypes = extension->GetExtensionObjectsTypes();
+    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
+      creationFunctionTable.erase(objectsTypes[j]);
     }
-  }
 
-  extensionsLoaded.erase(
-      remove_if(extensionsLoaded.begin(),
-                extensionsLoaded.end(),
-                [&name](std::shared_ptr<PlatformExtension> extension) {
-                  return extension->GetName() == name;
-                }),
-      extensionsLoaded.end());
+    extensionsLoaded.erase(extensionsLoaded.begin() + i);
+    extensionsPositions.erase(extensionsPositions.begin() + i);
+  }
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return true;
   }
+  for (const auto& lazyExtension : lazyExtensions) {
+    if (lazyExtension.name == name) return true;
+  }
 
   return false;
 }
@@ -89,12 +143,30 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
+  for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+    if (lazyExtensions[i].name == name) {
+      DeclareLazyExtension(i);
+      for (const auto& extension : extensionsLoaded) {
+        if (extension->GetName() == name) return extension;
+      }
+      break;
+    }
+  }
 
   return std::shared_ptr<gd::PlatformExtension>();
 }
 
 std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
     gd::String type) const {
+  if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
+    // Declare the extension that should provide the object, if it's not
+    // declared yet. Built-in objects are named like their extension.
+    const gd::String extensionName =
+        PlatformExtension::GetExtensionFromFullObjectType(type);
+    GetExtension(extensionName.empty() ? type : extensionName);
+    if (creationFunctionTable.find(type) == creationFunctionTable.end())
+      DeclareLazyExtensions();
+  }
   if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
     gd::LogWarning("Tried to create an object configuration with an unknown type: " + type
               + " for platform " + GetName() + "!");
@@ -114,9 +186,18 @@ std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
-  for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
+  // Events are named after their extension: try it first, so that other
+  // extensions don't have to be declared.
+  auto eventExtension = GetExtension(
+      PlatformExtension::GetExtensionFromFullObjectType(eventType));
+  if (eventExtension) {
     std::shared_ptr<gd::BaseEvent> event =
-        extensionsLoaded[i]->CreateEvent(eventType);
+        eventExtension->CreateEvent(eventType);
+    if (event != std::shared_ptr<gd::BaseEvent>()) return event;
+  }
+
+  for (const auto& extension : GetAllPlatformExtensions()) {
+    std::shared_ptr<gd::BaseEvent> event = extension->CreateEvent(eventType);
     if (event != std::shared_ptr<gd::BaseEvent>()) return event;
   }
 
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -96,8 +97,34 @@ class GD_CORE_API Platform {
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension that is only declared when it's first used.
+   *
+   * The extension is declared when it's asked by its name (see GetExtension),
+   * when an object or an event that it could provide is created, or when all
+   * the extensions are needed (see GetAllPlatformExtensions, used by
+   * gd::MetadataProvider). Extensions keep the order in which they were added.
+   *
+   * \param name The name of the extension. It must be the name of the
+   * declared extension.
+   * \param declareExtension The function declaring the extension.
+   */
+  void AddLazyExtension(
+      const gd::String& name,
+      std::function<std::shared_ptr<PlatformExtension>()> declareExtension);
+
+  /**
+   * \brief Declare the extensions added with AddLazyExtension that are not
+   * declared yet.
+   *
+   * \note This must be called before using the platform from several threads,
+   * as declaring an extension is not thread-safe.
+   */
+  void DeclareLazyExtensions() const;
+
   /**
    * \brief Return true if an extension with the specified name is loaded
+   * (even if it's not declared yet).
    */
   bool IsExtensionLoaded(const gd::String& name) const;
 
@@ -113,6 +140,7 @@ class GD_CORE_API Platform {
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    DeclareLazyExtensions();
     return extensionsLoaded;
   };
 
@@ -130,6 +158,7 @@ class GD_CORE_API Platform {
    */
   const InstructionOrExpressionGroupMetadata& GetInstructionOrExpressionGroupMetadata(
       const gd::String& name) const {
+    DeclareLazyExtensions();
     auto it = instructionOrExpressionGroupMetadata.find(name);
     if (it == instructionOrExpressionGroupMetadata.end())
       return badInstructionOrExpressionGroupMetadata;
@@ -166,8 +195,34 @@ class GD_CORE_API Platform {
   };
 
  private:
+  /**
+   * \brief An extension added with AddLazyExtension, not declared yet.
+   */
+  struct LazyExtension {
+    gd::String name;
+    std::size_t position;  ///< The position of the extension in the order
+                           ///< in which extensions were added.
+    std::function<std::shared_ptr<PlatformExtension>()> declareExtension;
+  };
+
+  /**
+   * \brief Declare an extension added with AddLazyExtension.
+   */
+  void DeclareLazyExtension(std::size_t lazyExtensionIndex) const;
+
+  /**
+   * \brief Insert an extension in the loaded extensions, keeping the order in
+   * which extensions were added.
+   */
+  void InsertExtension(std::shared_ptr<PlatformExtension> extension,
+                       std::size_t position);
+
   std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
+  std::vector<std::size_t> extensionsPositions;  ///< The position of each
+                                                 ///< loaded extension.
+  std::vector<LazyExtension> lazyExtensions;
+  std::size_t nextExtensionPosition;
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   std::map<gd::String, InstructionOrExpressionGroupMetadata>
@@ -18,4 +18,33 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+bool AbstractFileSystem::CopyFiles(
+    const std::vector<std::pair<gd::String, gd::String>>&
+        sourcesAndDestinations,
+    std::vector<gd::String>& failedFiles) {
+  bool success = true;
+  for (const auto& sourceAndDestination : sourcesAndDestinations) {
+    if (!CopyFile(sourceAndDestination.first, sourceAndDestination.second)) {
+      failedFiles.push_back(sourceAndDestination.second);
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+bool AbstractFileSystem::WriteFiles(
+    const std::vector<std::pair<gd::String, gd::String>>& filesAndContents,
+    std::vector<gd::String>& failedFiles) {
+  bool success = true;
+  for (const auto& fileAndContent : filesAndContents) {
+    if (!WriteToFile(fileAndContent.first, fileAndContent.second)) {
+      failedFiles.push_back(fileAndContent.first);
+      success = false;
+    }
+  }
+
+  return success;
+}
+
 }  // namespace gd
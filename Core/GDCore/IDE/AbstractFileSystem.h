@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <utility>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -107,6 +108,36 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool WriteToFile(const gd::String& file,
                            const gd::String& content) = 0;
 
+  /**
+   * \brief Copy several files.
+   *
+   * By default, files are copied one after the other using CopyFile.
+   * Implementations are free to run the copies concurrently.
+   *
+   * \param sourcesAndDestinations The files to copy, as (source, destination)
+   * pairs.
+   * \param failedFiles Filled with the destination of each failed copy.
+   * \return true if all the copies succeeded.
+   */
+  virtual bool CopyFiles(
+      const std::vector<std::pair<gd::String, gd::String>>&
+          sourcesAndDestinations,
+      std::vector<gd::String>& failedFiles);
+
+  /**
+   * \brief Write the content of several strings to files.
+   *
+   * By default, files are written one after the other using WriteToFile.
+   * Implementations are free to run the writes concurrently.
+   *
+   * \param filesAndContents The files to write, as (file, content) pairs.
+   * \param failedFiles Filled with each file that could not be written.
+   * \return true if all the files were written.
+   */
+  virtual bool WriteFiles(
+      const std::vector<std::pair<gd::String, gd::String>>& filesAndContents,
+      std::vector<gd::String>& failedFiles);
+
   /**
    * \brief Read the content of a file.
    * \return The content of the file.
@@ -0,0 +1,515 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsFunctionInliner.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/Events/EventsFunctionSelfCallChecker.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsContainer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ObjectsContainersList.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+const std::size_t EventsFunctionInliner::maxInlinedActionsCount = 4;
+
+namespace {
+
+/**
+ * The number of functions that can be inlined one into the other, to avoid
+ * generating too much code.
+ */
+const std::size_t maxInliningDepth = 4;
+
+/**
+ * \brief The events function called by an action, with how the arguments of
+ * the action are mapped to its parameters.
+ */
+struct CalledEventsFunction {
+  CalledEventsFunction()
+      : eventsFunction(nullptr),
+        eventsFunctionsContainer(nullptr),
+        firstArgumentIndex(0),
+        operatorIndex(0),
+        isOnlyCallingItself(false){};
+
+  const gd::EventsFunction* eventsFunction;
+  const gd::EventsFunctionsContainer* eventsFunctionsContainer;
+  std::size_t firstArgumentIndex;  ///< The argument of the first parameter.
+  std::size_t operatorIndex;  ///< The parameter before which the operator is
+                              ///< inserted (for ActionWithOperator).
+  gd::String ownerParameterName;  ///< The object parameter of a behavior or
+                                  ///< object function, empty otherwise.
+  bool isOnlyCallingItself;
+};
+
+bool FindCalledEventsFunction(const gd::Project& project,
+                              const gd::String& type,
+                              CalledEventsFunction& called) {
+  const std::size_t extensionNameEnd = type.find("::");
+  if (extensionNameEnd == gd::String::npos) return false;
+
+  const gd::String extensionName = type.substr(0, extensionNameEnd);
+  if (!project.HasEventsFunctionsExtensionNamed(extensionName)) return false;
+  const gd::EventsFunctionsExtension& extension =
+      project.GetEventsFunctionsExtension(extensionName);
+
+  const gd::String functionPath = type.substr(extensionNameEnd + 2);
+  const std::size_t entityNameEnd = functionPath.find("::");
+  if (entityNameEnd == gd::String::npos) {
+    if (!extension.HasEventsFunctionNamed(functionPath)) return false;
+
+    called.eventsFunction = &extension.GetEventsFunction(functionPath);
+    called.eventsFunctionsContainer = &extension;
+    // Free functions are declared with the scene as first parameter.
+    called.firstArgumentIndex = 1;
+    called.operatorIndex = 0;
+    called.isOnlyCallingItself =
+        gd::EventsFunctionSelfCallChecker::IsFreeFunctionOnlyCallingItself(
+            project, extension, *called.eventsFunction);
+    return true;
+  }
+
+  const gd::String entityName = functionPath.substr(0, entityNameEnd);
+  const gd::String functionName = functionPath.substr(entityNameEnd + 2);
+  if (extension.GetEventsBasedBehaviors().Has(entityName)) {
+    const gd::EventsBasedBehavior& eventsBasedBehavior =
+        extension.GetEventsBasedBehaviors().Get(entityName);
+    if (!eventsBasedBehavior.GetEventsFunctions().HasEventsFunctionNamed(
+            functionName))
+      return false;
+
+    called.eventsFunction =
+        &eventsBasedBehavior.GetEventsFunctions().GetEventsFunction(
+            functionName);
+    called.eventsFunctionsContainer = &eventsBasedBehavior.GetEventsFunctions();
+    called.firstArgumentIndex = 0;
+    called.operatorIndex = 2;  // After the object and the behavior.
+    called.isOnlyCallingItself =
+        gd::EventsFunctionSelfCallChecker::IsBehaviorFunctionOnlyCallingItself(
+            project, extension, eventsBasedBehavior, *called.eventsFunction);
+  } else if (extension.GetEventsBasedObjects().Has(entityName)) {
+    const gd::EventsBasedObject& eventsBasedObject =
+        extension.GetEventsBasedObjects().Get(entityName);
+    if (!eventsBasedObject.GetEventsFunctions().HasEventsFunctionNamed(
+            functionName))
+      return false;
+
+    called.eventsFunction =
+        &eventsBasedObject.GetEventsFunctions().GetEventsFunction(
+            functionName);
+    called.eventsFunctionsContainer = &eventsBasedObject.GetEventsFunctions();
+    called.firstArgumentIndex = 0;
+    called.operatorIndex = 1;  // After the object.
+    called.isOnlyCallingItself =
+        gd::EventsFunctionSelfCallChecker::IsObjectFunctionOnlyCallingItself(
+            project, extension, eventsBasedObject, *called.eventsFunction);
+  } else {
+    return false;
+  }
+
+  gd::ParameterMetadataContainer parameters;
+  called.eventsFunction->GetParametersForEvents(
+      *called.eventsFunctionsContainer, parameters);
+  if (parameters.GetParametersCount() == 0) return false;
+  called.ownerParameterName = parameters.GetParameter(0).GetName();
+  return true;
+}
+
+/**
+ * \brief Rename the objects and behaviors of the parameters of an events
+ * function and replace its number and string parameters by the arguments of
+ * a call, checking that everything used in the expression can be used from
+ * the events of the call.
+ */
+class ExpressionParametersReplacer : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionParametersReplacer(
+      const gd::Platform& platform_,
+      const std::map<gd::String, gd::String>& objectNames_,
+      const std::map<gd::String, gd::String>& behaviorNames_,
+      const std::map<gd::String, gd::String>& expressionArguments_)
+      : platform(platform_),
+        objectNames(objectNames_),
+        behaviorNames(behaviorNames_),
+        expressionArguments(expressionArguments_),
+        canBeInlined(true),
+        hasDoneReplacement(false){};
+  virtual ~ExpressionParametersReplacer(){};
+
+  bool CanBeInlined() const { return canBeInlined; }
+  bool HasDoneReplacement() const { return hasDoneReplacement; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    CheckDiagnostic(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    CheckDiagnostic(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    CheckDiagnostic(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { CheckDiagnostic(node); }
+  void OnVisitTextNode(TextNode& node) override { CheckDiagnostic(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    // Variables of the function (or of an object) are not accessible with the
+    // same name from the events calling the function.
+    canBeInlined = false;
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    canBeInlined = false;
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    canBeInlined = false;
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    CheckDiagnostic(node);
+    auto it = expressionArguments.find(node.identifierName);
+    if (!node.childIdentifierName.empty() || it == expressionArguments.end()) {
+      // Properties, variables or object variables.
+      canBeInlined = false;
+      return;
+    }
+
+    // The identifier is printed as is, so it can be replaced by the argument.
+    node.identifierName = "(" + it->second + ")";
+    hasDoneReplacement = true;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    canBeInlined = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    CheckDiagnostic(node);
+    if (node.objectName.empty()) {
+      // Functions like GetArgumentAsNumber only work inside functions.
+      const gd::ExpressionMetadata& metadata =
+          MetadataProvider::GetAnyExpressionMetadata(platform,
+                                                     node.functionName);
+      if (MetadataProvider::IsBadExpressionMetadata(metadata) ||
+          !metadata.IsRelevantForLayoutEvents() ||
+          !metadata.IsRelevantForFunctionEvents()) {
+        canBeInlined = false;
+        return;
+      }
+    } else {
+      if (!Rename(node.objectName, objectNames)) return;
+      if (!node.behaviorName.empty() &&
+          !Rename(node.behaviorName, behaviorNames))
+        return;
+    }
+
+    for (auto& parameter : node.parameters) {
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { CheckDiagnostic(node); }
+
+ private:
+  void CheckDiagnostic(ExpressionNode& node) {
+    if (node.diagnostic) canBeInlined = false;
+  }
+
+  bool Rename(gd::String& name,
+              const std::map<gd::String, gd::String>& newNames) {
+    auto it = newNames.find(name);
+    if (it == newNames.end()) {
+      canBeInlined = false;
+      return false;
+    }
+
+    name = it->second;
+    hasDoneReplacement = true;
+    return true;
+  }
+
+  const gd::Platform& platform;
+  const std::map<gd::String, gd::String>& objectNames;
+  const std::map<gd::String, gd::String>& behaviorNames;
+  const std::map<gd::String, gd::String>& expressionArguments;
+  bool canBeInlined;
+  bool hasDoneReplacement;
+};
+
+/**
+ * \brief Check that an expression gives the same result wherever it's
+ * evaluated in an event: it must not depend on the picked instances nor call
+ * functions (which could have side effects).
+ */
+class InlinableArgumentChecker : public ExpressionParser2NodeWorker {
+ public:
+  InlinableArgumentChecker(
+      const gd::ObjectsContainersList& objectsContainersList_)
+      : objectsContainersList(objectsContainersList_), isInlinable(true){};
+  virtual ~InlinableArgumentChecker(){};
+
+  bool IsInlinable() const { return isInlinable; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    CheckDiagnostic(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    CheckDiagnostic(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    CheckDiagnostic(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { CheckDiagnostic(node); }
+  void OnVisitTextNode(TextNode& node) override { CheckDiagnostic(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    CheckDiagnostic(node);
+    CheckIsNotObject(node.name);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    CheckDiagnostic(node);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    CheckDiagnostic(node);
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    CheckDiagnostic(node);
+    CheckIsNotObject(node.identifierName);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {
+    // The default value of an optional parameter.
+    isInlinable = false;
+  }
+
+ private:
+  void CheckDiagnostic(ExpressionNode& node) {
+    if (node.diagnostic) isInlinable = false;
+  }
+  void CheckIsNotObject(const gd::String& name) {
+    if (objectsContainersList.HasObjectOrGroupNamed(name)) isInlinable = false;
+  }
+
+  const gd::ObjectsContainersList& objectsContainersList;
+  bool isInlinable;
+};
+
+}  // namespace
+
+EventsFunctionInliner::~EventsFunctionInliner() {}
+
+void EventsFunctionInliner::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  if (areConditions) return;
+
+  InlineCalls(instructions);
+}
+
+void EventsFunctionInliner::InlineCalls(gd::InstructionsList& actions) {
+  for (std::size_t i = 0; i < actions.size();) {
+    gd::InstructionsList inlinedActions;
+    if (!InlineCall(actions[i], inlinedActions)) {
+      ++i;
+      continue;
+    }
+
+    // The actions of the function can themselves be calls to inline.
+    inlinedFunctionTypes.push_back(actions[i].GetType());
+    InlineCalls(inlinedActions);
+    inlinedFunctionTypes.pop_back();
+
+    actions.Remove(i);
+    actions.InsertInstructions(inlinedActions, 0, inlinedActions.size(), i);
+    i += inlinedActions.size();
+    inlinedCallsCount++;
+  }
+}
+
+bool EventsFunctionInliner::InlineCall(const gd::Instruction& call,
+                                       gd::InstructionsList& inlinedActions) {
+  if (inlinedFunctionTypes.size() >= maxInliningDepth) return false;
+
+  CalledEventsFunction called;
+  if (!FindCalledEventsFunction(project, call.GetType(), called)) return false;
+  const gd::EventsFunction& eventsFunction = *called.eventsFunction;
+
+  const bool isActionWithOperator =
+      eventsFunction.GetFunctionType() ==
+      gd::EventsFunction::ActionWithOperator;
+  if ((eventsFunction.GetFunctionType() != gd::EventsFunction::Action &&
+       !isActionWithOperator) ||
+      eventsFunction.IsAsync() || called.isOnlyCallingItself ||
+      std::find(inlinedFunctionTypes.begin(),
+                inlinedFunctionTypes.end(),
+                call.GetType()) != inlinedFunctionTypes.end())
+    return false;
+
+  // Only a single event with actions can be moved into the events calling
+  // the function.
+  const gd::EventsList& events = eventsFunction.GetEvents();
+  if (events.GetEventsCount() != 1 || events.GetEvent(0).IsDisabled())
+    return false;
+  const gd::StandardEvent* standardEvent =
+      dynamic_cast<const gd::StandardEvent*>(&events.GetEvent(0));
+  if (!standardEvent || !standardEvent->GetConditions().empty() ||
+      standardEvent->HasSubEvents() || standardEvent->HasVariables())
+    return false;
+  const gd::InstructionsList& actions = standardEvent->GetActions();
+  if (actions.empty() || actions.size() > maxInlinedActionsCount)
+    return false;
+
+  // Match the parameters with the arguments of the call.
+  gd::ParameterMetadataContainer parameters;
+  eventsFunction.GetParametersForEvents(*called.eventsFunctionsContainer,
+                                        parameters);
+  if (isActionWithOperator && parameters.GetParametersCount() == 0)
+    return false;  // The getter of the function does not exist.
+
+  std::map<gd::String, gd::String> objectNames;
+  std::map<gd::String, gd::String> behaviorNames;
+  std::map<gd::String, gd::String> expressionArguments;
+  for (std::size_t i = 0; i < parameters.GetParametersCount(); ++i) {
+    const gd::ParameterMetadata& parameter = parameters.GetParameter(i);
+    std::size_t argumentIndex = called.firstArgumentIndex + i;
+    if (isActionWithOperator && i >= called.operatorIndex) {
+      // The function is given the new value, so only the assignment can be
+      // inlined without calling the getter.
+      if (i == called.operatorIndex &&
+          (argumentIndex >= call.GetParametersCount() ||
+           call.GetParameter(argumentIndex).GetPlainString() != "="))
+        return false;
+      argumentIndex++;
+    }
+    if (argumentIndex >= call.GetParametersCount()) return false;
+    const gd::String& argument = call.GetParameter(argumentIndex).GetPlainString();
+
+    const gd::String& type = parameter.GetType();
+    if (gd::ParameterMetadata::IsObject(type)) {
+      if (argument.empty()) return false;
+      objectNames[parameter.GetName()] = argument;
+    } else if (gd::ParameterMetadata::IsBehavior(type)) {
+      if (argument.empty()) return false;
+      behaviorNames[parameter.GetName()] = argument;
+    } else if (gd::ParameterMetadata::IsExpression("number", type) ||
+               gd::ParameterMetadata::IsExpression("string", type)) {
+      if (!IsInlinableArgument(argument)) return false;
+      expressionArguments[parameter.GetName()] = argument;
+    } else {
+      // Booleans are only read with conditions and other parameters could
+      // need to be converted.
+      return false;
+    }
+  }
+
+  for (std::size_t i = 0; i < actions.size(); ++i) {
+    gd::Instruction action = actions[i];
+    const gd::InstructionMetadata& metadata =
+        MetadataProvider::GetActionMetadata(platform, action.GetType());
+    if (MetadataProvider::IsBadInstructionMetadata(metadata) ||
+        metadata.IsAsync() || !metadata.IsRelevantForLayoutEvents() ||
+        !metadata.IsRelevantForFunctionEvents() ||
+        !action.GetSubInstructions().empty())
+      return false;
+
+    bool hasObjectParameter = false;
+    for (std::size_t p = 0; p < metadata.GetParametersCount(); ++p) {
+      const gd::ParameterMetadata& parameterMetadata =
+          metadata.GetParameter(p);
+      if (parameterMetadata.IsCodeOnly()) continue;
+
+      const gd::String& type = parameterMetadata.GetType();
+      const gd::String value = p < action.GetParametersCount()
+                                   ? action.GetParameter(p).GetPlainString()
+                                   : "";
+      if (gd::ParameterMetadata::IsObject(type)) {
+        // Actions of behavior or object functions are done on the instance
+        // owning the behavior, which stays true only if the inlined actions
+        // are done on the same object.
+        if (!hasObjectParameter && !called.ownerParameterName.empty() &&
+            value != called.ownerParameterName)
+          return false;
+        hasObjectParameter = true;
+
+        auto it = objectNames.find(value);
+        if (it == objectNames.end()) return false;
+        action.SetParameter(p, it->second);
+      } else if (gd::ParameterMetadata::IsBehavior(type)) {
+        auto it = behaviorNames.find(value);
+        if (it == behaviorNames.end()) return false;
+        action.SetParameter(p, it->second);
+      } else if (gd::ParameterMetadata::IsExpression("number", type) ||
+                 gd::ParameterMetadata::IsExpression("string", type)) {
+        if (value.empty()) continue;
+
+        auto node = action.GetParameter(p).GetRootNode();
+        ExpressionParametersReplacer replacer(
+            platform, objectNames, behaviorNames, expressionArguments);
+        node->Visit(replacer);
+        if (!replacer.CanBeInlined()) return false;
+        if (replacer.HasDoneReplacement())
+          action.SetParameter(p,
+                              ExpressionParser2NodePrinter::PrintNode(*node));
+      } else if (gd::ParameterMetadata::IsExpression("variable", type)) {
+        // Only variables of objects are accessed the same way from the
+        // events calling the function.
+        if (type != "objectvar" || value.find(U'[') != gd::String::npos)
+          return false;
+      }
+    }
+    if (!hasObjectParameter && !called.ownerParameterName.empty())
+      return false;
+
+    inlinedActions.Insert(action);
+  }
+
+  return true;
+}
+
+bool EventsFunctionInliner::IsInlinableArgument(const gd::String& argument) {
+  gd::Expression expression(argument);
+  auto node = expression.GetRootNode();
+  if (!node) return false;
+
+  InlinableArgumentChecker checker(GetObjectsContainersList());
+  node->Visit(checker);
+  return checker.IsInlinable();
+}
+
+}  // namespace gd
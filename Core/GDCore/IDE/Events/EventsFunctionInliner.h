@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+namespace gd {
+class Instruction;
+class InstructionsList;
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Replace, in actions, the calls to small events functions by the
+ * actions of these functions, so that the code generated for the events does
+ * not have to call them (and to build their context).
+ *
+ * A call is inlined only if:
+ * - the function is a (non asynchronous) action, made of a single standard
+ * event without conditions, sub-events or local variables, and with at most
+ * gd::EventsFunctionInliner::maxInlinedActionsCount actions,
+ * - the function is not calling itself (see
+ * gd::EventsFunctionSelfCallChecker), directly or through other inlined
+ * functions,
+ * - the parameters of the function can be replaced by the arguments of the
+ * call: objects and behaviors are renamed, number and string parameters are
+ * replaced by the arguments, which must not refer to objects nor call
+ * functions (so that evaluating them several times gives the same result).
+ *
+ * For functions of behaviors and objects, all actions must be done on the
+ * object owning the behavior (or the object itself), so that they are still
+ * done for each instance.
+ *
+ * \note This must be launched on a copy of the events, used for code
+ * generation.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsFunctionInliner
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  EventsFunctionInliner(const gd::Platform &platform_,
+                        const gd::Project &project_)
+      : platform(platform_), project(project_), inlinedCallsCount(0){};
+  virtual ~EventsFunctionInliner();
+
+  /**
+   * \brief Return the number of calls replaced by the actions of the
+   * function.
+   */
+  std::size_t GetInlinedCallsCount() const { return inlinedCallsCount; }
+
+  /**
+   * \brief The maximum number of actions of an inlined function.
+   */
+  static const std::size_t maxInlinedActionsCount;
+
+ private:
+  void DoVisitInstructionList(gd::InstructionsList &instructions,
+                              bool areConditions) override;
+
+  /**
+   * \brief Replace the calls in the actions, including in the actions of
+   * the functions being inlined.
+   */
+  void InlineCalls(gd::InstructionsList &actions);
+
+  /**
+   * \brief Fill inlinedActions with the actions of the function called by
+   * the action, with its parameters replaced by the arguments.
+   *
+   * \return true if the call can be inlined.
+   */
+  bool InlineCall(const gd::Instruction &call,
+                  gd::InstructionsList &inlinedActions);
+
+  /**
+   * \brief Check that an argument can replace a number or string parameter
+   * wherever it's used.
+   */
+  bool IsInlinableArgument(const gd::String &argument);
+
+  const gd::Platform &platform;
+  const gd::Project &project;
+  std::vector<gd::String>
+      inlinedFunctionTypes;  ///< The functions being inlined, to never
+                             ///< inline a recursive call.
+  std::size_t inlinedCallsCount;
+};
+
+}  // namespace gd
@@ -200,6 +200,23 @@ class GD_CORE_API ExpressionPropertyReplacer
   gd::String objectNameToUseForVariableAccessor;
 };
 
+/**
+ * \brief Return false if the expression can't contain any of the renamed or
+ * removed properties, so that it's not parsed.
+ */
+static bool MayContainPropertyNames(
+    const gd::Expression& expression,
+    const std::unordered_map<gd::String, gd::String>& oldToNewPropertyNames,
+    const std::unordered_set<gd::String>& removedPropertyNames) {
+  for (const auto& oldAndNewName : oldToNewPropertyNames) {
+    if (expression.MayContainName(oldAndNewName.first)) return true;
+  }
+  for (const auto& removedName : removedPropertyNames) {
+    if (expression.MayContainName(removedName)) return true;
+  }
+  return false;
+}
+
 bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
@@ -222,6 +239,10 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("number", type) &&
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain properties.
+        if (!MayContainPropertyNames(parameterValue,
+                                     oldToNewPropertyNames,
+                                     removedPropertyNames))
+          return;
 
         auto node = parameterValue.GetRootNode();
         if (node) {
@@ -252,6 +273,9 @@ bool EventsPropertyReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("number", type) &&
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain properties.
+  if (!MayContainPropertyNames(
+          expression, oldToNewPropertyNames, removedPropertyNames))
+    return false;
 
   auto node = expression.GetRootNode();
   if (node) {
@@ -30,7 +30,30 @@ namespace gd {
 const gd::String EventsRefactorer::searchIgnoredCharacters = ";:,#()";
 
 /**
- * \brief Go through the nodes and change the given object name to a new one.
+ * \brief Return the new name of an object, or nullptr if it's not renamed.
+ */
+static const gd::String* GetNewObjectName(
+    const std::map<gd::String, gd::String>& oldToNewNames,
+    const gd::String& name) {
+  auto it = oldToNewNames.find(name);
+  return it != oldToNewNames.end() ? &it->second : nullptr;
+}
+
+/**
+ * \brief Return false if the expression can't contain any of the renamed
+ * objects, so that it's not parsed.
+ */
+static bool MayContainObjectNames(
+    const gd::Expression& expression,
+    const std::map<gd::String, gd::String>& oldToNewNames) {
+  for (const auto& oldAndNewName : oldToNewNames) {
+    if (expression.MayContainName(oldAndNewName.first)) return true;
+  }
+  return false;
+}
+
+/**
+ * \brief Go through the nodes and change the given object names to new ones.
  *
  * \see gd::ExpressionParser2
  */
@@ -39,24 +62,21 @@ class GD_CORE_API ExpressionObjectRenamer : public ExpressionParser2NodeWorker {
   ExpressionObjectRenamer(const gd::Platform &platform_,
                           const gd::ProjectScopedContainers& projectScopedContainers_,
                           const gd::String &rootType_,
-                          const gd::String& objectName_,
-                          const gd::String& objectNewName_)
+                          const std::map<gd::String, gd::String>& oldToNewNames_)
       : platform(platform_),
         projectScopedContainers(projectScopedContainers_),
         rootType(rootType_),
         hasDoneRenaming(false),
-        objectName(objectName_),
-        objectNewName(objectNewName_){};
+        oldToNewNames(oldToNewNames_){};
   virtual ~ExpressionObjectRenamer(){};
 
   static bool Rename(const gd::Platform &platform,
                      const gd::ProjectScopedContainers &projectScopedContainers,
                      const gd::String &rootType,
                      gd::ExpressionNode& node,
-                     const gd::String& objectName,
-                     const gd::String& objectNewName) {
+                     const std::map<gd::String, gd::String>& oldToNewNames) {
     if (gd::ExpressionValidator::HasNoErrors(platform, projectScopedContainers, rootType, node)) {
-      ExpressionObjectRenamer renamer(platform, projectScopedContainers, rootType, objectName, objectNewName);
+      ExpressionObjectRenamer renamer(platform, projectScopedContainers, rootType, oldToNewNames);
       node.Visit(renamer);
 
       return renamer.HasDoneRenaming();
@@ -86,11 +106,12 @@ class GD_CORE_API ExpressionObjectRenamer : public ExpressionParser2NodeWorker {
     if (gd::ValueTypeMetadata::IsTypeLegacyPreScopedVariable(type)) {
       // Nothing to do (this can't reference an object)
     } else {
-      if (node.name == objectName) {
+      const gd::String* newName = GetNewObjectName(oldToNewNames, node.name);
+      if (newName) {
         projectScopedContainers.MatchIdentifierWithName<void>(node.name, [&]() {
           // This is an object variable.
           hasDoneRenaming = true;
-          node.name = objectNewName;
+          node.name = *newName;
         }, [&]() {
           // This is a variable.
         }, [&]() {
@@ -115,18 +136,19 @@ class GD_CORE_API ExpressionObjectRenamer : public ExpressionParser2NodeWorker {
   }
   void OnVisitIdentifierNode(IdentifierNode& node) override {
     auto type = gd::ExpressionTypeFinder::GetType(platform, projectScopedContainers, rootType, node);
-    if (gd::ParameterMetadata::IsObject(type) &&
-        node.identifierName == objectName) {
+    const gd::String* newName =
+        GetNewObjectName(oldToNewNames, node.identifierName);
+    if (gd::ParameterMetadata::IsObject(type) && newName) {
       hasDoneRenaming = true;
-      node.identifierName = objectNewName;
+      node.identifierName = *newName;
     } else if (gd::ValueTypeMetadata::IsTypeLegacyPreScopedVariable(type)) {
       // Nothing to do (this can't reference an object)
     } else {
-      if (node.identifierName == objectName) {
+      if (newName) {
         projectScopedContainers.MatchIdentifierWithName<void>(node.identifierName, [&]() {
           // This is an object variable.
           hasDoneRenaming = true;
-          node.identifierName = objectNewName;
+          node.identifierName = *newName;
         }, [&]() {
           // This is a variable.
         }, [&]() {
@@ -140,15 +162,17 @@ class GD_CORE_API ExpressionObjectRenamer : public ExpressionParser2NodeWorker {
     }
   }
   void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
-    if (node.objectName == objectName) {
+    const gd::String* newName = GetNewObjectName(oldToNewNames, node.objectName);
+    if (newName) {
       hasDoneRenaming = true;
-      node.objectName = objectNewName;
+      node.objectName = *newName;
     }
   }
   void OnVisitFunctionCallNode(FunctionCallNode& node) override {
-    if (node.objectName == objectName) {
+    const gd::String* newName = GetNewObjectName(oldToNewNames, node.objectName);
+    if (newName) {
       hasDoneRenaming = true;
-      node.objectName = objectNewName;
+      node.objectName = *newName;
     }
     for (auto& parameter : node.parameters) {
       parameter->Visit(*this);
@@ -158,8 +182,7 @@ class GD_CORE_API ExpressionObjectRenamer : public ExpressionParser2NodeWorker {
 
  private:
   bool hasDoneRenaming;
-  const gd::String& objectName;
-  const gd::String& objectNewName;
+  const std::map<gd::String, gd::String>& oldToNewNames;
 
   const gd::Platform &platform;
   const gd::ProjectScopedContainers &projectScopedContainers;
@@ -298,8 +321,7 @@ class GD_CORE_API ExpressionObjectFinder : public ExpressionParser2NodeWorker {
 bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
                                              const gd::ProjectScopedContainers& projectScopedContainers,
                                              gd::InstructionsList& actions,
-                                             gd::String oldName,
-                                             gd::String newName) {
+                                             const std::map<gd::String, gd::String>& oldToNewNames) {
   bool somethingModified = false;
 
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
@@ -307,27 +329,33 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
         MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Replace object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
-          actions[aId].GetParameter(pNb).GetPlainString() == oldName)
-        actions[aId].SetParameter(pNb, gd::Expression(newName));
+      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType())) {
+        const gd::String* newName = GetNewObjectName(
+            oldToNewNames, actions[aId].GetParameter(pNb).GetPlainString());
+        if (newName) actions[aId].SetParameter(pNb, gd::Expression(*newName));
+      }
       // Replace object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        if (MayContainObjectNames(actions[aId].GetParameter(pNb), oldToNewNames)) {
+          auto node = actions[aId].GetParameter(pNb).GetRootNode();
 
-        if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
-          actions[aId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldToNewNames)) {
+            actions[aId].SetParameter(
+                pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          }
         }
       }
       // Replace object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        if (MayContainObjectNames(actions[aId].GetParameter(pNb), oldToNewNames)) {
+          auto node = actions[aId].GetParameter(pNb).GetRootNode();
 
-        if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
-          actions[aId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldToNewNames)) {
+            actions[aId].SetParameter(
+                pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          }
         }
       }
     }
@@ -337,8 +365,7 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
           RenameObjectInActions(platform,
                                 projectScopedContainers,
                                 actions[aId].GetSubInstructions(),
-                                oldName,
-                                newName) ||
+                                oldToNewNames) ||
           somethingModified;
   }
 
@@ -349,8 +376,7 @@ bool EventsRefactorer::RenameObjectInConditions(
     const gd::Platform& platform,
     const gd::ProjectScopedContainers& projectScopedContainers,
     gd::InstructionsList& conditions,
-    gd::String oldName,
-    gd::String newName) {
+    const std::map<gd::String, gd::String>& oldToNewNames) {
   bool somethingModified = false;
 
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
@@ -359,27 +385,33 @@ bool EventsRefactorer::RenameObjectInConditions(
                                                conditions[cId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Replace object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
-          conditions[cId].GetParameter(pNb).GetPlainString() == oldName)
-        conditions[cId].SetParameter(pNb, gd::Expression(newName));
+      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType())) {
+        const gd::String* newName = GetNewObjectName(
+            oldToNewNames, conditions[cId].GetParameter(pNb).GetPlainString());
+        if (newName) conditions[cId].SetParameter(pNb, gd::Expression(*newName));
+      }
       // Replace object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        if (MayContainObjectNames(conditions[cId].GetParameter(pNb), oldToNewNames)) {
+          auto node = conditions[cId].GetParameter(pNb).GetRootNode();
 
-        if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
-          conditions[cId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldToNewNames)) {
+            conditions[cId].SetParameter(
+                pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          }
         }
       }
       // Replace object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        if (MayContainObjectNames(conditions[cId].GetParameter(pNb), oldToNewNames)) {
+          auto node = conditions[cId].GetParameter(pNb).GetRootNode();
 
-        if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
-          conditions[cId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldToNewNames)) {
+            conditions[cId].SetParameter(
+                pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+          }
         }
       }
     }
@@ -389,8 +421,7 @@ bool EventsRefactorer::RenameObjectInConditions(
           RenameObjectInConditions(platform,
                                    projectScopedContainers,
                                    conditions[cId].GetSubInstructions(),
-                                   oldName,
-                                   newName) ||
+                                   oldToNewNames) ||
           somethingModified;
   }
 
@@ -402,29 +433,34 @@ bool EventsRefactorer::RenameObjectInEventParameters(
     const gd::ProjectScopedContainers& projectScopedContainers,
     gd::Expression& expression,
     gd::ParameterMetadata parameterMetadata,
-    gd::String oldName,
-    gd::String newName) {
+    const std::map<gd::String, gd::String>& oldToNewNames) {
   bool somethingModified = false;
 
-  if (gd::ParameterMetadata::IsObject(parameterMetadata.GetType()) &&
-      expression.GetPlainString() == oldName)
-    expression = gd::Expression(newName);
+  if (gd::ParameterMetadata::IsObject(parameterMetadata.GetType())) {
+    const gd::String* newName =
+        GetNewObjectName(oldToNewNames, expression.GetPlainString());
+    if (newName) expression = gd::Expression(*newName);
+  }
   // Replace object's name in expressions
   else if (ParameterMetadata::IsExpression("number",
                                            parameterMetadata.GetType())) {
-    auto node = expression.GetRootNode();
+    if (MayContainObjectNames(expression, oldToNewNames)) {
+      auto node = expression.GetRootNode();
 
-    if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
-      expression = ExpressionParser2NodePrinter::PrintNode(*node);
+      if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldToNewNames)) {
+        expression = ExpressionParser2NodePrinter::PrintNode(*node);
+      }
     }
   }
   // Replace object's name in text expressions
   else if (ParameterMetadata::IsExpression("string",
                                            parameterMetadata.GetType())) {
-    auto node = expression.GetRootNode();
+    if (MayContainObjectNames(expression, oldToNewNames)) {
+      auto node = expression.GetRootNode();
 
-    if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
-      expression = ExpressionParser2NodePrinter::PrintNode(*node);
+      if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldToNewNames)) {
+        expression = ExpressionParser2NodePrinter::PrintNode(*node);
+      }
     }
   }
 
@@ -436,19 +472,28 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             gd::EventsList& events,
                                             gd::String oldName,
                                             gd::String newName) {
+  RenameObjectsInEvents(
+      platform, projectScopedContainers, events, {{oldName, newName}});
+}
+
+void EventsRefactorer::RenameObjectsInEvents(
+    const gd::Platform& platform,
+    const gd::ProjectScopedContainers& projectScopedContainers,
+    gd::EventsList& events,
+    const std::map<gd::String, gd::String>& oldToNewNames) {
   for (std::size_t i = 0; i < events.size(); ++i) {
     vector<gd::InstructionsList*> conditionsVectors =
         events[i].GetAllConditionsVectors();
     for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
       bool somethingModified = RenameObjectInConditions(
-          platform, projectScopedContainers, *conditionsVectors[j], oldName, newName);
+          platform, projectScopedContainers, *conditionsVectors[j], oldToNewNames);
     }
 
     vector<gd::InstructionsList*> actionsVectors =
         events[i].GetAllActionsVectors();
     for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
       bool somethingModified = RenameObjectInActions(
-          platform, projectScopedContainers, *actionsVectors[j], oldName, newName);
+          platform, projectScopedContainers, *actionsVectors[j], oldToNewNames);
     }
 
     vector<pair<gd::Expression*, gd::ParameterMetadata>>
@@ -461,16 +506,14 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                                              projectScopedContainers,
                                                              *expression,
                                                              parameterMetadata,
-                                                             oldName,
-                                                             newName);
+                                                             oldToNewNames);
     }
 
     if (events[i].CanHaveSubEvents())
-      RenameObjectInEvents(platform,
-                           projectScopedContainers,
-                           events[i].GetSubEvents(),
-                           oldName,
-                           newName);
+      RenameObjectsInEvents(platform,
+                            projectScopedContainers,
+                            events[i].GetSubEvents(),
+                            oldToNewNames);
   }
 }
 
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -86,6 +87,19 @@ class GD_CORE_API EventsRefactorer {
                                    gd::String oldName,
                                    gd::String newName);
 
+  /**
+   * Replace all occurrences of the object names by their new names, browsing
+   * the events only once.
+   *
+   * All the objects are renamed at once: an object can be renamed to the old
+   * name of another one.
+   */
+  static void RenameObjectsInEvents(
+      const gd::Platform& platform,
+      const gd::ProjectScopedContainers& projectScopedContainers,
+      gd::EventsList& events,
+      const std::map<gd::String, gd::String>& oldToNewNames);
+
   /**
    * Search for a gd::String in events
    *
@@ -122,31 +136,29 @@ class GD_CORE_API EventsRefactorer {
 
  private:
   /**
-   * Replace all occurrences of an object name by another name in an action
-   * ( include : objects in parameters and in math/text expressions ).
+   * Replace all occurrences of the object names by their new names in an
+   * action ( include : objects in parameters and in math/text expressions ).
    *
    * \return true if something was modified.
    */
   static bool RenameObjectInActions(const gd::Platform& platform,
                                     const gd::ProjectScopedContainers& projectScopedContainers,
                                     gd::InstructionsList& instructions,
-                                    gd::String oldName,
-                                    gd::String newName);
+                                    const std::map<gd::String, gd::String>& oldToNewNames);
 
   /**
-   * Replace all occurrences of an object name by another name in a condition
-   * ( include : objects in parameters and in math/text expressions ).
+   * Replace all occurrences of the object names by their new names in a
+   * condition ( include : objects in parameters and in math/text expressions ).
    *
    * \return true if something was modified.
    */
   static bool RenameObjectInConditions(const gd::Platform& platform,
                                        const gd::ProjectScopedContainers& projectScopedContainers,
                                        gd::InstructionsList& instructions,
-                                       gd::String oldName,
-                                       gd::String newName);
+                                       const std::map<gd::String, gd::String>& oldToNewNames);
   /**
-   * Replace all occurrences of an object name by another name in an expression
-   * with the specified metadata
+   * Replace all occurrences of the object names by their new names in an
+   * expression with the specified metadata
    * ( include : objects or objects in math/text expressions ).
    *
    * \return true if something was modified.
@@ -156,8 +168,7 @@ class GD_CORE_API EventsRefactorer {
       const gd::ProjectScopedContainers& projectScopedContainers,
       gd::Expression& expression,
       gd::ParameterMetadata parameterMetadata,
-      gd::String oldName,
-      gd::String newName);
+      const std::map<gd::String, gd::String>& oldToNewNames);
 
   /**
    * Remove all conditions of the list using an object
@@ -438,6 +438,31 @@ EventsVariableReplacer::FindForcedVariablesContainerIfAny(
   return nullptr;
 }
 
+/**
+ * \brief Return false if the expression can't contain any of the renamed,
+ * modified or removed variables, so that it's not parsed.
+ *
+ * Children of variables can only be accessed with the name of a root variable,
+ * so they are not searched.
+ */
+static bool MayContainVariableNames(
+    const gd::Expression& expression,
+    const VariablesRenamingChangesetNode& variablesRenamingChangesetRoot,
+    const std::unordered_set<gd::String>& removedVariableNames) {
+  for (const auto& oldAndNewName :
+       variablesRenamingChangesetRoot.oldToNewVariableNames) {
+    if (expression.MayContainName(oldAndNewName.first)) return true;
+  }
+  for (const auto& nameAndChangeset :
+       variablesRenamingChangesetRoot.modifiedVariables) {
+    if (expression.MayContainName(nameAndChangeset.first)) return true;
+  }
+  for (const auto& removedName : removedVariableNames) {
+    if (expression.MayContainName(removedName)) return true;
+  }
+  return false;
+}
+
 bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
@@ -460,6 +485,10 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("number", type) &&
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
+        if (!MayContainVariableNames(parameterValue,
+                                     variablesRenamingChangesetRoot,
+                                     removedVariableNames))
+          return;
 
         auto node = parameterValue.GetRootNode();
         if (node) {
@@ -494,6 +523,9 @@ bool EventsVariableReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("number", type) &&
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain variables.
+  if (!MayContainVariableNames(
+          expression, variablesRenamingChangesetRoot, removedVariableNames))
+    return false;
 
   auto node = expression.GetRootNode();
   if (node) {
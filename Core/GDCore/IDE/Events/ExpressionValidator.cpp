@@ -73,12 +73,14 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
         // Collections type can't be used directly in expressions, a child
         // must be accessed.
         if (type == Variable::Structure) {
-          RaiseTypeError(_("You need to specify the name of the child variable "
-                           "to access. For example: `MyVariable.child`."),
+          RaiseTypeError(GD_T("You need to specify the name of the child "
+                              "variable to access. For example: "
+                              "`MyVariable.child`."),
                          identifier.identifierNameLocation);
         } else if (type == Variable::Array) {
-          RaiseTypeError(_("You need to specify the name of the child variable "
-                           "to access. For example: `MyVariable[0]`."),
+          RaiseTypeError(GD_T("You need to specify the name of the child "
+                              "variable to access. For example: "
+                              "`MyVariable[0]`."),
                          identifier.identifierNameLocation);
 
         } else {
@@ -100,8 +102,9 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
     [&]() {
       // This represents an object.
       if (identifier.childIdentifierName.empty()) {
-        RaiseTypeError(_("An object variable or expression should be entered."),
-                        identifier.identifierNameLocation);
+        RaiseTypeError(
+            GD_T("An object variable or expression should be entered."),
+            identifier.identifierNameLocation);
 
         return true; // We should have found a variable.
       }
@@ -149,7 +152,7 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
       } else {
         // A child variable is accessed, check it can be used in an expression.
         if (!variable.HasChild(identifier.childIdentifierName)) {
-          RaiseTypeError(_("No child variable with this name found."),
+          RaiseTypeError(GD_T("No child variable with this name found."),
                         identifier.childIdentifierNameLocation);
 
           return true; // We should have found a variable.
@@ -163,7 +166,7 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
     }, [&]() {
       // This is a property.
       if (!identifier.childIdentifierName.empty()) {
-        RaiseTypeError(_("Accessing a child variable of a property is not possible - just write the property name."),
+        RaiseTypeError(GD_T("Accessing a child variable of a property is not possible - just write the property name."),
             identifier.childIdentifierNameLocation);
 
         return true; // We found a property, even if the child is not allowed.
@@ -178,8 +181,9 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
         // Nothing - we don't know the precise type (this could be used a string
         // or as a number)
       } else if (property.GetType() == "Behavior") {
-        RaiseTypeError(_("Behaviors can't be used as a value in expressions."),
-                       identifier.identifierNameLocation);
+        RaiseTypeError(
+            GD_T("Behaviors can't be used as a value in expressions."),
+            identifier.identifierNameLocation);
       } else {
         // Assume type is String or equivalent.
         childType = Type::String;
@@ -189,7 +193,7 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
     }, [&]() {
       // This is a parameter.
       if (!identifier.childIdentifierName.empty()) {
-        RaiseTypeError(_("Accessing a child variable of a parameter is not possible - just write the parameter name."),
+        RaiseTypeError(GD_T("Accessing a child variable of a parameter is not possible - just write the parameter name."),
             identifier.childIdentifierNameLocation);
 
         return true; // We found a parameter, even if the child is not allowed.
@@ -204,7 +208,7 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
       } else if (valueTypeMetadata.IsBoolean()) {
         // Nothing - we don't know the precise type (this could be used as a string or as a number).
       } else {
-        RaiseTypeError(_("This parameter is not a string, number or boolean - it can't be used in an expression."),
+        RaiseTypeError(GD_T("This parameter is not a string, number or boolean - it can't be used in an expression."),
             identifier.identifierNameLocation);
 
         return true; // We found a parameter, even though the type is incompatible.
@@ -246,7 +250,7 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
 
   if (!function.objectName.empty() &&
       !objectsContainersList.HasObjectOrGroupNamed(function.objectName)) {
-    RaiseTypeError(_("This object doesn't exist."),
+    RaiseTypeError(GD_T("This object doesn't exist."),
                    function.objectNameLocation,
                    /*isFatal=*/false);
     return returnType;
@@ -256,7 +260,7 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
       !objectsContainersList.HasBehaviorInObjectOrGroup(function.objectName,
                                       function.behaviorName)) {
     RaiseError(gd::ExpressionParserError::ErrorType::MissingBehavior,
-               _("This behavior is not attached to this object."),
+               GD_T("This behavior is not attached to this object."),
                function.behaviorNameLocation,
                /*isFatal=*/false, function.behaviorName, function.objectName);
     return returnType;
@@ -273,7 +277,7 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
   if (gd::MetadataProvider::IsBadExpressionMetadata(metadata)) {
     if (function.functionName.empty()) {
       RaiseError(gd::ExpressionParserError::ErrorType::InvalidFunctionName,
-               _("Enter the name of the function to call."),
+               GD_T("Enter the name of the function to call."),
                function.location);
     } else {
       RaiseError(gd::ExpressionParserError::ErrorType::InvalidFunctionName,
@@ -289,9 +293,9 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
   if (returnType == Type::Number) {
     if (parentType == Type::String) {
       RaiseTypeError(
-          _("You tried to use an expression that returns a number, but a "
-            "string is expected. Use `ToString` if you need to convert a "
-            "number to a string."),
+          GD_T("You tried to use an expression that returns a number, but a "
+               "string is expected. Use `ToString` if you need to convert a "
+               "number to a string."),
           function.location);
       return returnType;
     } else if (parentType != Type::Number &&
@@ -305,9 +309,9 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
   } else if (returnType == Type::String) {
     if (parentType == Type::Number) {
       RaiseTypeError(
-          _("You tried to use an expression that returns a string, but a "
-            "number is expected. Use `ToNumber` if you need to convert a "
-            "string to a number."),
+          GD_T("You tried to use an expression that returns a string, but a "
+               "number is expected. Use `ToNumber` if you need to convert a "
+               "string to a number."),
           function.location);
       return returnType;
     } else if (parentType != Type::String &&
@@ -396,17 +400,17 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
         if (dynamic_cast<IdentifierNode*>(parameter.get()) == nullptr &&
             dynamic_cast<VariableNode*>(parameter.get()) == nullptr) {
           RaiseError(gd::ExpressionParserError::ErrorType::MalformedVariableParameter,
-                     _("A variable name was expected but something else was "
-                       "written. Enter just the name of the variable for this "
-                       "parameter."),
+                     GD_T("A variable name was expected but something else "
+                          "was written. Enter just the name of the variable "
+                          "for this parameter."),
                      parameter->location);
         }
       } else if (gd::ParameterMetadata::IsObject(expectedParameterType)) {
         if (dynamic_cast<IdentifierNode*>(parameter.get()) == nullptr) {
           RaiseError(gd::ExpressionParserError::ErrorType::MalformedObjectParameter,
-                     _("An object name was expected but something else was "
-                       "written. Enter just the name of the object for this "
-                       "parameter."),
+                     GD_T("An object name was expected but something else was "
+                          "written. Enter just the name of the object for this "
+                          "parameter."),
                      parameter->location);
         }
       }
@@ -418,9 +422,9 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
                    ExpressionValidator::stringTypeString,
                    expectedParameterType)) {
         RaiseError(gd::ExpressionParserError::ErrorType::UnknownParameterType,
-                   _("This function is improperly set up. Reach out to the "
-                     "extension developer or a GDevelop maintainer to fix "
-                     "this issue"),
+                   GD_T("This function is improperly set up. Reach out to the "
+                        "extension developer or a GDevelop maintainer to fix "
+                        "this issue"),
                    parameter->location);
       }
     }
@@ -14,6 +14,7 @@
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/Project/VariablesContainersList.h"
+#include "GDCore/Tools/Tracing.h"
 
 namespace gd {
 class Expression;
@@ -56,6 +57,7 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
                       const gd::ProjectScopedContainers & projectScopedContainers,
                       const gd::String &rootType,
                       gd::ExpressionNode& node) {
+    gd::TraceScope traceScope("Events", "ExpressionValidator");
     gd::ExpressionValidator validator(platform, projectScopedContainers, rootType);
     node.Visit(validator);
     return validator.GetAllErrors().empty();
@@ -147,26 +149,26 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
         // This is actually a dead code because the parser takes them as
         // binary operations with an empty left side which makes as much sense.
         RaiseTypeError(
-          _("You've used an \"unary\" operator that is not supported. Operator "
-            "should be "
-            "either + or -."),
+          GD_T("You've used an \"unary\" operator that is not supported. "
+               "Operator should be "
+               "either + or -."),
           node.location);
       }
     } else if (rightType == Type::String) {
       RaiseTypeError(
-          _("You've used an operator that is not supported. Only + can be used "
-            "to concatenate texts, and must be placed between two texts (or "
-            "expressions)."),
+          GD_T("You've used an operator that is not supported. Only + can be "
+               "used to concatenate texts, and must be placed between two "
+               "texts (or expressions)."),
           node.location);
     } else if (rightType == Type::Object) {
       RaiseTypeError(
-          _("Operators (+, -) can't be used with an object name. Remove the "
-            "operator."),
+          GD_T("Operators (+, -) can't be used with an object name. Remove the "
+               "operator."),
           node.location);
     } else if (rightType == Type::Variable || rightType == Type::LegacyVariable) {
       RaiseTypeError(
-          _("Operators (+, -) can't be used in variable names. Remove "
-            "the operator from the variable name."),
+          GD_T("Operators (+, -) can't be used in variable names. Remove "
+               "the operator from the variable name."),
           node.location);
     }
   }
@@ -175,7 +177,7 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
     childType = Type::Number;
     if (parentType == Type::String) {
       RaiseTypeError(
-          _("You entered a number, but a text was expected (in quotes)."),
+          GD_T("You entered a number, but a text was expected (in quotes)."),
           node.location);
     } else if (parentType != Type::Number &&
                parentType != Type::NumberOrString) {
@@ -188,7 +190,7 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
     ReportAnyError(node);
     childType = Type::String;
     if (parentType == Type::Number) {
-      RaiseTypeError(_("You entered a text, but a number was expected."),
+      RaiseTypeError(GD_T("You entered a text, but a number was expected."),
                      node.location);
     } else if (parentType != Type::String &&
                parentType != Type::NumberOrString) {
@@ -234,16 +236,16 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
         }, [&]() {
           // This is a property.
           // Being in this node implies that there is at least a child - which is not supported for properties.
-          RaiseTypeError(_("Accessing a child variable of a property is not possible - just write the property name."),
+          RaiseTypeError(GD_T("Accessing a child variable of a property is not possible - just write the property name."),
               node.location);
         }, [&]() {
           // This is a parameter.
           // Being in this node implies that there is at least a child - which is not supported for parameters.
-          RaiseTypeError(_("Accessing a child variable of a parameter is not possible - just write the parameter name."),
+          RaiseTypeError(GD_T("Accessing a child variable of a parameter is not possible - just write the parameter name."),
               node.location);
         }, [&]() {
           // This is something else.
-          RaiseTypeError(_("No object, variable or property with this name found."),
+          RaiseTypeError(GD_T("No object, variable or property with this name found."),
               node.location);
         });
 
@@ -279,9 +281,9 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
 
     if (forbidsUsageOfBracketsBecauseParentIsObject) {
       RaiseError(gd::ExpressionParserError::ErrorType::BracketsNotAllowedForObjects,
-                 _("You can't use the brackets to access an object variable. "
-                   "Use a dot followed by the variable name, like this: "
-                   "`MyObject.MyVariable`."),
+                 GD_T("You can't use the brackets to access an object "
+                      "variable. Use a dot followed by the variable name, "
+                      "like this: `MyObject.MyVariable`."),
                  node.location);
     }
     forbidsUsageOfBracketsBecauseParentIsObject = false;
@@ -426,8 +428,23 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
                   const ExpressionParserLocation &location, bool isFatal = true,
                   const gd::String &actualValue = "",
                   const gd::String &objectName = "") {
-    auto diagnostic = gd::make_unique<ExpressionParserError>(
-        type, message, location, actualValue, objectName);
+    AddError(gd::make_unique<ExpressionParserError>(
+                 type, message, location, actualValue, objectName),
+             isFatal);
+  }
+
+  void RaiseError(gd::ExpressionParserError::ErrorType type,
+                  const gd::LocalizableString &message,
+                  const ExpressionParserLocation &location, bool isFatal = true,
+                  const gd::String &actualValue = "",
+                  const gd::String &objectName = "") {
+    AddError(gd::make_unique<ExpressionParserError>(
+                 type, message, location, actualValue, objectName),
+             isFatal);
+  }
+
+  void AddError(std::unique_ptr<ExpressionParserError> diagnostic,
+                bool isFatal) {
     allErrors.push_back(diagnostic.get());
     if (isFatal) {
       fatalErrors.push_back(diagnostic.get());
@@ -467,6 +484,13 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
                location, isFatal);
   }
 
+  void RaiseTypeError(const gd::LocalizableString &message,
+                      const ExpressionParserLocation &location,
+                      bool isFatal = true) {
+    RaiseError(gd::ExpressionParserError::ErrorType::MismatchedType, message,
+               location, isFatal);
+  }
+
   void RaiseOperatorError(const gd::String &message,
                           const ExpressionParserLocation &location) {
     RaiseError(gd::ExpressionParserError::ErrorType::InvalidOperator, message,
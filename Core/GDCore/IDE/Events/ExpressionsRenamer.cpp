@@ -155,6 +155,7 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
                             pNb < instruction.GetParametersCount();
        ++pNb) {
     const gd::Expression& expression = instruction.GetParameter(pNb);
+    if (!expression.MayContainName(oldFunctionName)) continue;
 
     auto node = expression.GetRootNode();
     if (node) {
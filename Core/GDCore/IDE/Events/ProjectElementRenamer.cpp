@@ -171,6 +171,8 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                      gd::Expression("\"" + newName + "\""));
           }
         }
+        if (!parameterValue.MayContainName(oldName)) return;
+
         auto node = parameterValue.GetRootNode();
         if (node) {
           ExpressionIdentifierStringFinder finder(
@@ -0,0 +1,476 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(EMSCRIPTEN) && !defined(WINDOWS)
+#include "GDCore/IDE/NativeFileSystem.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#if defined(LINUX)
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+
+#include "GDCore/String.h"
+#include "GDCore/Tools/Log.h"
+
+#undef CopyFile  // Remove a Windows macro
+
+namespace {
+
+std::vector<std::string> SplitPath(const std::string& path) {
+  std::vector<std::string> components;
+  std::size_t start = 0;
+  while (start <= path.size()) {
+    std::size_t end = path.find('/', start);
+    if (end == std::string::npos) end = path.size();
+    if (end > start) components.push_back(path.substr(start, end - start));
+    start = end + 1;
+  }
+
+  return components;
+}
+
+std::string GetCurrentDirectory() {
+  char buffer[4096];
+  if (getcwd(buffer, sizeof(buffer)) == nullptr) return "/";
+  return buffer;
+}
+
+bool IsAbsolutePath(const std::string& path) {
+  return path.empty() || path[0] == '/' || (path.size() > 1 && path[1] == ':');
+}
+
+/**
+ * \brief Resolve a path to an absolute, normalized, path.
+ */
+std::string ResolvePath(const std::string& path) {
+  if (!path.empty() && path[0] == '/')
+    return gd::NativeFileSystem::NormalizePath(path);
+
+  return gd::NativeFileSystem::NormalizePath(GetCurrentDirectory() + "/" +
+                                             path);
+}
+
+std::string GetParentDirectory(const std::string& path) {
+  std::size_t end = path.find_last_not_of('/');
+  if (end == std::string::npos) return path.empty() ? "." : "/";
+
+  std::size_t slash = path.rfind('/', end);
+  if (slash == std::string::npos) return ".";
+
+  std::size_t parentEnd = path.find_last_not_of('/', slash);
+  if (parentEnd == std::string::npos) return "/";
+  return path.substr(0, parentEnd + 1);
+}
+
+bool WriteAll(int fd, const char* data, std::size_t size) {
+  while (size > 0) {
+    ssize_t written = write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+
+  return true;
+}
+
+bool RemoveDirectoryContent(const std::string& directory) {
+  DIR* dir = opendir(directory.c_str());
+  if (!dir) return false;
+
+  bool success = true;
+  while (struct dirent* entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+
+    std::string path = directory + "/" + name;
+    struct stat pathStat;
+    if (lstat(path.c_str(), &pathStat) != 0) {
+      success = false;
+      continue;
+    }
+
+    if (S_ISDIR(pathStat.st_mode)) {
+      if (!RemoveDirectoryContent(path) || rmdir(path.c_str()) != 0)
+        success = false;
+    } else if (unlink(path.c_str()) != 0) {
+      success = false;
+    }
+  }
+  closedir(dir);
+
+  return success;
+}
+
+}  // namespace
+
+namespace gd {
+
+NativeFileSystem::NativeFileSystem(std::size_t ioThreadsCount)
+    : ioThreadPool(ioThreadsCount) {}
+
+NativeFileSystem::~NativeFileSystem() {}
+
+std::string NativeFileSystem::NormalizePath(const std::string& path) {
+  bool isAbsolute = !path.empty() && path[0] == '/';
+
+  std::vector<std::string> components;
+  for (const auto& component : SplitPath(path)) {
+    if (component == ".") continue;
+    if (component == "..") {
+      if (!components.empty() && components.back() != "..")
+        components.pop_back();
+      else if (!isAbsolute)
+        components.push_back(component);
+      continue;
+    }
+    components.push_back(component);
+  }
+
+  std::string normalizedPath = isAbsolute ? "/" : "";
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (i != 0) normalizedPath += "/";
+    normalizedPath += components[i];
+  }
+
+  return normalizedPath.empty() ? "." : normalizedPath;
+}
+
+bool NativeFileSystem::MakeDirectories(const std::string& path) {
+  std::string normalizedPath = NormalizePath(path);
+  {
+    std::lock_guard<std::mutex> lock(knownDirectoriesMutex);
+    if (knownDirectories.find(normalizedPath) != knownDirectories.end())
+      return true;
+  }
+
+  // Create each missing component, like `mkdir -p`.
+  std::string currentPath = normalizedPath[0] == '/' ? "" : ".";
+  std::vector<std::string> createdDirectories;
+  for (const auto& component : SplitPath(normalizedPath)) {
+    currentPath += "/" + component;
+    if (mkdir(currentPath.c_str(), 0755) != 0 && errno != EEXIST) {
+      gd::LogError("Unable to create directory " + gd::String::FromUTF8(path));
+      return false;
+    }
+    createdDirectories.push_back(currentPath);
+  }
+
+  struct stat pathStat;
+  if (stat(normalizedPath.c_str(), &pathStat) != 0 ||
+      !S_ISDIR(pathStat.st_mode)) {
+    gd::LogError("Unable to create directory " + gd::String::FromUTF8(path));
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(knownDirectoriesMutex);
+  knownDirectories.insert(normalizedPath);
+  for (const auto& createdDirectory : createdDirectories)
+    knownDirectories.insert(NormalizePath(createdDirectory));
+  return true;
+}
+
+void NativeFileSystem::MkDir(const gd::String& path) {
+  MakeDirectories(path.Raw());
+}
+
+bool NativeFileSystem::DirExists(const gd::String& path) {
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+}
+
+bool NativeFileSystem::FileExists(const gd::String& path) {
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISREG(pathStat.st_mode);
+}
+
+bool NativeFileSystem::ClearDir(const gd::String& directory) {
+  {
+    // Directories inside the cleared one won't exist anymore.
+    std::lock_guard<std::mutex> lock(knownDirectoriesMutex);
+    knownDirectories.clear();
+  }
+
+  if (!DirExists(directory)) return true;
+  return RemoveDirectoryContent(directory.Raw());
+}
+
+gd::String NativeFileSystem::GetTempDir() {
+  const char* tmpDir = std::getenv("TMPDIR");
+  if (tmpDir && tmpDir[0] != '\0') return gd::String::FromUTF8(tmpDir);
+  return "/tmp";
+}
+
+gd::String NativeFileSystem::FileNameFrom(const gd::String& file) {
+  const std::string& path = file.Raw();
+  std::size_t end = path.find_last_not_of('/');
+  if (end == std::string::npos) return "";
+
+  std::size_t slash = path.rfind('/', end);
+  std::size_t start = slash == std::string::npos ? 0 : slash + 1;
+  return gd::String::FromUTF8(path.substr(start, end - start + 1));
+}
+
+gd::String NativeFileSystem::DirNameFrom(const gd::String& file) {
+  return gd::String::FromUTF8(GetParentDirectory(file.Raw()));
+}
+
+bool NativeFileSystem::MakeAbsolute(gd::String& filename,
+                                    const gd::String& baseDirectory) {
+  if (!filename.empty() && filename.Raw()[0] == '/') {
+    filename = gd::String::FromUTF8(NormalizePath(filename.Raw()));
+    return true;
+  }
+
+  filename = gd::String::FromUTF8(
+      ResolvePath(baseDirectory.Raw() + "/" + filename.Raw()));
+  return true;
+}
+
+bool NativeFileSystem::IsAbsolute(const gd::String& filename) {
+  return IsAbsolutePath(filename.Raw());
+}
+
+bool NativeFileSystem::MakeRelative(gd::String& filename,
+                                    const gd::String& baseDirectory) {
+  std::vector<std::string> fileComponents =
+      SplitPath(ResolvePath(filename.Raw()));
+  std::vector<std::string> baseComponents =
+      SplitPath(ResolvePath(baseDirectory.Raw()));
+
+  std::size_t commonCount = 0;
+  while (commonCount < fileComponents.size() &&
+         commonCount < baseComponents.size() &&
+         fileComponents[commonCount] == baseComponents[commonCount])
+    commonCount++;
+
+  std::string relativePath;
+  for (std::size_t i = commonCount; i < baseComponents.size(); ++i)
+    relativePath += relativePath.empty() ? ".." : "/..";
+  for (std::size_t i = commonCount; i < fileComponents.size(); ++i) {
+    if (!relativePath.empty()) relativePath += "/";
+    relativePath += fileComponents[i];
+  }
+
+  filename = gd::String::FromUTF8(relativePath);
+  return true;
+}
+
+bool NativeFileSystem::CopyFileContent(const std::string& source,
+                                       const std::string& destination) {
+  int sourceFd = open(source.c_str(), O_RDONLY);
+  if (sourceFd < 0) return false;
+
+  struct stat sourceStat;
+  if (fstat(sourceFd, &sourceStat) != 0) {
+    close(sourceFd);
+    return false;
+  }
+
+  int destinationFd = open(destination.c_str(),
+                           O_WRONLY | O_CREAT | O_TRUNC,
+                           sourceStat.st_mode & 0777);
+  if (destinationFd < 0) {
+    close(sourceFd);
+    return false;
+  }
+
+  off_t remaining = sourceStat.st_size;
+  bool success = true;
+#if defined(LINUX)
+  // Let the kernel copy the data, without going through user space.
+  bool useCopyFileRange = true;
+  while (remaining > 0) {
+    ssize_t copied =
+        useCopyFileRange
+            ? copy_file_range(
+                  sourceFd, nullptr, destinationFd, nullptr, remaining, 0)
+            : sendfile(destinationFd, sourceFd, nullptr, remaining);
+    if (copied < 0) {
+      if (errno == EINTR) continue;
+      if (useCopyFileRange && (errno == EXDEV || errno == ENOSYS ||
+                               errno == EINVAL || errno == EOPNOTSUPP)) {
+        // Not supported between these files: fall back to sendfile.
+        useCopyFileRange = false;
+        continue;
+      }
+      break;  // Finish with the read/write fallback.
+    }
+    if (copied == 0) break;  // File shrank while being copied.
+    remaining -= copied;
+  }
+#endif
+
+  if (remaining > 0) {
+    // Portable fallback, starting from where the kernel copy stopped (if any).
+    char buffer[64 * 1024];
+    lseek(sourceFd, sourceStat.st_size - remaining, SEEK_SET);
+    lseek(destinationFd, sourceStat.st_size - remaining, SEEK_SET);
+    while (true) {
+      ssize_t readCount = read(sourceFd, buffer, sizeof(buffer));
+      if (readCount < 0) {
+        if (errno == EINTR) continue;
+        success = false;
+        break;
+      }
+      if (readCount == 0) break;
+      if (!WriteAll(destinationFd, buffer, readCount)) {
+        success = false;
+        break;
+      }
+    }
+  }
+
+  close(sourceFd);
+  if (close(destinationFd) != 0) success = false;
+  return success;
+}
+
+bool NativeFileSystem::CopyFile(const gd::String& file,
+                                const gd::String& destination) {
+  if (file == destination) return true;
+  if (!MakeDirectories(GetParentDirectory(destination.Raw()))) return false;
+
+  if (!CopyFileContent(file.Raw(), destination.Raw())) {
+    gd::LogError("Unable to copy " + file + " to " + destination);
+    return false;
+  }
+
+  return true;
+}
+
+bool NativeFileSystem::WriteFileContent(const std::string& file,
+                                        const std::string& content) {
+  int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return false;
+
+  bool success = WriteAll(fd, content.data(), content.size());
+  if (close(fd) != 0) success = false;
+  return success;
+}
+
+bool NativeFileSystem::WriteToFile(const gd::String& file,
+                                   const gd::String& content) {
+  if (!MakeDirectories(GetParentDirectory(file.Raw()))) return false;
+
+  if (!WriteFileContent(file.Raw(), content.Raw())) {
+    gd::LogError("Unable to write " + file);
+    return false;
+  }
+
+  return true;
+}
+
+bool NativeFileSystem::RunInParallel(
+    const std::vector<std::pair<gd::String, gd::String>>& operations,
+    bool isCopy,
+    std::vector<gd::String>& failedFiles) {
+  // Create the directories first, so that workers only have to check
+  // the cache.
+  std::set<std::string> directories;
+  for (const auto& operation : operations) {
+    directories.insert(GetParentDirectory(
+        isCopy ? operation.second.Raw() : operation.first.Raw()));
+  }
+  for (const auto& directory : directories) MakeDirectories(directory);
+
+  std::mutex failedFilesMutex;
+  std::size_t failedFilesCountBefore = failedFiles.size();
+  for (const auto& operation : operations) {
+    const auto* operationPtr = &operation;
+    ioThreadPool.Push([this, operationPtr, isCopy, &failedFiles,
+                       &failedFilesMutex]() {
+      bool success = isCopy ? CopyFile(operationPtr->first,
+                                       operationPtr->second)
+                            : WriteToFile(operationPtr->first,
+                                          operationPtr->second);
+      if (!success) {
+        std::lock_guard<std::mutex> lock(failedFilesMutex);
+        failedFiles.push_back(isCopy ? operationPtr->second
+                                     : operationPtr->first);
+      }
+    });
+  }
+  ioThreadPool.Wait();
+
+  return failedFiles.size() == failedFilesCountBefore;
+}
+
+bool NativeFileSystem::CopyFiles(
+    const std::vector<std::pair<gd::String, gd::String>>&
+        sourcesAndDestinations,
+    std::vector<gd::String>& failedFiles) {
+  return RunInParallel(sourcesAndDestinations, true, failedFiles);
+}
+
+bool NativeFileSystem::WriteFiles(
+    const std::vector<std::pair<gd::String, gd::String>>& filesAndContents,
+    std::vector<gd::String>& failedFiles) {
+  return RunInParallel(filesAndContents, false, failedFiles);
+}
+
+gd::String NativeFileSystem::ReadFile(const gd::String& file) {
+  int fd = open(file.c_str(), O_RDONLY);
+  if (fd < 0) {
+    gd::LogError("Unable to read " + file);
+    return "";
+  }
+
+  std::string content;
+  char buffer[64 * 1024];
+  while (true) {
+    ssize_t readCount = read(fd, buffer, sizeof(buffer));
+    if (readCount < 0) {
+      if (errno == EINTR) continue;
+      gd::LogError("Unable to read " + file);
+      break;
+    }
+    if (readCount == 0) break;
+    content.append(buffer, readCount);
+  }
+  close(fd);
+
+  return gd::String::FromUTF8(content);
+}
+
+std::vector<gd::String> NativeFileSystem::ReadDir(const gd::String& path,
+                                                  const gd::String& extension) {
+  std::vector<gd::String> files;
+  const std::string& upperCaseExtension = extension.UpperCase().Raw();
+
+  DIR* dir = opendir(path.c_str());
+  if (!dir) return files;
+
+  while (struct dirent* entry = readdir(dir)) {
+    gd::String name = gd::String::FromUTF8(entry->d_name);
+    if (name == "." || name == "..") continue;
+
+    const std::string upperCaseName = name.UpperCase().Raw();
+    if (upperCaseName.size() >= upperCaseExtension.size() &&
+        upperCaseName.compare(upperCaseName.size() - upperCaseExtension.size(),
+                              upperCaseExtension.size(),
+                              upperCaseExtension) == 0)
+      files.push_back(path + "/" + name);
+  }
+  closedir(dir);
+
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+}  // namespace gd
+
+#endif
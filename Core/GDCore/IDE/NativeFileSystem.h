@@ -0,0 +1,120 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+#if !defined(EMSCRIPTEN) && !defined(WINDOWS)
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/ThreadPool.h"
+
+#undef CopyFile  // Remove a Windows macro
+
+namespace gd {
+
+/**
+ * \brief An implementation of gd::AbstractFileSystem directly using the POSIX
+ * APIs of the system, to run exports without a JavaScript host (for example,
+ * in command line tools).
+ *
+ * Paths are using slashes as separators. Batch operations (CopyFiles and
+ * WriteFiles) are run in parallel on a bounded pool of I/O threads. On Linux,
+ * files are copied by the kernel (`copy_file_range`, then `sendfile`) without
+ * going through user space.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API NativeFileSystem : public AbstractFileSystem {
+ public:
+  /**
+   * \param ioThreadsCount The number of threads used for batch operations.
+   * If 0, batch operations are done serially.
+   */
+  explicit NativeFileSystem(
+      std::size_t ioThreadsCount = ThreadPool::GetDefaultThreadsCount());
+  virtual ~NativeFileSystem();
+
+  /**
+   * \brief Create the specified directory, and all its missing parents.
+   *
+   * Directories created (or found) are remembered so that creating them again
+   * is free.
+   */
+  virtual void MkDir(const gd::String& path) override;
+  virtual bool DirExists(const gd::String& path) override;
+  virtual bool FileExists(const gd::String& path) override;
+
+  /**
+   * \brief Remove all the files and directories inside the given directory.
+   */
+  virtual bool ClearDir(const gd::String& directory) override;
+  virtual gd::String GetTempDir() override;
+  virtual gd::String FileNameFrom(const gd::String& file) override;
+  virtual gd::String DirNameFrom(const gd::String& file) override;
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) override;
+  virtual bool IsAbsolute(const gd::String& filename) override;
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) override;
+
+  /**
+   * \brief Copy a file, creating the destination directory if needed.
+   */
+  virtual bool CopyFile(const gd::String& file,
+                        const gd::String& destination) override;
+
+  /**
+   * \brief Write a file, creating its directory if needed.
+   */
+  virtual bool WriteToFile(const gd::String& file,
+                           const gd::String& content) override;
+  virtual bool CopyFiles(
+      const std::vector<std::pair<gd::String, gd::String>>&
+          sourcesAndDestinations,
+      std::vector<gd::String>& failedFiles) override;
+  virtual bool WriteFiles(
+      const std::vector<std::pair<gd::String, gd::String>>& filesAndContents,
+      std::vector<gd::String>& failedFiles) override;
+  virtual gd::String ReadFile(const gd::String& file) override;
+  virtual std::vector<gd::String> ReadDir(
+      const gd::String& path, const gd::String& extension = "") override;
+
+  /**
+   * \brief Return the number of threads used for batch operations.
+   */
+  std::size_t GetIOThreadsCount() const {
+    return ioThreadPool.GetThreadsCount();
+  }
+
+  /**
+   * \brief Resolve "." and ".." components and duplicate separators of a path.
+   */
+  static std::string NormalizePath(const std::string& path);
+
+ private:
+  bool MakeDirectories(const std::string& path);
+  bool CopyFileContent(const std::string& source,
+                       const std::string& destination);
+  bool WriteFileContent(const std::string& file, const std::string& content);
+  bool RunInParallel(
+      const std::vector<std::pair<gd::String, gd::String>>& operations,
+      bool isCopy,
+      std::vector<gd::String>& failedFiles);
+
+  std::unordered_set<std::string>
+      knownDirectories;  ///< Directories known to exist, to make MkDir cheap.
+  std::mutex knownDirectoriesMutex;
+  gd::ThreadPool ioThreadPool;  ///< Declared last so that it's destroyed first.
+};
+
+}  // namespace gd
+
+#endif
@@ -27,4 +27,37 @@ gd::String NewNameGenerator::Generate(
   return NewNameGenerator::Generate(name, "", exists);
 }
 
+NewNamesGenerator::NewNamesGenerator(
+    const std::vector<gd::String> &existingNames)
+    : usedNames(existingNames.begin(), existingNames.end()) {}
+
+gd::String NewNamesGenerator::Generate(const gd::String &name,
+                                       const gd::String &prefix) {
+  if (!IsUsed(name)) {
+    usedNames.insert(name);
+    return name;
+  }
+
+  gd::String prefixedName = prefix + name;
+  if (!IsUsed(prefixedName)) {
+    usedNames.insert(prefixedName);
+    return prefixedName;
+  }
+
+  // Names are only added, so the suffixes before the last one that was
+  // generated are still used.
+  std::size_t &nextSuffix = nextSuffixes[prefixedName];
+  if (nextSuffix < 2) nextSuffix = 2;
+
+  gd::String potentialName = prefixedName + gd::String::From(nextSuffix);
+  while (IsUsed(potentialName)) {
+    nextSuffix++;
+    potentialName = prefixedName + gd::String::From(nextSuffix);
+  }
+  nextSuffix++;
+
+  usedNames.insert(potentialName);
+  return potentialName;
+}
+
 }  // namespace gd
@@ -6,14 +6,18 @@
 #ifndef GDCORE_NEWNAMEGENERATOR_H
 #define GDCORE_NEWNAMEGENERATOR_H
 #include <functional>
-namespace gd {
-class String;
-}
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "GDCore/String.h"
 
 namespace gd {
 
 /**
  * \brief Generate unique names.
+ *
+ * \see gd::NewNamesGenerator to generate a lot of names at once.
  */
 class GD_CORE_API NewNameGenerator {
  public:
@@ -36,6 +40,49 @@ class GD_CORE_API NewNameGenerator {
   ~NewNameGenerator();
 };
 
+/**
+ * \brief Generate a lot of unique names, for example when pasting or importing
+ * a lot of objects, instances, variables or resources.
+ *
+ * The existing names are given once, then each new name is generated in
+ * constant time (amortized): unlike with gd::NewNameGenerator::Generate, which
+ * tries "Name", "Name2", "Name3"... until a name is not used, the next suffix
+ * to try is remembered for each name.
+ *
+ * Names are generated the same way as gd::NewNameGenerator::Generate, and each
+ * generated name is then considered as used.
+ */
+class GD_CORE_API NewNamesGenerator {
+ public:
+  NewNamesGenerator(){};
+  explicit NewNamesGenerator(const std::vector<gd::String> &existingNames);
+
+  /**
+   * \brief Consider the name as used.
+   */
+  void AddName(const gd::String &name) { usedNames.insert(name); }
+
+  /**
+   * \brief Return true if the name is used (given as an existing name, added
+   * or generated).
+   */
+  bool IsUsed(const gd::String &name) const {
+    return usedNames.find(name) != usedNames.end();
+  }
+
+  /**
+   * \brief Generate a unique name, using the specified name and prefix as a
+   * first attempt, and consider it as used.
+   */
+  gd::String Generate(const gd::String &name, const gd::String &prefix = "");
+
+ private:
+  std::unordered_set<gd::String> usedNames;
+  std::unordered_map<gd::String, std::size_t>
+      nextSuffixes;  ///< The next suffix to try, for each name (with its
+                     ///< prefix) that was already used.
+};
+
 }  // namespace gd
 
 #endif  // GDCORE_NEWNAMEGENERATOR_H
@@ -77,13 +77,7 @@ void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
   // new filename while there is a collision.
   // Preserving extension is important.
   gd::String finalFilename =
-      gd::NewNameGenerator::Generate(
-          baseName,
-          [this, extension](const gd::String& newBaseName) {
-            return oldFilenames.find(newBaseName + extension) !=
-                   oldFilenames.end();
-          }) +
-      extension;
+      newBaseNamesGenerators[extension].Generate(baseName) + extension;
 
   newFilenames[oldFilename] = finalFilename;
   oldFilenames[finalFilename] = oldFilename;
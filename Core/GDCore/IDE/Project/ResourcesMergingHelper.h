@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include "GDCore/IDE/NewNameGenerator.h"
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -84,6 +85,10 @@ public:
    * New file names that can be accessed by their original name.
    */
   std::map<gd::String, gd::String> newFilenames;
+  /**
+   * Generators of the new file names (without extension), for each extension.
+   */
+  std::map<gd::String, gd::NewNamesGenerator> newBaseNamesGenerators;
   gd::String baseDirectory;
   bool preserveDirectoriesStructure;  ///< If set to true, the directory
                                       ///< structure, starting from
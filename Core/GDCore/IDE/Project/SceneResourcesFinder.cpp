@@ -5,7 +5,13 @@
  */
 #include "SceneResourcesFinder.h"
 
+#include <map>
+
+#include "GDCore/IDE/DependenciesAnalyzer.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
 #include "GDCore/IDE/ResourceExposer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Serialization/SerializerElement.h"
@@ -27,6 +33,91 @@ std::set<gd::String> SceneResourcesFinder::FindSceneResources(gd::Project &proje
   return resourceWorker.resourceNames;
 }
 
+void SceneResourcesFinder::FindProjectAndScenesResources(
+    gd::Project &project,
+    std::set<gd::String> &projectResourceNames,
+    std::unordered_map<gd::String, std::set<gd::String>>
+        &scenesResourceNames) {
+  projectResourceNames = FindProjectResources(project);
+
+  // Extensions events are considered as used by every scene (see
+  // gd::ResourceExposer::ExposeLayoutResources).
+  gd::SceneResourcesFinder extensionsResourceWorker(
+      project.GetResourcesManager());
+  auto extensionsEventWorker =
+      gd::GetResourceWorkerOnEvents(project, extensionsResourceWorker);
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(
+        project, project.GetEventsFunctionsExtension(e), extensionsEventWorker);
+  }
+
+  // Scene events and external events can be included in several scenes:
+  // remember the resources they use to only look at them once.
+  std::map<gd::String, std::set<gd::String>> layoutsEventsResourceNames;
+  std::map<gd::String, std::set<gd::String>> externalEventsResourceNames;
+  auto getLayoutEventsResources =
+      [&](gd::Layout &layout) -> const std::set<gd::String> & {
+    auto it = layoutsEventsResourceNames.find(layout.GetName());
+    if (it != layoutsEventsResourceNames.end()) return it->second;
+
+    return layoutsEventsResourceNames[layout.GetName()] =
+               FindEventsResources(project, layout.GetEvents());
+  };
+  auto getExternalEventsResources =
+      [&](gd::ExternalEvents &externalEvents) -> const std::set<gd::String> & {
+    auto it = externalEventsResourceNames.find(externalEvents.GetName());
+    if (it != externalEventsResourceNames.end()) return it->second;
+
+    return externalEventsResourceNames[externalEvents.GetName()] =
+               FindEventsResources(project, externalEvents.GetEvents());
+  };
+
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+    auto &layout = project.GetLayout(i);
+    gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+    gd::ResourceExposer::ExposeLayoutObjectsAndEffectsResources(
+        project, layout, resourceWorker);
+    auto &resourceNames = resourceWorker.resourceNames;
+
+    const auto &eventsResourceNames = getLayoutEventsResources(layout);
+    resourceNames.insert(eventsResourceNames.begin(),
+                         eventsResourceNames.end());
+
+    // Same as gd::ProjectBrowserHelper::ExposeLayoutEventsAndDependencies.
+    DependenciesAnalyzer dependenciesAnalyzer(project, layout);
+    if (dependenciesAnalyzer.Analyze()) {
+      for (const gd::String &externalEventsName :
+           dependenciesAnalyzer.GetExternalEventsDependencies()) {
+        const auto &dependencyResourceNames = getExternalEventsResources(
+            project.GetExternalEvents(externalEventsName));
+        resourceNames.insert(dependencyResourceNames.begin(),
+                             dependencyResourceNames.end());
+      }
+      for (const gd::String &sceneName :
+           dependenciesAnalyzer.GetScenesDependencies()) {
+        const auto &dependencyResourceNames =
+            getLayoutEventsResources(project.GetLayout(sceneName));
+        resourceNames.insert(dependencyResourceNames.begin(),
+                             dependencyResourceNames.end());
+      }
+    }
+
+    resourceNames.insert(extensionsResourceWorker.resourceNames.begin(),
+                         extensionsResourceWorker.resourceNames.end());
+    scenesResourceNames[layout.GetName()] = std::move(resourceNames);
+  }
+}
+
+std::set<gd::String> SceneResourcesFinder::FindEventsResources(
+    gd::Project &project, gd::EventsList &events) {
+  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+
+  auto eventWorker = gd::GetResourceWorkerOnEvents(project, resourceWorker);
+  eventWorker.Launch(events);
+  return resourceWorker.resourceNames;
+}
+
 void SceneResourcesFinder::AddUsedResource(gd::String &resourceName) {
   if (resourceName.empty()) {
     return;
@@ -10,10 +10,12 @@
 #include "GDCore/String.h"
 
 #include <set>
+#include <unordered_map>
 
 namespace gd {
 class Project;
 class Layout;
+class EventsList;
 class SerializerElement;
 } // namespace gd
 
@@ -41,12 +43,33 @@ public:
    */
   static std::set<gd::String> FindProjectResources(gd::Project &project);
 
+  /**
+   * @brief Find resource usages of the project and of every scene at once.
+   *
+   * This gives the same results as FindProjectResources and
+   * FindSceneResources, but the events of extensions, of external events and
+   * of scenes included by links are only looked at once, even if they are
+   * used by several scenes.
+   *
+   * \param projectResourceNames Filled with the resources used globally.
+   * \param scenesResourceNames Filled with the resources used by each scene,
+   * indexed by the scene names.
+   */
+  static void FindProjectAndScenesResources(
+      gd::Project &project,
+      std::set<gd::String> &projectResourceNames,
+      std::unordered_map<gd::String, std::set<gd::String>>
+          &scenesResourceNames);
+
   virtual ~SceneResourcesFinder(){};
 
 private:
   SceneResourcesFinder(gd::ResourcesManager &resourcesManager)
       : gd::ArbitraryResourceWorker(resourcesManager){};
 
+  static std::set<gd::String> FindEventsResources(gd::Project &project,
+                                                  gd::EventsList &events);
+
   void AddUsedResource(gd::String &resourceName);
 
   void ExposeFile(gd::String &resourceFileName) override{
@@ -73,7 +73,26 @@ void ResourceExposer::ExposeProjectResources(gd::Project& project, gd::Arbitrary
 void ResourceExposer::ExposeLayoutResources(
     gd::Project &project, gd::Layout &layout,
     gd::ArbitraryResourceWorker &worker) {
+  ExposeLayoutObjectsAndEffectsResources(project, layout, worker);
 
+  // Expose event resources
+  auto eventWorker = gd::GetResourceWorkerOnEvents(project, worker);
+  gd::ProjectBrowserHelper::ExposeLayoutEventsAndDependencies(project, layout,
+                                                              eventWorker);
+
+  // Exposed extension event resources
+  // Note that using resources in extensions is very unlikely and probably not
+  // worth the effort of something smart.
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(project, eventsFunctionsExtension, eventWorker);
+  }
+}
+
+void ResourceExposer::ExposeLayoutObjectsAndEffectsResources(
+    gd::Project &project, gd::Layout &layout,
+    gd::ArbitraryResourceWorker &worker) {
   // Expose object configuration resources
   auto objectWorker = gd::GetResourceWorkerOnObjects(project, worker);
   gd::ProjectBrowserHelper::ExposeLayoutObjects(layout, objectWorker);
@@ -91,20 +110,6 @@ void ResourceExposer::ExposeLayoutResources(
                                                  effect, worker);
     }
   }
-
-  // Expose event resources
-  auto eventWorker = gd::GetResourceWorkerOnEvents(project, worker);
-  gd::ProjectBrowserHelper::ExposeLayoutEventsAndDependencies(project, layout,
-                                                              eventWorker);
-
-  // Exposed extension event resources
-  // Note that using resources in extensions is very unlikely and probably not
-  // worth the effort of something smart.
-  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
-       e++) {
-    auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
-    gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(project, eventsFunctionsExtension, eventWorker);
-  }
 }
 
 void ResourceExposer::ExposeEffectResources(
@@ -48,6 +48,16 @@ public:
   static void ExposeLayoutResources(gd::Project &project, gd::Layout &layout,
                                           gd::ArbitraryResourceWorker &worker);
 
+  /**
+   * @brief Expose the resources used by the objects and the layer effects of a
+   * given layout.
+   *
+   * Unlike ExposeLayoutResources, it doesn't include resources used in events.
+   */
+  static void ExposeLayoutObjectsAndEffectsResources(
+      gd::Project &project, gd::Layout &layout,
+      gd::ArbitraryResourceWorker &worker);
+
   /**
    * @brief Expose the resources used in a given effect.
    */
@@ -0,0 +1,574 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+
+#include <map>
+#include <memory>
+#include <random>
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ParameterMetadataContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * An instruction or an expression that can be used by the generator.
+ */
+struct Function {
+  Function(const gd::String &name_,
+           const gd::ParameterMetadataContainer &parameters_)
+      : name(name_), parameters(&parameters_){};
+
+  gd::String name;
+  const gd::ParameterMetadataContainer *parameters;
+};
+
+/**
+ * The functions that can be used, either without objects or for an object
+ * type.
+ */
+struct Functions {
+  std::vector<Function> actions;
+  std::vector<Function> conditions;
+  std::vector<Function> numberExpressions;
+  std::vector<Function> stringExpressions;
+};
+
+/**
+ * The objects and variables that can be used by events.
+ */
+struct EventsScope {
+  std::vector<std::pair<gd::String, gd::String>> objects;  ///< Name and type.
+  std::vector<gd::String> groups;
+  std::vector<gd::String> variables;
+};
+
+class Generator {
+ public:
+  Generator(gd::Project &project_,
+            const gd::Platform &platform_,
+            const SyntheticProjectOptions &options_)
+      : project(project_),
+        platform(platform_),
+        options(options_),
+        randomGenerator(options_.seed){};
+
+  void Generate();
+
+ private:
+  /**
+   * Return a pseudo-random number in [0, max). std::uniform_int_distribution
+   * is not used as its results depend on the standard library.
+   */
+  std::size_t Random(std::size_t max) {
+    return max == 0 ? 0 : randomGenerator() % max;
+  }
+
+  void ListFunctionsAndTypes();
+  void AddFunctions(Functions &functions,
+                    std::map<gd::String, gd::InstructionMetadata> &actions,
+                    std::map<gd::String, gd::InstructionMetadata> &conditions,
+                    std::map<gd::String, gd::ExpressionMetadata> &expressions,
+                    std::map<gd::String, gd::ExpressionMetadata> &strExpressions);
+
+  void GenerateVariables(gd::VariablesContainer &variables,
+                         const gd::String &prefix,
+                         std::size_t count);
+  void GenerateScene(gd::Layout &layout, EventsScope &scope);
+  void GenerateEvents(gd::EventsList &events,
+                      const EventsScope &scope,
+                      std::size_t count,
+                      std::size_t depth);
+  bool GenerateInstruction(gd::InstructionsList &instructions,
+                           const EventsScope &scope,
+                           bool isCondition);
+  bool FillParameters(std::vector<gd::String> &values,
+                      const gd::ParameterMetadataContainer &parameters,
+                      std::size_t firstParameter,
+                      const EventsScope &scope,
+                      bool inExpression,
+                      std::size_t complexity);
+  gd::String GenerateNumberExpression(const EventsScope &scope,
+                                      std::size_t complexity);
+  gd::String GenerateStringExpression(const EventsScope &scope,
+                                      std::size_t complexity);
+  gd::String GenerateFunctionCall(const EventsScope &scope,
+                                  bool isNumber,
+                                  std::size_t complexity);
+
+  gd::Project &project;
+  const gd::Platform &platform;
+  const SyntheticProjectOptions &options;
+  std::mt19937 randomGenerator;
+
+  Functions freeFunctions;
+  std::map<gd::String, Functions> objectFunctions;
+  std::vector<gd::String> objectTypes;
+  std::vector<gd::String> behaviorTypes;
+  std::vector<gd::String> globalVariables;
+};
+
+void Generator::AddFunctions(
+    Functions &functions,
+    std::map<gd::String, gd::InstructionMetadata> &actions,
+    std::map<gd::String, gd::InstructionMetadata> &conditions,
+    std::map<gd::String, gd::ExpressionMetadata> &expressions,
+    std::map<gd::String, gd::ExpressionMetadata> &strExpressions) {
+  auto isUsable = [](const gd::InstructionMetadata &metadata) {
+    return !metadata.IsHidden() && !metadata.IsPrivate() &&
+           !metadata.IsAsync() && !metadata.CanHaveSubInstructions() &&
+           metadata.IsRelevantForLayoutEvents();
+  };
+  for (auto &it : actions) {
+    if (isUsable(it.second))
+      functions.actions.push_back(Function(it.first, it.second.GetParameters()));
+  }
+  for (auto &it : conditions) {
+    if (isUsable(it.second))
+      functions.conditions.push_back(
+          Function(it.first, it.second.GetParameters()));
+  }
+
+  auto isUsableExpression = [](const gd::ExpressionMetadata &metadata) {
+    return metadata.IsShown() && !metadata.IsPrivate() &&
+           metadata.IsRelevantForLayoutEvents();
+  };
+  for (auto &it : expressions) {
+    if (isUsableExpression(it.second))
+      functions.numberExpressions.push_back(
+          Function(it.first, it.second.GetParameters()));
+  }
+  for (auto &it : strExpressions) {
+    if (isUsableExpression(it.second))
+      functions.stringExpressions.push_back(
+          Function(it.first, it.second.GetParameters()));
+  }
+}
+
+void Generator::ListFunctionsAndTypes() {
+  for (const auto &extension : platform.GetAllPlatformExtensions()) {
+    AddFunctions(freeFunctions,
+                 extension->GetAllActions(),
+                 extension->GetAllConditions(),
+                 extension->GetAllExpressions(),
+                 extension->GetAllStrExpressions());
+
+    for (const gd::String &objectType : extension->GetExtensionObjectsTypes()) {
+      AddFunctions(objectFunctions[objectType],
+                   extension->GetAllActionsForObject(objectType),
+                   extension->GetAllConditionsForObject(objectType),
+                   extension->GetAllExpressionsForObject(objectType),
+                   extension->GetAllStrExpressionsForObject(objectType));
+
+      if (!objectType.empty() && options.objectTypes.empty() &&
+          !extension->GetObjectMetadata(objectType).IsHidden())
+        objectTypes.push_back(objectType);
+    }
+
+    if (options.behaviorTypes.empty()) {
+      for (const gd::String &behaviorType : extension->GetBehaviorsTypes()) {
+        const gd::BehaviorMetadata &behaviorMetadata =
+            extension->GetBehaviorMetadata(behaviorType);
+        if (!behaviorMetadata.IsHidden() && !behaviorMetadata.IsPrivate() &&
+            behaviorMetadata.GetObjectType().empty())
+          behaviorTypes.push_back(behaviorType);
+      }
+    }
+  }
+
+  if (!options.objectTypes.empty()) objectTypes = options.objectTypes;
+  if (!options.behaviorTypes.empty()) behaviorTypes = options.behaviorTypes;
+}
+
+void Generator::GenerateVariables(gd::VariablesContainer &variables,
+                                  const gd::String &prefix,
+                                  std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    gd::Variable &variable =
+        variables.InsertNew(prefix + gd::String::From(i), variables.Count());
+    switch (Random(4)) {
+      case 0:
+        variable.SetString("Text" + gd::String::From(Random(1000)));
+        break;
+      case 1:
+        variable.GetChild("Child").SetValue(Random(1000));
+        break;
+      default:
+        variable.SetValue(Random(1000));
+    }
+  }
+}
+
+gd::String Generator::GenerateNumberExpression(const EventsScope &scope,
+                                               std::size_t complexity) {
+  static const char *operators[] = {" + ", " - ", " * "};
+
+  gd::String expression;
+  const std::size_t termsCount = complexity == 0 ? 1 : complexity;
+  for (std::size_t i = 0; i < termsCount; ++i) {
+    if (i != 0) expression += operators[Random(3)];
+
+    gd::String call;
+    if (complexity > 0 && Random(2) == 0)
+      call = GenerateFunctionCall(scope, true, complexity / 2);
+    expression += call.empty() ? gd::String::From(Random(1000)) : call;
+  }
+
+  return expression;
+}
+
+gd::String Generator::GenerateStringExpression(const EventsScope &scope,
+                                               std::size_t complexity) {
+  gd::String expression;
+  const std::size_t termsCount = complexity == 0 ? 1 : (complexity + 1) / 2;
+  for (std::size_t i = 0; i < termsCount; ++i) {
+    if (i != 0) expression += " + ";
+
+    gd::String call;
+    if (complexity > 0 && Random(2) == 0)
+      call = GenerateFunctionCall(scope, false, complexity / 2);
+    expression +=
+        call.empty() ? "\"Text" + gd::String::From(Random(1000)) + "\"" : call;
+  }
+
+  return expression;
+}
+
+gd::String Generator::GenerateFunctionCall(const EventsScope &scope,
+                                           bool isNumber,
+                                           std::size_t complexity) {
+  // Either call a free function or a function of an object.
+  const std::pair<gd::String, gd::String> *object =
+      !scope.objects.empty() && Random(2) == 0
+          ? &scope.objects[Random(scope.objects.size())]
+          : nullptr;
+
+  const std::vector<Function> *candidates = nullptr;
+  if (object) {
+    // Objects also have the functions of the base object.
+    const Functions &functions =
+        objectFunctions[Random(2) == 0 ? object->second : ""];
+    candidates = isNumber ? &functions.numberExpressions
+                          : &functions.stringExpressions;
+  } else {
+    candidates = isNumber ? &freeFunctions.numberExpressions
+                          : &freeFunctions.stringExpressions;
+  }
+  if (candidates->empty()) return "";
+
+  // Try the functions, starting from a random one, until one can be used.
+  const std::size_t start = Random(candidates->size());
+  for (std::size_t i = 0; i < candidates->size(); ++i) {
+    const Function &function =
+        (*candidates)[(start + i) % candidates->size()];
+
+    std::vector<gd::String> values;
+    if (object) values.push_back(object->first);
+    if (!FillParameters(values,
+                        *function.parameters,
+                        object ? 1 : 0,
+                        scope,
+                        true,
+                        complexity))
+      continue;
+
+    gd::String arguments;
+    for (std::size_t p = object ? 1 : 0; p < values.size(); ++p) {
+      if (function.parameters->GetParameter(p).IsCodeOnly()) continue;
+      if (!arguments.empty()) arguments += ", ";
+      arguments += values[p];
+    }
+
+    return (object ? object->first + "." : "") + function.name + "(" +
+           arguments + ")";
+  }
+
+  return "";
+}
+
+bool Generator::FillParameters(
+    std::vector<gd::String> &values,
+    const gd::ParameterMetadataContainer &parameters,
+    std::size_t firstParameter,
+    const EventsScope &scope,
+    bool inExpression,
+    std::size_t complexity) {
+  gd::String lastObjectName = values.empty() ? "" : values.back();
+
+  for (std::size_t i = firstParameter; i < parameters.GetParametersCount();
+       ++i) {
+    const gd::ParameterMetadata &parameter = parameters.GetParameter(i);
+    const gd::String &type = parameter.GetType();
+    if (parameter.IsCodeOnly()) {
+      values.push_back("");
+      continue;
+    }
+
+    gd::String value;
+    if (gd::ParameterMetadata::IsObject(type)) {
+      // Use an object of the required type (or any object or group).
+      const gd::String &requiredType = parameter.GetExtraInfo();
+      std::vector<gd::String> candidates;
+      for (const auto &object : scope.objects) {
+        if (requiredType.empty() || object.second == requiredType)
+          candidates.push_back(object.first);
+      }
+      if (requiredType.empty())
+        candidates.insert(
+            candidates.end(), scope.groups.begin(), scope.groups.end());
+
+      if (!candidates.empty()) {
+        value = candidates[Random(candidates.size())];
+        lastObjectName = value;
+      }
+    } else if (type == "objectvar") {
+      if (!lastObjectName.empty() && options.variablesPerObject > 0)
+        value = "ObjectVariable" +
+                gd::String::From(Random(options.variablesPerObject));
+    } else if (type == "scenevar" || type == "variable") {
+      if (!scope.variables.empty())
+        value = scope.variables[Random(scope.variables.size())];
+    } else if (type == "globalvar") {
+      if (!globalVariables.empty())
+        value = globalVariables[Random(globalVariables.size())];
+    } else if (type == "layer") {
+      value = "\"\"";
+    } else if (gd::ParameterMetadata::IsExpression("number", type)) {
+      value = GenerateNumberExpression(scope, complexity);
+    } else if (type == "string") {
+      value = GenerateStringExpression(scope, complexity);
+    } else if (type == "yesorno") {
+      value = inExpression ? "" : "yes";
+    } else if (type == "trueorfalse") {
+      value = inExpression ? "" : "True";
+    } else if (type == "operator" || type == "relationalOperator") {
+      value = inExpression ? "" : "=";
+    }
+
+    if (value.empty()) {
+      if (!parameter.IsOptional()) return false;
+
+      // Optional parameters are omitted in expressions, and use their
+      // default value in instructions.
+      if (inExpression) break;
+      value = parameter.GetDefaultValue();
+    }
+    values.push_back(value);
+  }
+
+  return true;
+}
+
+bool Generator::GenerateInstruction(gd::InstructionsList &instructions,
+                                    const EventsScope &scope,
+                                    bool isCondition) {
+  // Either use a free instruction or an instruction of an object.
+  const std::pair<gd::String, gd::String> *object =
+      !scope.objects.empty() && Random(2) == 0
+          ? &scope.objects[Random(scope.objects.size())]
+          : nullptr;
+  const Functions &functions =
+      object ? objectFunctions[Random(2) == 0 ? object->second : ""]
+             : freeFunctions;
+  const std::vector<Function> &candidates =
+      isCondition ? functions.conditions : functions.actions;
+  if (candidates.empty()) return false;
+
+  // Try the instructions, starting from a random one, until one can be used.
+  const std::size_t start = Random(candidates.size());
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    const Function &function = candidates[(start + i) % candidates.size()];
+
+    std::vector<gd::String> values;
+    if (object) values.push_back(object->first);
+    if (!FillParameters(values,
+                        *function.parameters,
+                        object ? 1 : 0,
+                        scope,
+                        false,
+                        options.expressionComplexity))
+      continue;
+
+    gd::Instruction instruction;
+    instruction.SetType(function.name);
+    instruction.SetParametersCount(values.size());
+    for (std::size_t p = 0; p < values.size(); ++p)
+      instruction.SetParameter(p, gd::Expression(values[p]));
+    instructions.Insert(instruction);
+    return true;
+  }
+
+  return false;
+}
+
+void Generator::GenerateEvents(gd::EventsList &events,
+                               const EventsScope &scope,
+                               std::size_t count,
+                               std::size_t depth) {
+  for (std::size_t i = 0; i < count; ++i) {
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    if (options.instructionsPerEvent > 0)
+      GenerateInstruction(event.GetConditions(), scope, true);
+    for (std::size_t a = 0; a < options.instructionsPerEvent; ++a)
+      GenerateInstruction(event.GetActions(), scope, false);
+
+    if (depth > 0)
+      GenerateEvents(
+          event.GetSubEvents(), scope, options.subEventsPerEvent, depth - 1);
+
+    events.InsertEvent(event);
+  }
+}
+
+void Generator::GenerateScene(gd::Layout &layout, EventsScope &scope) {
+  GenerateVariables(layout.GetVariables(), "SceneVariable",
+                    options.variablesPerScene);
+  for (std::size_t i = 0; i < options.variablesPerScene; ++i)
+    scope.variables.push_back("SceneVariable" + gd::String::From(i));
+
+  if (!objectTypes.empty()) {
+    for (std::size_t i = 0; i < options.objectsPerScene; ++i) {
+      const gd::String name = "Object" + gd::String::From(i);
+      const gd::String &type = objectTypes[Random(objectTypes.size())];
+      gd::Object &object =
+          layout.GetObjects().InsertNewObject(project, type, name, i);
+      scope.objects.push_back(std::make_pair(name, type));
+
+      GenerateVariables(
+          object.GetVariables(), "ObjectVariable", options.variablesPerObject);
+
+      for (std::size_t b = 0;
+           b < options.behaviorsPerObject && !behaviorTypes.empty();
+           ++b) {
+        const gd::String &behaviorType =
+            behaviorTypes[(i + b) % behaviorTypes.size()];
+        const gd::String behaviorName = "Behavior" + gd::String::From(b);
+        object.AddNewBehavior(project, behaviorType, behaviorName);
+      }
+    }
+  }
+
+  if (!scope.objects.empty()) {
+    for (std::size_t i = 0; i < options.groupsPerScene; ++i) {
+      const gd::String name = "Group" + gd::String::From(i);
+      gd::ObjectGroup &group =
+          layout.GetObjects().GetObjectGroups().InsertNew(name, i);
+      const std::size_t start = Random(scope.objects.size());
+      for (std::size_t o = 0;
+           o < options.objectsPerGroup && o < scope.objects.size();
+           ++o) {
+        group.AddObject(
+            scope.objects[(start + o) % scope.objects.size()].first);
+      }
+      scope.groups.push_back(name);
+    }
+
+    for (std::size_t i = 0; i < options.instancesPerScene; ++i) {
+      gd::InitialInstance &instance =
+          layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName(scope.objects[Random(scope.objects.size())].first);
+      instance.SetX(Random(1920));
+      instance.SetY(Random(1080));
+      instance.SetZOrder(i);
+    }
+  }
+
+  GenerateEvents(
+      layout.GetEvents(), scope, options.eventsPerScene, options.eventsDepth);
+}
+
+void Generator::Generate() {
+  ListFunctionsAndTypes();
+
+  GenerateVariables(
+      project.GetVariables(), "GlobalVariable", options.globalVariablesCount);
+  for (std::size_t i = 0; i < options.globalVariablesCount; ++i)
+    globalVariables.push_back("GlobalVariable" + gd::String::From(i));
+
+  std::vector<EventsScope> scenesScopes(options.scenesCount);
+  for (std::size_t i = 0; i < options.scenesCount; ++i) {
+    gd::Layout &layout = project.InsertNewLayout(
+        "Scene" + gd::String::From(i), project.GetLayoutsCount());
+    GenerateScene(layout, scenesScopes[i]);
+  }
+
+  // External events are associated with a scene and linked from its events.
+  for (std::size_t i = 0; i < options.externalEventsCount &&
+                          options.scenesCount > 0;
+       ++i) {
+    const gd::String name = "ExternalEvents" + gd::String::From(i);
+    gd::Layout &layout = project.GetLayout(i % options.scenesCount);
+    gd::ExternalEvents &externalEvents =
+        project.InsertNewExternalEvents(name, project.GetExternalEventsCount());
+    externalEvents.SetAssociatedLayout(layout.GetName());
+    GenerateEvents(externalEvents.GetEvents(),
+                   scenesScopes[i % options.scenesCount],
+                   options.eventsPerScene,
+                   options.eventsDepth);
+
+    gd::LinkEvent linkEvent;
+    linkEvent.SetType("BuiltinCommonInstructions::Link");
+    linkEvent.SetTarget(name);
+    layout.GetEvents().InsertEvent(linkEvent);
+  }
+
+  // Functions only use free instructions and expressions.
+  EventsScope functionScope;
+  for (std::size_t i = 0; i < options.eventsFunctionsExtensionsCount; ++i) {
+    const gd::String name = "SyntheticExtension" + gd::String::From(i);
+    gd::EventsFunctionsExtension &extension =
+        project.InsertNewEventsFunctionsExtension(
+            name, project.GetEventsFunctionsExtensionsCount());
+    extension.SetNamespace(name);
+
+    for (std::size_t f = 0; f < options.eventsFunctionsPerExtension; ++f) {
+      gd::EventsFunction &eventsFunction = extension.InsertNewEventsFunction(
+          "Function" + gd::String::From(f), f);
+      eventsFunction.GetParameters()
+          .AddNewParameter("Value")
+          .SetType("expression");
+      GenerateEvents(eventsFunction.GetEvents(),
+                     functionScope,
+                     options.eventsPerScene,
+                     options.eventsDepth);
+    }
+  }
+}
+
+}  // namespace
+
+void SyntheticProjectGenerator::Generate(
+    gd::Project &project,
+    const gd::Platform &platform,
+    const SyntheticProjectOptions &options) {
+  Generator generator(project, platform, options);
+  generator.Generate();
+}
+
+}  // namespace gd
@@ -0,0 +1,107 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The sizes of a project built by gd::SyntheticProjectGenerator.
+ */
+struct GD_CORE_API SyntheticProjectOptions {
+  SyntheticProjectOptions()
+      : seed(1),
+        scenesCount(3),
+        objectsPerScene(10),
+        groupsPerScene(2),
+        objectsPerGroup(3),
+        behaviorsPerObject(1),
+        instancesPerScene(20),
+        eventsPerScene(20),
+        eventsDepth(1),
+        subEventsPerEvent(2),
+        instructionsPerEvent(2),
+        expressionComplexity(3),
+        variablesPerScene(5),
+        globalVariablesCount(5),
+        variablesPerObject(2),
+        externalEventsCount(1),
+        eventsFunctionsExtensionsCount(1),
+        eventsFunctionsPerExtension(3){};
+
+  std::uint32_t seed;  ///< Same seed and options give the same project.
+  std::size_t scenesCount;
+  std::size_t objectsPerScene;
+  std::size_t groupsPerScene;
+  std::size_t objectsPerGroup;
+  std::size_t behaviorsPerObject;
+  std::size_t instancesPerScene;
+  std::size_t eventsPerScene;  ///< Top level events of each scene.
+  std::size_t eventsDepth;  ///< Levels of sub-events below each event.
+  std::size_t subEventsPerEvent;  ///< Sub-events of an event, at each level.
+  std::size_t instructionsPerEvent;  ///< Actions (plus a condition) per event.
+  std::size_t expressionComplexity;  ///< Terms in a number expression.
+  std::size_t variablesPerScene;
+  std::size_t globalVariablesCount;
+  std::size_t variablesPerObject;
+  std::size_t externalEventsCount;  ///< Each one is linked from a scene.
+  std::size_t eventsFunctionsExtensionsCount;
+  std::size_t eventsFunctionsPerExtension;
+
+  /**
+   * Object types to use. If empty, all the (visible) object types of the
+   * platform are used.
+   */
+  std::vector<gd::String> objectTypes;
+
+  /**
+   * Behavior types to use. If empty, the (visible) behaviors of the platform
+   * that can be used on any object are used.
+   */
+  std::vector<gd::String> behaviorTypes;
+};
+
+/**
+ * \brief Build large, realistic projects to measure and test how the tools
+ * scale.
+ *
+ * Objects, behaviors, instructions and expressions are picked among the ones
+ * declared by the platform, so the same generator can be used with the
+ * platform used by tests or with the platform of the game engine. Only the
+ * instructions and expressions having parameters that can be filled (numbers,
+ * strings, objects, variables, booleans and operators) are used.
+ *
+ * The generation is deterministic: a pseudo-random number generator is
+ * seeded with SyntheticProjectOptions::seed. Only the persistent UUIDs of the
+ * instances are random.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API SyntheticProjectGenerator {
+ public:
+  /**
+   * \brief Fill the project with scenes, objects, groups, instances,
+   * variables, events, external events and events functions extensions.
+   *
+   * The project must be empty and the platform must have been added to it.
+   */
+  static void Generate(gd::Project &project,
+                       const gd::Platform &platform,
+                       const SyntheticProjectOptions &options);
+
+ private:
+  SyntheticProjectGenerator();
+};
+
+}  // namespace gd
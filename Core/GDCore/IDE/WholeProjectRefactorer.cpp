@@ -53,6 +53,7 @@
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/Tracing.h"
 
 namespace gd {
 
@@ -154,7 +155,7 @@ WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
     return changeset;
   }
 
-  std::unordered_map<gd::String, gd::String> removedUuidAndNames;
+  std::unordered_map<gd::Uuid, gd::String> removedUuidAndNames;
   for (std::size_t i = 0; i < oldVariablesContainer.Count(); ++i) {
     const auto &variable = oldVariablesContainer.Get(i);
     const auto &variableName = oldVariablesContainer.GetNameAt(i);
@@ -220,7 +221,7 @@ WholeProjectRefactorer::ComputeChangesetForVariable(
     return std::shared_ptr<VariablesRenamingChangesetNode>(nullptr);
   }
 
-  std::unordered_map<gd::String, gd::String> oldVariableNamesByUuid;
+  std::unordered_map<gd::Uuid, gd::String> oldVariableNamesByUuid;
   for (const auto &pair : oldVariable.GetAllChildren()) {
     const auto &oldName = pair.first;
     const auto oldChild = pair.second;
@@ -273,7 +274,7 @@ bool WholeProjectRefactorer::HasAnyVariableTypeChanged(
     return false;
   }
 
-  std::unordered_map<gd::String, gd::String> oldVariableNamesByUuid;
+  std::unordered_map<gd::Uuid, gd::String> oldVariableNamesByUuid;
   for (const auto &pair : oldVariable.GetAllChildren()) {
     const auto &oldName = pair.first;
     const auto oldChild = pair.second;
@@ -307,6 +308,8 @@ void WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
     gd::Project &project, gd::VariablesContainer &variablesContainer,
     const gd::VariablesChangeset &changeset,
     const gd::SerializerElement &originalSerializedVariables) {
+  gd::TraceScope traceScope("Refactoring",
+                            "ApplyRefactoringForVariablesContainer");
   // Revert changes
   gd::SerializerElement editedSerializedVariables;
   variablesContainer.SerializeTo(editedSerializedVariables);
@@ -444,6 +447,9 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldName, const gd::String &newName,
     const gd::ProjectBrowser &projectBrowser) {
+  gd::TraceScope traceScope("Refactoring",
+                            "RenameEventsFunctionsExtension",
+                            oldName);
   auto renameEventsFunction = [&project, &oldName, &newName, &projectBrowser](
                                   const gd::EventsFunction &eventsFunction) {
     DoRenameEventsFunction(project, eventsFunction,
@@ -695,6 +701,9 @@ void WholeProjectRefactorer::RenameEventsFunction(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+  gd::TraceScope traceScope("Refactoring",
+                            "RenameEventsFunction",
+                            oldFunctionName);
   if (!eventsFunctionsExtension.HasEventsFunctionNamed(oldFunctionName))
     return;
 
@@ -1337,6 +1346,9 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldBehaviorName, const gd::String &newBehaviorName) {
+  gd::TraceScope traceScope("Refactoring",
+                            "RenameEventsBasedBehavior",
+                            oldBehaviorName);
   auto &eventsBasedBehaviors =
       eventsFunctionsExtension.GetEventsBasedBehaviors();
   if (!eventsBasedBehaviors.Has(oldBehaviorName)) {
@@ -1492,6 +1504,9 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldObjectName, const gd::String &newObjectName) {
+  gd::TraceScope traceScope("Refactoring",
+                            "RenameEventsBasedObject",
+                            oldObjectName);
   auto &eventsBasedObjects = eventsFunctionsExtension.GetEventsBasedObjects();
   if (!eventsBasedObjects.Has(oldObjectName)) {
     gd::LogWarning("Warning, " + oldObjectName +
@@ -1659,6 +1674,7 @@ void WholeProjectRefactorer::DoRenameObject(
 
 void WholeProjectRefactorer::ObjectRemovedInScene(
     gd::Project &project, gd::Layout &layout, const gd::String &objectName) {
+  gd::TraceScope traceScope("Refactoring", "ObjectRemovedInScene", objectName);
   auto projectScopedContainers = gd::ProjectScopedContainers::
       MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
 
@@ -1692,6 +1708,9 @@ void WholeProjectRefactorer::BehaviorsAddedToObjectInScene(
 void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
     gd::Project &project, gd::Layout &layout, const gd::String &oldName,
     const gd::String &newName, bool isObjectGroup) {
+  gd::TraceScope traceScope("Refactoring",
+                            "ObjectOrGroupRenamedInScene",
+                            oldName);
   if (oldName == newName || newName.empty() || oldName.empty())
     return;
 
@@ -1733,9 +1752,55 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
   }
 }
 
+void WholeProjectRefactorer::ObjectsOrGroupsRenamedInScene(
+    gd::Project &project, gd::Layout &layout,
+    const std::map<gd::String, gd::String> &oldToNewNames) {
+  gd::TraceScope traceScope("Refactoring", "ObjectsOrGroupsRenamedInScene");
+  std::map<gd::String, gd::String> renamedNames;
+  for (const auto &oldAndNewName : oldToNewNames) {
+    if (oldAndNewName.first != oldAndNewName.second &&
+        !oldAndNewName.first.empty() && !oldAndNewName.second.empty())
+      renamedNames.insert(oldAndNewName);
+  }
+  if (renamedNames.empty()) return;
+
+  auto projectScopedContainers = gd::ProjectScopedContainers::
+      MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+
+  // Rename objects in the current layout and in external events. This is
+  // done before changing groups, so that the objects of groups used in
+  // expressions can still be found.
+  gd::EventsRefactorer::RenameObjectsInEvents(
+      project.GetCurrentPlatform(), projectScopedContainers, layout.GetEvents(),
+      renamedNames);
+  for (auto &externalEventsName :
+       GetAssociatedExternalEvents(project, layout.GetName())) {
+    auto &externalEvents = project.GetExternalEvents(externalEventsName);
+    gd::EventsRefactorer::RenameObjectsInEvents(
+        project.GetCurrentPlatform(), projectScopedContainers,
+        externalEvents.GetEvents(), renamedNames);
+  }
+
+  // Groups have no instances and can't be in other groups, so they are
+  // renamed like objects here.
+  auto &groups = layout.GetObjects().GetObjectGroups();
+  layout.GetInitialInstances().RenameInstancesOfObjects(renamedNames);
+  for (std::size_t g = 0; g < groups.size(); ++g) {
+    groups[g].RenameObjects(renamedNames);
+  }
+
+  // Rename objects in external layouts
+  for (const gd::String &name : GetAssociatedExternalLayouts(project, layout)) {
+    auto &externalLayout = project.GetExternalLayout(name);
+    externalLayout.GetInitialInstances().RenameInstancesOfObjects(
+        renamedNames);
+  }
+}
+
 void WholeProjectRefactorer::RenameLayout(gd::Project &project,
                                           const gd::String &oldName,
                                           const gd::String &newName) {
+  gd::TraceScope traceScope("Refactoring", "RenameLayout", oldName);
   if (oldName == newName || newName.empty() || oldName.empty())
     return;
   gd::ProjectElementRenamer projectElementRenamer(
@@ -1999,6 +2064,9 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsFunction(
 void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
     gd::Project &project, const gd::String &oldName, const gd::String &newName,
     bool isObjectGroup) {
+  gd::TraceScope traceScope("Refactoring",
+                            "GlobalObjectOrGroupRenamed",
+                            oldName);
   // Object groups can't be in other groups
   if (!isObjectGroup) {
     for (std::size_t g = 0; g < project.GetObjects().GetObjectGroups().size();
@@ -2017,8 +2085,32 @@ void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
   }
 }
 
+void WholeProjectRefactorer::GlobalObjectsOrGroupsRenamed(
+    gd::Project &project,
+    const std::map<gd::String, gd::String> &oldToNewNames) {
+  gd::TraceScope traceScope("Refactoring", "GlobalObjectsOrGroupsRenamed");
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::Layout &layout = project.GetLayout(i);
+
+    // Objects of the layout hide the global objects with the same name.
+    std::map<gd::String, gd::String> layoutOldToNewNames;
+    for (const auto &oldAndNewName : oldToNewNames) {
+      if (!layout.GetObjects().HasObjectNamed(oldAndNewName.first))
+        layoutOldToNewNames.insert(oldAndNewName);
+    }
+
+    ObjectsOrGroupsRenamedInScene(project, layout, layoutOldToNewNames);
+  }
+
+  auto &globalGroups = project.GetObjects().GetObjectGroups();
+  for (std::size_t g = 0; g < globalGroups.size(); ++g) {
+    globalGroups[g].RenameObjects(oldToNewNames);
+  }
+}
+
 void WholeProjectRefactorer::GlobalObjectRemoved(gd::Project &project,
                                                  const gd::String &objectName) {
+  gd::TraceScope traceScope("Refactoring", "GlobalObjectRemoved", objectName);
   auto &globalGroups = project.GetObjects().GetObjectGroups();
   for (std::size_t g = 0; g < globalGroups.size(); ++g) {
     globalGroups[g].RemoveObject(objectName);
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
@@ -475,6 +476,19 @@ class GD_CORE_API WholeProjectRefactorer {
                                           const gd::String &newName,
                                           bool isObjectGroup);
 
+  /**
+   * \brief Refactor the project after objects or groups are renamed in a
+   * layout.
+   *
+   * This is the same as ObjectOrGroupRenamedInScene, but the events are
+   * browsed only once for all the renamings. All the objects are renamed at
+   * once: an object can be renamed to the old name of another one.
+   */
+  static void ObjectsOrGroupsRenamedInScene(
+      gd::Project &project,
+      gd::Layout &scene,
+      const std::map<gd::String, gd::String> &oldToNewNames);
+
   /**
    * \brief Refactor the project after an object is removed in a layout
    *
@@ -554,6 +568,16 @@ class GD_CORE_API WholeProjectRefactorer {
                                          const gd::String& newName,
                                          bool isObjectGroup);
 
+  /**
+   * \brief Refactor the project after global objects or groups are renamed.
+   *
+   * This is the same as GlobalObjectOrGroupRenamed, but the events are
+   * browsed only once for all the renamings.
+   */
+  static void GlobalObjectsOrGroupsRenamed(
+      gd::Project& project,
+      const std::map<gd::String, gd::String>& oldToNewNames);
+
   /**
    * \brief Refactor the project after a global object is removed.
    *
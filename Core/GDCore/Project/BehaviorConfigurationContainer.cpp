@@ -23,6 +23,14 @@ std::map<gd::String, gd::PropertyDescriptor> BehaviorConfigurationContainer::Get
   return nothing;
 }
 
+gd::String BehaviorConfigurationContainer::GetPropertyValue(
+    const gd::SerializerElement& behaviorContent,
+    const gd::String& name) const {
+  const auto properties = GetProperties(behaviorContent);
+  const auto it = properties.find(name);
+  return it != properties.end() ? it->second.GetValue() : "";
+}
+
 void BehaviorConfigurationContainer::ExposeResources(gd::ArbitraryResourceWorker& worker) {
   std::map<gd::String, gd::PropertyDescriptor> properties = GetProperties();
 
@@ -79,6 +79,16 @@ class GD_CORE_API BehaviorConfigurationContainer {
    */
   std::map<gd::String, gd::PropertyDescriptor> GetProperties() const;
 
+  /**
+   * \brief Return the value of a custom property of the behavior, without
+   * building the descriptors of all the properties.
+   *
+   * \return the value, or an empty string if the property doesn't exist.
+   */
+  gd::String GetPropertyValue(const gd::String& name) const {
+    return GetPropertyValue(content, name);
+  };
+
   /**
    * \brief Called when the IDE wants to update a custom property of the
    * behavior
@@ -189,6 +199,18 @@ class GD_CORE_API BehaviorConfigurationContainer {
   virtual std::map<gd::String, gd::PropertyDescriptor> GetProperties(
       const gd::SerializerElement& behaviorContent) const;
 
+  /**
+   * \brief Return the value of a custom property of the behavior.
+   *
+   * By default, this looks for the property in GetProperties. Override it
+   * when the value can be read without building all the properties.
+   *
+   * \return the value, or an empty string if the property doesn't exist.
+   */
+  virtual gd::String GetPropertyValue(
+      const gd::SerializerElement& behaviorContent,
+      const gd::String& name) const;
+
   /**
    * \brief Called when the IDE wants to update a custom property of the
    * behavior
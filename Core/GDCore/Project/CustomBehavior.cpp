@@ -44,6 +44,19 @@ std::map<gd::String, gd::PropertyDescriptor> CustomBehavior::GetProperties(
   return gd::CustomConfigurationHelper::GetProperties(properties, behaviorContent);
 }
 
+gd::String CustomBehavior::GetPropertyValue(
+    const gd::SerializerElement &behaviorContent,
+    const gd::String &propertyName) const {
+  if (!project.HasEventsBasedBehavior(GetTypeName())) {
+    return "";
+  }
+  const auto &eventsBasedBehavior = project.GetEventsBasedBehavior(GetTypeName());
+  const auto &properties = eventsBasedBehavior.GetPropertyDescriptors();
+
+  return gd::CustomConfigurationHelper::GetPropertyValue(
+      properties, behaviorContent, propertyName);
+}
+
 bool CustomBehavior::UpdateProperty(gd::SerializerElement &behaviorContent,
                                     const gd::String &propertyName,
                                     const gd::String &newValue) {
@@ -44,6 +44,19 @@ std::map<gd::String, gd::PropertyDescriptor> CustomBehaviorsSharedData::GetPrope
   return gd::CustomConfigurationHelper::GetProperties(properties, behaviorContent);
 }
 
+gd::String CustomBehaviorsSharedData::GetPropertyValue(
+    const gd::SerializerElement &behaviorContent,
+    const gd::String &propertyName) const {
+  if (!project.HasEventsBasedBehavior(GetTypeName())) {
+    return "";
+  }
+  const auto &eventsBasedBehavior = project.GetEventsBasedBehavior(GetTypeName());
+  const auto &properties = eventsBasedBehavior.GetSharedPropertyDescriptors();
+
+  return gd::CustomConfigurationHelper::GetPropertyValue(
+      properties, behaviorContent, propertyName);
+}
+
 bool CustomBehaviorsSharedData::UpdateProperty(gd::SerializerElement &behaviorContent,
                                     const gd::String &propertyName,
                                     const gd::String &newValue) {
@@ -33,6 +33,8 @@ public:
 protected:
   std::map<gd::String, gd::PropertyDescriptor>
   GetProperties(const gd::SerializerElement &behaviorContent) const override;
+  gd::String GetPropertyValue(const gd::SerializerElement &behaviorContent,
+                              const gd::String &name) const override;
   bool UpdateProperty(gd::SerializerElement &behaviorContent,
                       const gd::String &name, const gd::String &value) override;
   void InitializeContent(gd::SerializerElement &behaviorContent) override;
@@ -43,37 +43,51 @@ std::map<gd::String, gd::PropertyDescriptor> CustomConfigurationHelper::GetPrope
 
   for (auto &property : properties.GetInternalVector()) {
     const auto &propertyName = property->GetName();
-    const auto &propertyType = property->GetType();
 
     // Copy the property
     objectProperties[propertyName] = *property;
 
     auto &newProperty = objectProperties[propertyName];
-
-    if (configurationContent.HasChild(propertyName)) {
-      if (propertyType == "String" || propertyType == "Choice" ||
-          propertyType == "Color" || propertyType == "Behavior" ||
-          propertyType == "Resource") {
-        newProperty.SetValue(
-            configurationContent.GetChild(propertyName).GetStringValue());
-      } else if (propertyType == "Number") {
-        newProperty.SetValue(gd::String::From(
-            configurationContent.GetChild(propertyName).GetDoubleValue()));
-      } else if (propertyType == "Boolean") {
-        newProperty.SetValue(
-            configurationContent.GetChild(propertyName).GetBoolValue()
-                ? "true"
-                : "false");
-      }
-    } else {
-      // No value was serialized for this property. `newProperty`
-      // will have the default value coming from `enumeratedProperty`.
-    }
+    newProperty.SetValue(GetPropertyValue(*property, configurationContent));
   }
 
   return objectProperties;
 }
 
+gd::String CustomConfigurationHelper::GetPropertyValue(
+    const gd::PropertiesContainer &properties,
+    const gd::SerializerElement &configurationContent,
+    const gd::String &propertyName) {
+  if (!properties.Has(propertyName)) {
+    return "";
+  }
+
+  return GetPropertyValue(properties.Get(propertyName), configurationContent);
+}
+
+gd::String CustomConfigurationHelper::GetPropertyValue(
+    const gd::NamedPropertyDescriptor &property,
+    const gd::SerializerElement &configurationContent) {
+  const auto &propertyName = property.GetName();
+  if (!configurationContent.HasChild(propertyName)) {
+    // No value was serialized for this property: use the default value.
+    return property.GetValue();
+  }
+
+  const auto &propertyType = property.GetType();
+  const auto &element = configurationContent.GetChild(propertyName);
+  if (propertyType == "String" || propertyType == "Choice" ||
+      propertyType == "Color" || propertyType == "Behavior" ||
+      propertyType == "Resource") {
+    return element.GetStringValue();
+  } else if (propertyType == "Number") {
+    return gd::String::From(element.GetDoubleValue());
+  } else if (propertyType == "Boolean") {
+    return element.GetBoolValue() ? "true" : "false";
+  }
+  return property.GetValue();
+}
+
 bool CustomConfigurationHelper::UpdateProperty(
     const gd::PropertiesContainer &properties,
     gd::SerializerElement &configurationContent,
@@ -33,11 +33,27 @@ public:
       const gd::PropertiesContainer &properties,
       const gd::SerializerElement &behaviorContent);
 
+  /**
+   * \brief Return the value of a property, without building the descriptors
+   * of all the properties.
+   *
+   * \return the value, or an empty string if the property doesn't exist.
+   */
+  static gd::String GetPropertyValue(
+      const gd::PropertiesContainer &properties,
+      const gd::SerializerElement &behaviorContent,
+      const gd::String &name);
+
   static bool UpdateProperty(
       const gd::PropertiesContainer &properties,
       gd::SerializerElement &behaviorContent,
       const gd::String &name,
       const gd::String &value);
+
+private:
+  static gd::String GetPropertyValue(
+      const gd::NamedPropertyDescriptor &property,
+      const gd::SerializerElement &behaviorContent);
 };
 }  // namespace gd
 
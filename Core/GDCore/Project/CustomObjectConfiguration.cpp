@@ -115,6 +115,18 @@ std::map<gd::String, gd::PropertyDescriptor> CustomObjectConfiguration::GetPrope
     return gd::CustomConfigurationHelper::GetProperties(properties, objectContent);
 }
 
+gd::String CustomObjectConfiguration::GetPropertyValue(
+    const gd::String& propertyName) const {
+    if (!project->HasEventsBasedObject(GetType())) {
+      return "";
+    }
+    const auto &eventsBasedObject = project->GetEventsBasedObject(GetType());
+    const auto &properties = eventsBasedObject.GetPropertyDescriptors();
+
+    return gd::CustomConfigurationHelper::GetPropertyValue(
+        properties, objectContent, propertyName);
+}
+
 bool CustomObjectConfiguration::UpdateProperty(const gd::String& propertyName,
                                   const gd::String& newValue) {
     if (!project->HasEventsBasedObject(GetType())) {
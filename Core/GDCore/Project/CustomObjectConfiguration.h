@@ -56,6 +56,7 @@ class CustomObjectConfiguration : public gd::ObjectConfiguration {
   }
 
   std::map<gd::String, gd::PropertyDescriptor> GetProperties() const override;
+  gd::String GetPropertyValue(const gd::String& name) const override;
   bool UpdateProperty(const gd::String& name, const gd::String& value) override;
 
   std::map<gd::String, gd::PropertyDescriptor> GetInitialInstanceProperties(
@@ -23,9 +23,20 @@ const gd::ParameterMetadataContainer &EventsFunction::GetParametersForEvents(
     return parameters;
   }
   // For ActionWithOperator, the parameters are auto generated.
-  actionWithOperationParameters.ClearParameters();
+  GetParametersForEvents(functionsContainer, actionWithOperationParameters);
+  return actionWithOperationParameters;
+}
+
+void EventsFunction::GetParametersForEvents(
+    const gd::EventsFunctionsContainer &functionsContainer,
+    gd::ParameterMetadataContainer &parametersForEvents) const {
+  if (functionType != FunctionType::ActionWithOperator) {
+    parametersForEvents = parameters;
+    return;
+  }
+  parametersForEvents.ClearParameters();
   if (!functionsContainer.HasEventsFunctionNamed(getterName)) {
-    return actionWithOperationParameters;
+    return;
   }
   const auto &expression = functionsContainer.GetEventsFunction(getterName);
   const auto &expressionParameters = expression.parameters;
@@ -40,20 +51,16 @@ const gd::ParameterMetadataContainer &EventsFunction::GetParametersForEvents(
   for (size_t i = 0; i < expressionValueParameterIndex &&
                      i < expressionParameters.GetParametersCount();
        i++) {
-    actionWithOperationParameters.AddParameter(
-        expressionParameters.GetParameter(i));
+    parametersForEvents.AddParameter(expressionParameters.GetParameter(i));
   }
   gd::ParameterMetadata parameterMetadata;
   parameterMetadata.SetName("Value").SetValueTypeMetadata(
       expression.expressionType);
-  actionWithOperationParameters.AddParameter(parameterMetadata);
+  parametersForEvents.AddParameter(parameterMetadata);
   for (size_t i = expressionValueParameterIndex;
        i < expressionParameters.GetParametersCount(); i++) {
-    actionWithOperationParameters.AddParameter(
-        expressionParameters.GetParameter(i));
+    parametersForEvents.AddParameter(expressionParameters.GetParameter(i));
   }
-
-  return actionWithOperationParameters;
 }
 
 void EventsFunction::SerializeTo(SerializerElement& element) const {
@@ -243,6 +243,17 @@ class GD_CORE_API EventsFunction {
   const gd::ParameterMetadataContainer& GetParametersForEvents(
       const gd::EventsFunctionsContainer& functionsContainer) const;
 
+  /**
+   * \brief Copy the parameters of the function that are used in the events
+   * into parametersForEvents.
+   *
+   * Unlike the other version, nothing is stored in the function, so this can
+   * be called for the same function from several threads.
+   */
+  void GetParametersForEvents(
+      const gd::EventsFunctionsContainer& functionsContainer,
+      gd::ParameterMetadataContainer& parametersForEvents) const;
+
   /**
    * \brief Return the parameters of the function that are filled in the editor.
    * 
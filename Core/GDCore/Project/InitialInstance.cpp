@@ -39,8 +39,7 @@ InitialInstance::InitialInstance()
       depth(0),
       locked(false),
       sealed(false),
-      keepRatio(true),
-      persistentUuid(UUID::MakeUuid4()) {}
+      keepRatio(true) {}
 
 void InitialInstance::UnserializeFrom(const SerializerElement& element) {
   SetObjectName(element.GetStringAttribute("name", "", "nom"));
@@ -70,10 +69,10 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
   SetSealed(element.GetBoolAttribute("sealed", false));
   SetShouldKeepRatio(element.GetBoolAttribute("keepRatio", false));
 
-  persistentUuid = element.GetStringAttribute("persistentUuid");
-  if (persistentUuid.empty()) ResetPersistentUuid();
+  persistentUuid =
+      gd::Uuid::FromString(element.GetStringAttribute("persistentUuid"));
 
-  numberProperties.clear();
+  numberProperties.Reset();
   const SerializerElement& numberPropertiesElement =
       element.GetChild("numberProperties", 0, "floatInfos");
   numberPropertiesElement.ConsiderAsArrayOf("property", "Info");
@@ -96,11 +95,11 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
     }
     // end of compatibility code
     else {
-      numberProperties[name] = value;
+      numberProperties.Modify()[name] = value;
     }
   }
 
-  stringProperties.clear();
+  stringProperties.Reset();
   const SerializerElement& stringPropElement =
       element.GetChild("stringProperties", 0, "stringInfos");
   stringPropElement.ConsiderAsArrayOf("property", "Info");
@@ -108,11 +107,18 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
     gd::String name = stringPropElement.GetChild(j).GetStringAttribute("name");
     gd::String value =
         stringPropElement.GetChild(j).GetStringAttribute("value");
-    stringProperties[name] = value;
+    stringProperties.Modify()[name] = value;
   }
 
-  GetVariables().UnserializeFrom(
-      element.GetChild("initialVariables", 0, "InitialVariables"));
+  const SerializerElement& variablesElement =
+      element.GetChild("initialVariables", 0, "InitialVariables");
+  variablesElement.ConsiderAsArrayOf("variable", "Variable");
+  // Don't allocate variables for the (many) instances that have none.
+  if (initialVariables.IsEmpty() && variablesElement.GetChildrenCount() == 0 &&
+      !variablesElement.HasAttribute("persistentUuid"))
+    return;
+
+  initialVariables.Modify().UnserializeFrom(variablesElement);
 }
 
 void InitialInstance::SerializeTo(SerializerElement& element) const {
@@ -137,13 +143,13 @@ void InitialInstance::SerializeTo(SerializerElement& element) const {
   if (IsSealed()) element.SetAttribute("sealed", IsSealed());
   if (ShouldKeepRatio()) element.SetAttribute("keepRatio", ShouldKeepRatio());
 
-  if (persistentUuid.empty()) persistentUuid = UUID::MakeUuid4();
-  element.SetStringAttribute("persistentUuid", persistentUuid);
+  if (persistentUuid.IsEmpty()) persistentUuid = gd::Uuid::MakeUuid4();
+  element.SetStringAttribute("persistentUuid", persistentUuid.ToString());
 
   SerializerElement& numberPropertiesElement =
       element.AddChild("numberProperties");
   numberPropertiesElement.ConsiderAsArrayOf("property");
-  for (const auto& property : numberProperties) {
+  for (const auto& property : numberProperties.Get()) {
     numberPropertiesElement.AddChild("property")
         .SetAttribute("name", property.first)
         .SetAttribute("value", property.second);
@@ -151,7 +157,7 @@ void InitialInstance::SerializeTo(SerializerElement& element) const {
 
   SerializerElement& stringPropElement = element.AddChild("stringProperties");
   stringPropElement.ConsiderAsArrayOf("property");
-  for (const auto& property : stringProperties) {
+  for (const auto& property : stringProperties.Get()) {
     stringPropElement.AddChild("property")
         .SetAttribute("name", property.first)
         .SetAttribute("value", property.second);
@@ -161,7 +167,8 @@ void InitialInstance::SerializeTo(SerializerElement& element) const {
 }
 
 InitialInstance& InitialInstance::ResetPersistentUuid() {
-  persistentUuid = UUID::MakeUuid4();
+  // The new UUID is only generated when it's needed (see SerializeTo).
+  persistentUuid = gd::Uuid();
   return *this;
 }
 
@@ -201,26 +208,28 @@ bool InitialInstance::UpdateCustomProperty(
 }
 
 double InitialInstance::GetRawDoubleProperty(const gd::String& name) const {
-  const auto& it = numberProperties.find(name);
-  return it != numberProperties.end() ? it->second : 0;
+  const auto& properties = numberProperties.Get();
+  const auto& it = properties.find(name);
+  return it != properties.end() ? it->second : 0;
 }
 
 const gd::String& InitialInstance::GetRawStringProperty(
     const gd::String& name) const {
   if (!badStringPropertyValue) badStringPropertyValue = new gd::String("");
 
-  const auto& it = stringProperties.find(name);
-  return it != stringProperties.end() ? it->second : *badStringPropertyValue;
+  const auto& properties = stringProperties.Get();
+  const auto& it = properties.find(name);
+  return it != properties.end() ? it->second : *badStringPropertyValue;
 }
 
 void InitialInstance::SetRawDoubleProperty(const gd::String& name,
                                            double value) {
-  numberProperties[name] = value;
+  numberProperties.Modify()[name] = value;
 }
 
 void InitialInstance::SetRawStringProperty(const gd::String& name,
                                            const gd::String& value) {
-  stringProperties[name] = value;
+  stringProperties.Modify()[name] = value;
 }
 
 }  // namespace gd
@@ -10,6 +10,8 @@
 
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/CopyOnWrite.h"
+#include "GDCore/Tools/UUID/UUID.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -269,14 +271,18 @@ class GD_CORE_API InitialInstance {
    * \see gd::VariablesContainer
    */
   const gd::VariablesContainer& GetVariables() const {
-    return initialVariables;
+    return initialVariables.Get();
   }
 
   /**
    * Must return a reference to the container storing the instance variables
    * \see gd::VariablesContainer
+   *
+   * \note Instances share their variables with their copies until they are
+   * modified. Prefer the const version when only reading them, so that they
+   * are not copied.
    */
-  gd::VariablesContainer& GetVariables() { return initialVariables; }
+  gd::VariablesContainer& GetVariables() { return initialVariables.Expose(); }
   ///@}
 
   /** \name Others properties management
@@ -370,9 +376,11 @@ class GD_CORE_API InitialInstance {
  private:
   // More properties can be stored in numberProperties and stringProperties.
   // These properties are then managed by the Object class.
-  std::map<gd::String, double>
+  // They are shared with the copies of the instance until they are modified,
+  // as most instances don't have any.
+  gd::CopyOnWrite<std::map<gd::String, double>>
       numberProperties;  ///< More data which can be used by the object
-  std::map<gd::String, gd::String>
+  gd::CopyOnWrite<std::map<gd::String, gd::String>>
       stringProperties;  ///< More data which can be used by the object
 
   gd::String objectName;  ///< Object name
@@ -393,13 +401,16 @@ class GD_CORE_API InitialInstance {
   double width;           ///< Instance custom width
   double height;          ///< Instance custom height
   double depth;           ///< Instance custom depth
-  gd::VariablesContainer initialVariables;  ///< Instance specific variables
+  gd::CopyOnWrite<gd::VariablesContainer>
+      initialVariables;  ///< Instance specific variables, shared with the
+                         ///< copies of the instance until modified.
   bool locked;                              ///< True if the instance is locked
   bool sealed;                              ///< True if the instance is sealed
   bool keepRatio;                     ///< True if the instance's dimensions
                                       ///  should keep the same ratio.
-  mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
-                                      ///  useful for hot reloading.
+  mutable gd::Uuid persistentUuid;  ///< A persistent random version 4 UUID,
+                                    ///  useful for hot reloading. Generated
+                                    ///  when the instance is serialized.
 
   static gd::String* badStringPropertyValue;  ///< Empty string returned by
                                               ///< GetRawStringProperty
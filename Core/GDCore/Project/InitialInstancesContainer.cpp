@@ -113,6 +113,14 @@ void InitialInstancesContainer::RenameInstancesOfObject(
   }
 }
 
+void InitialInstancesContainer::RenameInstancesOfObjects(
+    const std::map<gd::String, gd::String>& oldToNewNames) {
+  for (gd::InitialInstance& instance : initialInstances) {
+    auto it = oldToNewNames.find(instance.GetObjectName());
+    if (it != oldToNewNames.end()) instance.SetObjectName(it->second);
+  }
+}
+
 void InitialInstancesContainer::RemoveInitialInstancesOfObject(
     const gd::String& objectName) {
   RemoveInstanceIf([&objectName](const InitialInstance& currentInstance) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -137,6 +138,13 @@ class GD_CORE_API InitialInstancesContainer {
   void RenameInstancesOfObject(const gd::String &oldName,
                                const gd::String &newName);
 
+  /**
+   * \brief Change the object names of the instances, for all the objects
+   * at once.
+   */
+  void RenameInstancesOfObjects(
+      const std::map<gd::String, gd::String> &oldToNewNames);
+
   /**
    * \brief Return the number of instances on the layer named \a layerName.
    */
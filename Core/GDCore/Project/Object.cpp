@@ -129,7 +129,8 @@ gd::Behavior* Object::AddNewBehavior(const gd::Project& project,
 
 void Object::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
-  persistentUuid = element.GetStringAttribute("persistentUuid");
+  persistentUuid =
+      gd::Uuid::FromString(element.GetStringAttribute("persistentUuid"));
 
   SetType(element.GetStringAttribute("type"));
   assetStoreId = element.GetStringAttribute("assetStoreId");
@@ -217,8 +218,8 @@ void Object::UnserializeFrom(gd::Project& project,
 }
 
 void Object::SerializeTo(SerializerElement& element) const {
-  if (!persistentUuid.empty())
-    element.SetStringAttribute("persistentUuid", persistentUuid);
+  if (!persistentUuid.IsEmpty())
+    element.SetStringAttribute("persistentUuid", persistentUuid.ToString());
 
   element.SetAttribute("name", GetName());
   element.SetAttribute("assetStoreId", GetAssetStoreId());
@@ -269,14 +270,14 @@ void Object::SerializeTo(SerializerElement& element) const {
 }
 
 Object& Object::ResetPersistentUuid() {
-  persistentUuid = UUID::MakeUuid4();
+  persistentUuid = gd::Uuid::MakeUuid4();
   objectVariables.ResetPersistentUuid();
 
   return *this;
 }
 
 Object& Object::ClearPersistentUuid() {
-  persistentUuid = "";
+  persistentUuid = gd::Uuid();
   objectVariables.ClearPersistentUuid();
 
   return *this;
@@ -259,8 +259,8 @@ class GD_CORE_API Object {
       objectVariables;  ///< List of the variables of the object
   gd::EffectsContainer
       effectsContainer;  ///< The effects container for the object.
-  mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
-                                      ///< useful for computing changesets.
+  gd::Uuid persistentUuid;  ///< A persistent random version 4 UUID,
+                            ///< useful for computing changesets.
 
   /**
    * Initialize object using another object. Used by copy-ctor and assign-op.
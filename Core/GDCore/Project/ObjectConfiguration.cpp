@@ -25,6 +25,12 @@ std::map<gd::String, gd::PropertyDescriptor> ObjectConfiguration::GetProperties(
   return nothing;
 }
 
+gd::String ObjectConfiguration::GetPropertyValue(const gd::String& name) const {
+  const auto properties = GetProperties();
+  const auto it = properties.find(name);
+  return it != properties.end() ? it->second.GetValue() : "";
+}
+
 std::map<gd::String, gd::PropertyDescriptor>
 ObjectConfiguration::GetInitialInstanceProperties(const gd::InitialInstance& instance) {
   std::map<gd::String, gd::PropertyDescriptor> nothing;
@@ -90,6 +90,18 @@ class GD_CORE_API ObjectConfiguration {
    */
   virtual std::map<gd::String, gd::PropertyDescriptor> GetProperties() const;
 
+  /**
+   * \brief Return the value of a custom property of the object
+   * configuration, without building the descriptors of all the properties
+   * when possible.
+   *
+   * By default, this looks for the property in GetProperties. Override it
+   * when the value can be read without building all the properties.
+   *
+   * \return the value, or an empty string if the property doesn't exist.
+   */
+  virtual gd::String GetPropertyValue(const gd::String& name) const;
+
   /**
    * \brief Called when the IDE wants to update a custom property of the object
    * configuration.
@@ -38,6 +38,14 @@ void ObjectGroup::RenameObject(const gd::String& oldName,
   }
 }
 
+void ObjectGroup::RenameObjects(
+    const std::map<gd::String, gd::String>& oldToNewNames) {
+  for (auto& object : memberObjects) {
+    auto it = oldToNewNames.find(object);
+    if (it != oldToNewNames.end()) object = it->second;
+  }
+}
+
 void ObjectGroup::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", GetName());
 
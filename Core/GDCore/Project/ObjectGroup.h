@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_OBJECTGROUP_H
 #define GDCORE_OBJECTGROUP_H
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -50,6 +51,11 @@ class GD_CORE_API ObjectGroup {
    */
   void RenameObject(const gd::String& oldName, const gd::String& newName);
 
+  /**
+   * \brief Change the names of the objects in the group, all at once.
+   */
+  void RenameObjects(const std::map<gd::String, gd::String>& oldToNewNames);
+
   /** \brief Get group name
    */
   inline const gd::String& GetName() const { return name; };
@@ -17,6 +17,7 @@ using namespace std;
 namespace gd {
 
 gd::Variable Variable::badVariable;
+const Variable::Children Variable::noChildren;
 
 gd::String Variable::TypeAsString(Type t) {
   switch (t) {
@@ -68,28 +69,33 @@ void Variable::CastTo(const Type newType) {
   else if (newType == Type::Boolean)
     SetBool(GetBool());
   else if (newType == Type::Structure) {
-    children.clear();
+    auto& allChildren = GetOrCreateChildren();
+    allChildren.structure.clear();
 
     // Conversion is only possible for non primitive types
     if (type == Type::Array)
-      for (auto i = childrenArray.begin(); i != childrenArray.end(); ++i)
-        children.insert(
-            std::make_pair(gd::String::From(i - childrenArray.begin()), (*i)));
+      for (auto i = allChildren.array.begin(); i != allChildren.array.end();
+           ++i)
+        allChildren.structure.insert(std::make_pair(
+            gd::String::From(i - allChildren.array.begin()), (*i)));
 
     type = Type::Structure;
     // Free now unused memory
-    childrenArray.clear();
+    allChildren.array.clear();
   } else if (newType == Type::Array) {
-    childrenArray.clear();
+    auto& allChildren = GetOrCreateChildren();
+    allChildren.array.clear();
 
     // Conversion is only possible for non primitive types
     if (type == Type::Structure)
-      for (auto i = children.begin(); i != children.end(); ++i)
-        childrenArray.push_back((*i).second);
+      for (auto i = allChildren.structure.begin();
+           i != allChildren.structure.end();
+           ++i)
+        allChildren.array.push_back((*i).second);
 
     type = Type::Array;
     // Free now unused memory
-    children.clear();
+    allChildren.structure.clear();
   } else if (newType == Type::MixedTypes) {
     type = Type::MixedTypes;
     hasMixedValues = true;
@@ -136,7 +142,8 @@ bool Variable::GetBool() const {
 }
 
 bool Variable::HasChild(const gd::String& name) const {
-  return type == Type::Structure && children.find(name) != children.end();
+  return type == Type::Structure && children &&
+         children->structure.find(name) != children->structure.end();
 }
 
 /**
@@ -146,13 +153,15 @@ bool Variable::HasChild(const gd::String& name) const {
  * the specified child, an empty variable is returned.
  */
 Variable& Variable::GetChild(const gd::String& name) {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  auto& structure = GetOrCreateChildren().structure;
+  auto it = structure.find(name);
+  if (it != structure.end()) return *it->second;
 
   type = Type::Structure;
   hasMixedValues = false;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  auto& child = structure[name];
+  child = std::make_shared<gd::Variable>();
+  return *child;
 }
 
 /**
@@ -162,17 +171,19 @@ Variable& Variable::GetChild(const gd::String& name) {
  * the specified child, an empty variable is returned.
  */
 const Variable& Variable::GetChild(const gd::String& name) const {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  auto& structure = GetOrCreateChildren().structure;
+  auto it = structure.find(name);
+  if (it != structure.end()) return *it->second;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  auto& child = structure[name];
+  child = std::make_shared<gd::Variable>();
+  return *child;
 }
 
 void Variable::RemoveChild(const gd::String& name) {
-  if (type != Type::Structure) return;
-  children.erase(name);
+  if (type != Type::Structure || !children) return;
+  children->structure.erase(name);
 }
 
 bool Variable::RenameChild(const gd::String& oldName,
@@ -180,31 +191,34 @@ bool Variable::RenameChild(const gd::String& oldName,
   if (type != Type::Structure || !HasChild(oldName) || HasChild(newName))
     return false;
 
-  children[newName] = children[oldName];
-  children.erase(oldName);
+  auto& structure = children->structure;
+  structure[newName] = structure[oldName];
+  structure.erase(oldName);
 
   return true;
 }
 
 Variable& Variable::GetAtIndex(const size_t index) {
   type = Type::Array;
-  while (childrenArray.size() <= index)
-    childrenArray.push_back(std::make_shared<gd::Variable>());
-  return *childrenArray[index];
+  auto& array = GetOrCreateChildren().array;
+  while (array.size() <= index)
+    array.push_back(std::make_shared<gd::Variable>());
+  return *array[index];
 };
 
 const Variable& Variable::GetAtIndex(const size_t index) const {
-  if (childrenArray.size() <= index) return badVariable;
-  return *childrenArray.at(index);
+  if (!children || children->array.size() <= index) return badVariable;
+  return *children->array.at(index);
 };
 
 void Variable::MoveChildInArray(const size_t oldIndex, const size_t newIndex) {
-  if (oldIndex >= childrenArray.size() || newIndex >= childrenArray.size())
-    return;
+  if (!children) return;
+  auto& array = children->array;
+  if (oldIndex >= array.size() || newIndex >= array.size()) return;
 
-  std::shared_ptr<gd::Variable> object = std::move(childrenArray[oldIndex]);
-  childrenArray.erase(childrenArray.begin() + oldIndex);
-  childrenArray.insert(childrenArray.begin() + newIndex, std::move(object));
+  std::shared_ptr<gd::Variable> object = std::move(array[oldIndex]);
+  array.erase(array.begin() + oldIndex);
+  array.insert(array.begin() + newIndex, std::move(object));
 }
 
 Variable& Variable::PushNew() {
@@ -228,18 +242,19 @@ Variable& Variable::PushNew() {
 };
 
 void Variable::RemoveAtIndex(const size_t index) {
-  if (index >= childrenArray.size()) return;
-  childrenArray.erase(childrenArray.begin() + index);
+  if (!children || index >= children->array.size()) return;
+  children->array.erase(children->array.begin() + index);
 };
 
 bool Variable::InsertAtIndex(const gd::Variable& variable, const size_t index) {
   if (type != Type::Array) return false;
   hasMixedValues = false;
   auto newVariable = std::make_shared<gd::Variable>(variable);
-  if (index < childrenArray.size()) {
-    childrenArray.insert(childrenArray.begin() + index, newVariable);
+  auto& array = GetOrCreateChildren().array;
+  if (index < array.size()) {
+    array.insert(array.begin() + index, newVariable);
   } else {
-    childrenArray.push_back(newVariable);
+    array.push_back(newVariable);
   }
   return true;
 };
@@ -250,7 +265,8 @@ bool Variable::InsertChild(const gd::String& name,
     return false;
   }
   hasMixedValues = false;
-  children[name] = std::make_shared<gd::Variable>(variable);
+  GetOrCreateChildren().structure[name] =
+      std::make_shared<gd::Variable>(variable);
   return true;
 };
 
@@ -258,8 +274,8 @@ void Variable::SerializeTo(SerializerElement& element) const {
   element.SetStringAttribute("type", TypeAsString(GetType()));
   if (IsFolded()) element.SetBoolAttribute("folded", true);
 
-  if (!persistentUuid.empty())
-    element.SetStringAttribute("persistentUuid", persistentUuid);
+  if (!persistentUuid.IsEmpty())
+    element.SetStringAttribute("persistentUuid", persistentUuid.ToString());
 
   if (type == Type::String) {
     element.SetStringAttribute("value", GetString());
@@ -270,15 +286,15 @@ void Variable::SerializeTo(SerializerElement& element) const {
   } else if (type == Type::Structure) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto i = children.begin(); i != children.end(); ++i) {
+    for (auto& it : GetAllChildren()) {
       SerializerElement& variableElement = childrenElement.AddChild("variable");
-      variableElement.SetAttribute("name", i->first);
-      i->second->SerializeTo(variableElement);
+      variableElement.SetAttribute("name", it.first);
+      it.second->SerializeTo(variableElement);
     }
   } else if (type == Type::Array) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto child : childrenArray) {
+    for (auto& child : GetAllChildrenArray()) {
       child->SerializeTo(childrenElement.AddChild("variable"));
     }
   }
@@ -290,7 +306,8 @@ void Variable::SerializeTo(SerializerElement& element) const {
 void Variable::UnserializeFrom(const SerializerElement& element) {
   type = StringAsType(element.GetStringAttribute("type", "string"));
 
-  persistentUuid = element.GetStringAttribute("persistentUuid");
+  persistentUuid =
+      gd::Uuid::FromString(element.GetStringAttribute("persistentUuid"));
 
   // Compatibility with GD <= 5.0.0-beta102
   // Before, everything was stored as strings.
@@ -322,8 +339,9 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
       const SerializerElement& childElement = childrenElement.GetChild(i);
       if (type == Type::Structure) {
         gd::String name = childElement.GetStringAttribute("name", "", "Name");
-        children[name] = std::make_shared<gd::Variable>();
-        children[name]->UnserializeFrom(childElement);
+        auto& child = GetOrCreateChildren().structure[name];
+        child = std::make_shared<gd::Variable>();
+        child->UnserializeFrom(childElement);
       } else if (type == Type::Array)
         PushNew().UnserializeFrom(childElement);
     }
@@ -334,22 +352,22 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
 }
 
 Variable& Variable::ResetPersistentUuid() {
-  persistentUuid = UUID::MakeUuid4();
-  for (auto& it : children) {
+  persistentUuid = gd::Uuid::MakeUuid4();
+  for (auto& it : GetAllChildren()) {
     it.second->ResetPersistentUuid();
   }
-  for (auto& it : childrenArray) {
+  for (auto& it : GetAllChildrenArray()) {
     it->ResetPersistentUuid();
   }
   return *this;
 }
 
 Variable& Variable::ClearPersistentUuid() {
-  persistentUuid = "";
-  for (auto& it : children) {
+  persistentUuid = gd::Uuid();
+  for (auto& it : GetAllChildren()) {
     it.second->ClearPersistentUuid();
   }
-  for (auto& it : childrenArray) {
+  for (auto& it : GetAllChildrenArray()) {
     it->ClearPersistentUuid();
   }
   return *this;
@@ -357,7 +375,7 @@ Variable& Variable::ClearPersistentUuid() {
 
 std::vector<gd::String> Variable::GetAllChildrenNames() const {
   std::vector<gd::String> names;
-  for (auto& it : children) {
+  for (auto& it : GetAllChildren()) {
     names.push_back(it.first);
   }
 
@@ -366,11 +384,11 @@ std::vector<gd::String> Variable::GetAllChildrenNames() const {
 
 bool Variable::Contains(const gd::Variable& variableToSearch,
                         bool recursive) const {
-  for (auto& it : children) {
+  for (auto& it : GetAllChildren()) {
     if (it.second.get() == &variableToSearch) return true;
     if (recursive && it.second->Contains(variableToSearch, true)) return true;
   }
-  for (auto& it : childrenArray) {
+  for (auto& it : GetAllChildrenArray()) {
     if (it.get() == &variableToSearch) return true;
     if (recursive && it->Contains(variableToSearch, true)) return true;
   }
@@ -379,17 +397,21 @@ bool Variable::Contains(const gd::Variable& variableToSearch,
 }
 
 void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
-  for (auto it = children.begin(); it != children.end();) {
+  if (!children) return;
+
+  auto& structure = children->structure;
+  for (auto it = structure.begin(); it != structure.end();) {
     if (it->second.get() == &variableToRemove)
-      it = children.erase(it);
+      it = structure.erase(it);
     else {
       it->second->RemoveRecursively(variableToRemove);
       it++;
     }
   }
-  for (auto it = childrenArray.begin(); it != childrenArray.end();)
+  auto& array = children->array;
+  for (auto it = array.begin(); it != array.end();)
     if (it->get() == &variableToRemove)
-      childrenArray.erase(it);
+      it = array.erase(it);
     else {
       (*it)->RemoveRecursively(variableToRemove);
       it++;
@@ -397,13 +419,13 @@ void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
 }
 
 Variable::Variable(const Variable& other)
-    : value(other.value),
-      str(other.str),
+    : type(other.type),
       folded(other.folded),
       boolVal(other.boolVal),
-      type(other.type),
-      persistentUuid(other.persistentUuid),
-      hasMixedValues(other.hasMixedValues) {
+      hasMixedValues(other.hasMixedValues),
+      value(other.value),
+      str(other.str),
+      persistentUuid(other.persistentUuid) {
   CopyChildren(other);
 }
 
@@ -423,12 +445,17 @@ Variable& Variable::operator=(const Variable& other) {
 }
 
 void Variable::CopyChildren(const gd::Variable& other) {
-  children.clear();
-  for (auto& it : other.children) {
-    children[it.first] = std::make_shared<gd::Variable>(*it.second);
+  if (!other.children) {
+    children.reset();
+    return;
+  }
+
+  children.reset(new Children());
+  for (auto& it : other.children->structure) {
+    children->structure[it.first] = std::make_shared<gd::Variable>(*it.second);
   }
-  for (auto child : other.childrenArray) {
-    childrenArray.push_back(std::make_shared<gd::Variable>(*child.get()));
+  for (auto& child : other.children->array) {
+    children->array.push_back(std::make_shared<gd::Variable>(*child.get()));
   }
 }
 
@@ -446,15 +473,17 @@ bool Variable::operator==(const gd::Variable &variable) const {
     return boolVal == variable.boolVal;
   }
   if (type == Variable::Type::Structure) {
-    if (children.size() != variable.children.size()) {
+    const auto &structure = GetAllChildren();
+    const auto &otherStructure = variable.GetAllChildren();
+    if (structure.size() != otherStructure.size()) {
       return false;
     }
-    for (auto &pair : children) {
+    for (auto &pair : structure) {
       const gd::String &name = pair.first;
       const auto &child = pair.second;
 
-      auto it = variable.children.find(name);
-      if (it == variable.children.end()) {
+      auto it = otherStructure.find(name);
+      if (it == otherStructure.end()) {
         return false;
       }
       auto &otherChild = it->second;
@@ -465,11 +494,13 @@ bool Variable::operator==(const gd::Variable &variable) const {
     return true;
   }
   if (type == Variable::Type::Array) {
-    if (childrenArray.size() != variable.childrenArray.size()) {
+    const auto &array = GetAllChildrenArray();
+    const auto &otherArray = variable.GetAllChildrenArray();
+    if (array.size() != otherArray.size()) {
       return false;
     }
-    for (int i = 0; i < childrenArray.size(); ++i) {
-      if (*childrenArray[i] != *variable.childrenArray[i]) {
+    for (int i = 0; i < array.size(); ++i) {
+      if (*array[i] != *otherArray[i]) {
         return false;
       }
     }
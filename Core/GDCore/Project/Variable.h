@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/UUID/UUID.h"
 namespace gd {
 class SerializerElement;
 }
@@ -52,7 +53,7 @@ class GD_CORE_API Variable {
   /**
    * \brief Default constructor creating a variable with 0 as value.
    */
-  Variable() : value(0), type(Type::Number), hasMixedValues(false) {};
+  Variable() : type(Type::Number), hasMixedValues(false), value(0) {};
   Variable(const Variable&);
   virtual ~Variable(){};
 
@@ -200,17 +201,16 @@ class GD_CORE_API Variable {
   /**
    * \brief Remove all the children.
    */
-  void ClearChildren() {
-    children.clear();
-    childrenArray.clear();
-  };
+  void ClearChildren() { children.reset(); };
 
   /**
    * \brief Get the count of children that the variable has.
    */
   size_t GetChildrenCount() const {
-    return type == Type::Structure ? children.size()
-           : type == Type::Array   ? childrenArray.size()
+    if (!children) return 0;
+
+    return type == Type::Structure ? children->structure.size()
+           : type == Type::Array   ? children->array.size()
                                    : 0;
   };
 
@@ -267,7 +267,7 @@ class GD_CORE_API Variable {
    */
   const std::map<gd::String, std::shared_ptr<Variable>>& GetAllChildren()
       const {
-    return children;
+    return children ? children->structure : noChildren.structure;
   }
 
   /**
@@ -333,7 +333,7 @@ class GD_CORE_API Variable {
    * \brief Get the vector containing all the children.
    */
   const std::vector<std::shared_ptr<Variable>>& GetAllChildrenArray() const {
-    return childrenArray;
+    return children ? children->array : noChildren.array;
   }
 
   /**
@@ -379,7 +379,7 @@ class GD_CORE_API Variable {
    * \brief Get the persistent UUID used to recognize
    * the same variable between serialization.
    */
-  const gd::String& GetPersistentUuid() const { return persistentUuid; };
+  const gd::Uuid& GetPersistentUuid() const { return persistentUuid; };
   ///@}
 
  private:
@@ -393,19 +393,39 @@ class GD_CORE_API Variable {
    */
   static Type StringAsType(const gd::String& str);
 
-  bool folded = false;
+  /**
+   * \brief The children of a variable, only allocated for variables that are
+   * (or were) a structure or an array, so that primitive variables stay small.
+   */
+  struct Children {
+    std::map<gd::String, std::shared_ptr<Variable>>
+        structure;  ///< Children, when the variable is considered as a
+                    ///< structure.
+    std::vector<std::shared_ptr<Variable>>
+        array;  ///< Children, when the variable is considered as an array.
+  };
+
+  /**
+   * \brief Return the children, allocating them if needed.
+   */
+  Children& GetOrCreateChildren() const {
+    if (!children) children.reset(new Children());
+    return *children;
+  }
+
+  static const Children noChildren;  ///< Returned when there are no children.
+
+  // Members are ordered from the smallest to avoid padding.
   mutable Type type;
+  bool folded = false;
+  bool boolVal = false;
+  bool hasMixedValues;
+  double value;
   mutable gd::String str;
-  mutable double value;
-  mutable bool boolVal = false;
-  mutable bool hasMixedValues;
-  mutable std::map<gd::String, std::shared_ptr<Variable>>
-      children;  ///< Children, when the variable is considered as a structure.
-  mutable std::vector<std::shared_ptr<Variable>>
-      childrenArray;  ///< Children, when the variable is considered as an
-                      ///< array.
-  mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
-                                      ///< useful for computing changesets.
+  mutable std::unique_ptr<Children>
+      children;  ///< Null until the variable has children.
+  gd::Uuid persistentUuid;  ///< A persistent random version 4 UUID,
+                            ///< useful for computing changesets.
 
   /**
    * Initialize children by copying them from another variable.  Used by
@@ -178,8 +178,8 @@ void VariablesContainer::ForEachVariableMatchingSearch(
 }
 
 void VariablesContainer::SerializeTo(SerializerElement& element) const {
-  if (!persistentUuid.empty())
-    element.SetStringAttribute("persistentUuid", persistentUuid);
+  if (!persistentUuid.IsEmpty())
+    element.SetStringAttribute("persistentUuid", persistentUuid.ToString());
 
   element.ConsiderAsArrayOf("variable");
   for (std::size_t j = 0; j < variables.size(); j++) {
@@ -190,7 +190,8 @@ void VariablesContainer::SerializeTo(SerializerElement& element) const {
 }
 
 void VariablesContainer::UnserializeFrom(const SerializerElement& element) {
-  persistentUuid = element.GetStringAttribute("persistentUuid");
+  persistentUuid =
+      gd::Uuid::FromString(element.GetStringAttribute("persistentUuid"));
 
   Clear();
   element.ConsiderAsArrayOf("variable", "Variable");
@@ -205,7 +206,7 @@ void VariablesContainer::UnserializeFrom(const SerializerElement& element) {
 }
 
 VariablesContainer& VariablesContainer::ResetPersistentUuid() {
-  persistentUuid = UUID::MakeUuid4();
+  persistentUuid = gd::Uuid::MakeUuid4();
   for (auto& variable : variables) {
     variable.second->ResetPersistentUuid();
   }
@@ -214,7 +215,7 @@ VariablesContainer& VariablesContainer::ResetPersistentUuid() {
 }
 
 VariablesContainer& VariablesContainer::ClearPersistentUuid() {
-  persistentUuid = "";
+  persistentUuid = gd::Uuid();
   for (auto& variable : variables) {
     variable.second->ClearPersistentUuid();
   }
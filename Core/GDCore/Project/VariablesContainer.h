@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/UUID/UUID.h"
 namespace gd {
 class SerializerElement;
 }
@@ -183,14 +184,14 @@ class GD_CORE_API VariablesContainer {
    * \brief Get the persistent UUID used to recognize
    * the same variables between serialization.
    */
-  const gd::String& GetPersistentUuid() const { return persistentUuid; };
+  const gd::Uuid& GetPersistentUuid() const { return persistentUuid; };
   ///@}
 
  private:
   SourceType sourceType = Unknown;
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
-  mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
-                                      ///< useful for computing changesets.
+  gd::Uuid persistentUuid;  ///< A persistent random version 4 UUID,
+                            ///< useful for computing changesets.
   static gd::Variable badVariable;
   static gd::String badName;
 
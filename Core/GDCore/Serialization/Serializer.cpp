@@ -14,6 +14,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Tracing.h"
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
@@ -114,6 +115,7 @@ void ElementToRapidJson(const gd::SerializerElement& element,
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
+  gd::TraceScope traceScope("Serialization", "FromJSON");
   SerializerElement element;
   size_t len = strlen(json);
   if (len != 0) {
@@ -135,6 +137,7 @@ SerializerElement Serializer::FromJSON(const char* json) {
 }
 
 gd::String Serializer::ToJSON(const SerializerElement& element) {
+  gd::TraceScope traceScope("Serialization", "ToJSON");
   Document document;
   Document::AllocatorType& allocator = document.GetAllocator();
 
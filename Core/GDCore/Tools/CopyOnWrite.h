@@ -0,0 +1,102 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+
+namespace gd {
+
+/**
+ * \brief Hold a value that is shared by the copies of its owner, and only
+ * copied when one of them modifies it.
+ *
+ * The value is allocated when it's first modified: until then, it costs a
+ * null pointer and reading it gives an empty (default constructed) value.
+ *
+ * A reference to the value can be handed out to be modified later (see
+ * Expose): the value is then never shared again, so that modifying it can't
+ * change the copies.
+ *
+ * \ingroup Tools
+ */
+template <class T>
+class CopyOnWrite {
+ public:
+  CopyOnWrite() : exposed(false){};
+  CopyOnWrite(const CopyOnWrite<T>& other) : exposed(false) {
+    ShareOrCopy(other);
+  };
+  CopyOnWrite<T>& operator=(const CopyOnWrite<T>& other) {
+    if (this != &other) {
+      exposed = false;
+      ShareOrCopy(other);
+    }
+    return *this;
+  };
+
+  /**
+   * \brief Return the value, or an empty value if it was never modified.
+   */
+  const T& Get() const { return value ? *value : GetEmptyValue(); };
+
+  /**
+   * \brief Return true if the value was never modified.
+   */
+  bool IsEmpty() const { return !value; };
+
+  /**
+   * \brief Return the value to modify it, after copying it if it's shared.
+   *
+   * \warning The returned reference must not be kept once the owner is
+   * copied: use Expose for this.
+   */
+  T& Modify() {
+    if (!value)
+      value = std::make_shared<T>();
+    else if (value.use_count() > 1)
+      value = std::make_shared<T>(*value);
+
+    return *value;
+  };
+
+  /**
+   * \brief Return the value to modify it, even later: it won't be shared
+   * with the copies of its owner anymore.
+   */
+  T& Expose() {
+    T& exposedValue = Modify();
+    exposed = true;
+    return exposedValue;
+  };
+
+  /**
+   * \brief Go back to an empty value.
+   *
+   * \warning References returned by Expose are no longer valid.
+   */
+  void Reset() {
+    value.reset();
+    exposed = false;
+  };
+
+ private:
+  void ShareOrCopy(const CopyOnWrite<T>& other) {
+    if (other.exposed && other.value)
+      value = std::make_shared<T>(*other.value);
+    else
+      value = other.value;
+  };
+
+  static const T& GetEmptyValue() {
+    static const T emptyValue{};
+    return emptyValue;
+  };
+
+  std::shared_ptr<T> value;  ///< Null until the value is modified.
+  bool exposed;  ///< True if a reference to modify the value was handed out.
+};
+
+}  // namespace gd
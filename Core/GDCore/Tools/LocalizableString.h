@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/String.h"
+#include "GDCore/Tools/Localization.h"
+
+namespace gd {
+
+/**
+ * \brief A text to be translated, that is only translated when it's read.
+ *
+ * Unlike the underscore macro, which translates the text as soon as it's
+ * evaluated, this only stores the untranslated literal. This is useful for
+ * texts that are often created but rarely displayed, like the messages of
+ * errors: with Emscripten, each translation is a call to JavaScript.
+ *
+ * Use the GD_T macro to create one, so that the text is extracted for
+ * translation: `gd::LocalizableString message = GD_T("Hello World");`
+ *
+ * \see gd::GetTranslation
+ * \ingroup Tools
+ */
+class GD_CORE_API LocalizableString {
+ public:
+  LocalizableString() : source(""){};
+
+  /**
+   * \param source_ The untranslated text. It must be a string literal (or
+   * live as long as the program).
+   */
+  explicit LocalizableString(const char *source_) : source(source_){};
+
+  /**
+   * \brief Return the untranslated text.
+   */
+  const char *GetSource() const { return source; }
+
+  /**
+   * \brief Return true if the text is empty.
+   */
+  bool IsEmpty() const { return source[0] == '\0'; }
+
+  /**
+   * \brief Return the text, translated in the current language.
+   */
+  gd::String GetTranslation() const {
+#if defined(EMSCRIPTEN)
+    return gd::GetTranslation(source);
+#else
+    return gd::String(source);
+#endif
+  }
+
+ private:
+  const char *source;
+};
+
+}  // namespace gd
+
+/**
+ * \brief Mark a text to be translated, returning a gd::LocalizableString that
+ * is only translated when it's read.
+ */
+#define GD_T(s) gd::LocalizableString(u8##s)
@@ -6,10 +6,30 @@
 
 #if defined(EMSCRIPTEN)
 #include <emscripten.h>
+
+#include <unordered_map>
+
 #include "GDCore/String.h"
+#include "GDCore/Tools/Localization.h"
+
+namespace {
+/**
+ * The translations already done, indexed by the address of the untranslated
+ * literal: each text is only translated (i.e: JavaScript is only called) once
+ * per language.
+ */
+std::unordered_map<const char*, gd::String> translationsCache;
+std::size_t translationRequestsCount = 0;
+std::size_t translationCallsCount = 0;
+}  // namespace
 
 namespace gd {
-gd::String GetTranslation(const char* str) {  // TODO: Inline?
+gd::String GetTranslation(const char* str) {
+  translationRequestsCount++;
+  auto it = translationsCache.find(str);
+  if (it != translationsCache.end()) return it->second;
+
+  translationCallsCount++;
   const char* translatedStr = (const char*)EM_ASM_INT(
       {
         var getTranslation = Module['getTranslation'];
@@ -29,7 +49,14 @@ gd::String GetTranslation(const char* str) {  // TODO: Inline?
         return ensureString(translatedStr);
       },
       str);
-  return gd::String(translatedStr);  // TODO: Is copying necessary?
+  return translationsCache.emplace(str, gd::String(translatedStr))
+      .first->second;
 }
+
+void ClearTranslationsCache() { translationsCache.clear(); }
+
+std::size_t GetTranslationRequestsCount() { return translationRequestsCount; }
+
+std::size_t GetTranslationCallsCount() { return translationCallsCount; }
 }  // namespace gd
 #endif
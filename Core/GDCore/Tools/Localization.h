@@ -26,8 +26,33 @@
 #endif
 
 namespace gd {
+/**
+ * \brief Return the translation of a string literal.
+ *
+ * Translations are cached (by address of the literal), so JavaScript is only
+ * called once for each literal. Call ClearTranslationsCache when the language
+ * (i.e: `Module.getTranslation`) is changed.
+ */
 gd::String GetTranslation(const char* str);
-}
+
+/**
+ * \brief Forget all the translations done, so that literals are translated
+ * again in the new language.
+ */
+void ClearTranslationsCache();
+
+/**
+ * \brief Return the number of translations requested (with or without calling
+ * JavaScript) since the start.
+ */
+std::size_t GetTranslationRequestsCount();
+
+/**
+ * \brief Return the number of calls to JavaScript made to translate a string
+ * since the start.
+ */
+std::size_t GetTranslationCallsCount();
+}  // namespace gd
 
 #define _(s) gd::GetTranslation(u8##s)
 
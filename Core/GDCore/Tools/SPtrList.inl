@@ -89,6 +89,7 @@ SPtrList<T>& SPtrList<T>::operator=(const SPtrList<T>& other) {
 template <typename T>
 void SPtrList<T>::Init(const gd::SPtrList<T>& other) {
   elements.clear();
+  elements.reserve(other.elements.size());
   for (size_t i = 0; i < other.elements.size(); ++i)
     elements.push_back(CloneRememberingOriginalElement(other.elements[i]));
 }
@@ -0,0 +1,69 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/StringTemplate.h"
+
+namespace gd {
+
+StringTemplate::StringTemplate(const gd::String &text,
+                               const std::vector<gd::String> &placeholders) {
+  const std::string &rawText = text.Raw();
+
+  std::string literal;
+  std::size_t position = 0;
+  while (position < rawText.size()) {
+    std::size_t matchedPlaceholderIndex = placeholders.size();
+    std::size_t matchedPlaceholderSize = 0;
+    for (std::size_t i = 0; i < placeholders.size(); ++i) {
+      const std::string &placeholder = placeholders[i].Raw();
+      if (placeholder.size() > matchedPlaceholderSize &&
+          rawText.compare(position, placeholder.size(), placeholder) == 0) {
+        matchedPlaceholderIndex = i;
+        matchedPlaceholderSize = placeholder.size();
+      }
+    }
+
+    if (matchedPlaceholderIndex == placeholders.size()) {
+      literal += rawText[position];
+      position++;
+    } else {
+      segments.push_back({std::move(literal), matchedPlaceholderIndex});
+      literal.clear();
+      position += matchedPlaceholderSize;
+    }
+  }
+  segments.push_back({std::move(literal), placeholders.size()});
+}
+
+gd::String StringTemplate::Render(const std::vector<gd::String> &values) const {
+  gd::String output;
+  RenderTo(output, values);
+  return output;
+}
+
+void StringTemplate::RenderTo(gd::String &output,
+                              const std::vector<gd::String> &values) const {
+  std::string &rawOutput = output.Raw();
+
+  // Only reserve for a new output: reserving when appending to an output
+  // several times would not let it grow geometrically.
+  if (rawOutput.empty()) {
+    std::size_t size = 0;
+    for (const auto &segment : segments) {
+      size += segment.literal.size();
+      if (segment.valueIndex < values.size())
+        size += values[segment.valueIndex].Raw().size();
+    }
+    rawOutput.reserve(size);
+  }
+
+  for (const auto &segment : segments) {
+    rawOutput += segment.literal;
+    if (segment.valueIndex < values.size())
+      rawOutput += values[segment.valueIndex].Raw();
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A text with placeholders, parsed once, that can be rendered with
+ * different values in a single pass.
+ *
+ * This replaces chains of gd::String::FindAndReplace, which copy and search
+ * the whole text for each placeholder. Templates are meant to be stored in
+ * static variables, so that they are parsed only once:
+ * \code
+ * static const gd::StringTemplate getterTemplate(
+ *     "GETTER_NAME() { return this.PROPERTY_NAME; }",
+ *     {"GETTER_NAME", "PROPERTY_NAME"});
+ * gd::String code = getterTemplate.Render({getterName, propertyName});
+ * \endcode
+ *
+ * When several placeholders start at the same position, the longest one is
+ * used (so that "SHARED_PROPERTIES_CODE" is not read as "SHARED_" followed by
+ * "PROPERTIES_CODE"). Values are inserted as is: placeholders in them are not
+ * replaced.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API StringTemplate {
+ public:
+  /**
+   * \param text The text of the template.
+   * \param placeholders The names of the placeholders. Their order is the
+   * order of the values given to Render.
+   */
+  StringTemplate(const gd::String &text,
+                 const std::vector<gd::String> &placeholders);
+
+  /**
+   * \brief Return the text with the placeholders replaced by the values.
+   *
+   * \param values The values, in the order of the placeholders given to the
+   * constructor.
+   */
+  gd::String Render(const std::vector<gd::String> &values) const;
+
+  /**
+   * \brief Append the text, with the placeholders replaced by the values, to
+   * the output.
+   */
+  void RenderTo(gd::String &output,
+                const std::vector<gd::String> &values) const;
+
+  /**
+   * \brief Return the number of placeholders in the text (a placeholder used
+   * twice is counted twice).
+   */
+  std::size_t GetPlaceholdersCount() const { return segments.size() - 1; }
+
+ private:
+  /**
+   * \brief A part of the text followed by a placeholder (except for the last
+   * one).
+   */
+  struct Segment {
+    std::string literal;
+    std::size_t valueIndex;
+  };
+
+  std::vector<Segment> segments;  ///< Never empty: the last segment is the
+                                  ///< end of the text.
+};
+
+}  // namespace gd
@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ThreadPool.h"
+
+#include <utility>
+
+namespace gd {
+
+ThreadPool::ThreadPool(std::size_t threadsCount)
+    : runningTasksCount(0), stopping(false) {
+#if !defined(EMSCRIPTEN)
+  for (std::size_t i = 0; i < threadsCount; ++i)
+    workers.emplace_back(&ThreadPool::WorkerLoop, this);
+#endif
+}
+
+ThreadPool::~ThreadPool() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  taskAvailable.notify_all();
+  for (auto& worker : workers) worker.join();
+}
+
+void ThreadPool::Push(std::function<void()> task) {
+  if (workers.empty()) {
+    try {
+      task();
+    } catch (...) {
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+  taskAvailable.notify_one();
+}
+
+void ThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  allTasksDone.wait(
+      lock, [this] { return tasks.empty() && runningTasksCount == 0; });
+}
+
+std::size_t ThreadPool::GetDefaultThreadsCount() {
+#if defined(EMSCRIPTEN)
+  return 0;
+#else
+  unsigned int hardwareThreadsCount = std::thread::hardware_concurrency();
+  return hardwareThreadsCount == 0 ? 1 : hardwareThreadsCount;
+#endif
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+      if (tasks.empty()) return;  // Stopping and nothing left to do.
+
+      task = std::move(tasks.front());
+      tasks.pop_front();
+      runningTasksCount++;
+    }
+
+    try {
+      task();
+    } catch (...) {
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      runningTasksCount--;
+      if (tasks.empty() && runningTasksCount == 0) allTasksDone.notify_all();
+    }
+  }
+}
+
+}  // namespace gd
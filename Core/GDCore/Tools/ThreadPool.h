@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A bounded pool of worker threads running tasks in the background.
+ *
+ * Tasks are run in the order they are pushed, by the first available worker.
+ * A pool created with no threads (or any pool on platforms without threads
+ * support, like Emscripten) runs each task synchronously when it's pushed,
+ * so that callers don't have to handle this case.
+ *
+ * \note Tasks should not throw: an exception escaping a task is swallowed.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ThreadPool {
+ public:
+  /**
+   * \brief Create a pool with the specified number of worker threads.
+   */
+  explicit ThreadPool(std::size_t threadsCount = GetDefaultThreadsCount());
+
+  /**
+   * \brief Wait for all the pushed tasks to be finished and stop the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * \brief Add a task to be run by a worker.
+   */
+  void Push(std::function<void()> task);
+
+  /**
+   * \brief Block until all the tasks pushed so far are finished.
+   */
+  void Wait();
+
+  /**
+   * \brief Return the number of worker threads (0 if tasks are run
+   * synchronously).
+   */
+  std::size_t GetThreadsCount() const { return workers.size(); }
+
+  /**
+   * \brief Return the number of threads to use by default, based on the
+   * hardware concurrency (0 on platforms without threads support).
+   */
+  static std::size_t GetDefaultThreadsCount();
+
+ private:
+  void WorkerLoop();
+
+  std::vector<std::thread> workers;
+  std::deque<std::function<void()>> tasks;
+  std::size_t runningTasksCount;
+  bool stopping;
+  std::mutex mutex;
+  std::condition_variable taskAvailable;
+  std::condition_variable allTasksDone;
+};
+
+}  // namespace gd
@@ -0,0 +1,130 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Tracing.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+#if !defined(EMSCRIPTEN)
+#include <thread>
+#endif
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+std::atomic<bool> Tracing::enabled(false);
+
+namespace {
+
+/**
+ * The state shared by all threads recording spans, protected by the mutex.
+ */
+struct TracingState {
+  TracingState() : receiver(nullptr){};
+
+  std::mutex mutex;
+  std::vector<gd::TraceEvent> events;
+  gd::TraceEventsReceiver *receiver;
+#if !defined(EMSCRIPTEN)
+  std::map<std::thread::id, std::size_t> threadIds;
+#endif
+};
+
+TracingState &GetTracingState() {
+  static TracingState state;
+  return state;
+}
+
+}  // namespace
+
+void Tracing::Enable() { enabled.store(true, std::memory_order_relaxed); }
+
+void Tracing::Disable() { enabled.store(false, std::memory_order_relaxed); }
+
+void Tracing::SetReceiver(gd::TraceEventsReceiver *receiver) {
+  TracingState &state = GetTracingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.receiver = receiver;
+}
+
+std::size_t Tracing::GetEventsCount() {
+  TracingState &state = GetTracingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.events.size();
+}
+
+void Tracing::Clear() {
+  TracingState &state = GetTracingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.events.clear();
+}
+
+double Tracing::GetTimeNow() {
+  static const auto origin = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - origin)
+      .count();
+}
+
+void Tracing::Record(const char *category,
+                     const char *name,
+                     const gd::String &detail,
+                     double startTime,
+                     double duration) {
+  TracingState &state = GetTracingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::size_t threadId = 0;
+#if !defined(EMSCRIPTEN)
+  // Give small, stable ids to threads so that traces are easy to read.
+  auto it = state.threadIds
+                .insert(std::make_pair(std::this_thread::get_id(),
+                                       state.threadIds.size()))
+                .first;
+  threadId = it->second;
+#endif
+
+  gd::TraceEvent event(category, name, detail, startTime, duration, threadId);
+  if (state.receiver)
+    state.receiver->OnTraceEvent(event);
+  else
+    state.events.push_back(event);
+}
+
+gd::String Tracing::GetChromeTraceJSON() {
+  // Copy the events so that the lock is not held while serializing (which can
+  // itself be traced).
+  std::vector<gd::TraceEvent> events;
+  {
+    TracingState &state = GetTracingState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    events = state.events;
+  }
+
+  gd::SerializerElement element;
+  element.SetAttribute("displayTimeUnit", "ms");
+  gd::SerializerElement &eventsElement = element.AddChild("traceEvents");
+  eventsElement.ConsiderAsArrayOf("traceEvent");
+  for (const auto &event : events) {
+    gd::SerializerElement &eventElement = eventsElement.AddChild("traceEvent");
+    eventElement.SetAttribute("name", event.GetName());
+    eventElement.SetAttribute("cat", event.GetCategory());
+    eventElement.SetAttribute("ph", "X");  // A "complete" event.
+    eventElement.SetAttribute("ts", event.GetStartTime());
+    eventElement.SetAttribute("dur", event.GetDuration());
+    eventElement.SetAttribute("pid", 1);
+    eventElement.SetAttribute("tid", static_cast<int>(event.GetThreadId()));
+    if (!event.GetDetail().empty())
+      eventElement.AddChild("args").SetAttribute("detail", event.GetDetail());
+  }
+
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace gd
@@ -0,0 +1,217 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <atomic>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A span of time recorded by gd::Tracing.
+ *
+ * Times are in microseconds, since the first span recorded by the process.
+ */
+class GD_CORE_API TraceEvent {
+ public:
+  TraceEvent(const gd::String &category_,
+             const gd::String &name_,
+             const gd::String &detail_,
+             double startTime_,
+             double duration_,
+             std::size_t threadId_)
+      : category(category_),
+        name(name_),
+        detail(detail_),
+        startTime(startTime_),
+        duration(duration_),
+        threadId(threadId_){};
+
+  const gd::String &GetCategory() const { return category; }
+  const gd::String &GetName() const { return name; }
+
+  /**
+   * \brief Return what the span is about (a scene name, an extension
+   * name...), if any.
+   */
+  const gd::String &GetDetail() const { return detail; }
+  double GetStartTime() const { return startTime; }
+  double GetDuration() const { return duration; }
+
+  /**
+   * \brief Return the index of the thread where the span was recorded
+   * (0 for the first thread that recorded a span).
+   */
+  std::size_t GetThreadId() const { return threadId; }
+
+ private:
+  gd::String category;
+  gd::String name;
+  gd::String detail;
+  double startTime;
+  double duration;
+  std::size_t threadId;
+};
+
+/**
+ * \brief Receive the spans recorded by gd::Tracing, as soon as they end.
+ *
+ * \see gd::Tracing::SetReceiver
+ */
+class GD_CORE_API TraceEventsReceiver {
+ public:
+  TraceEventsReceiver(){};
+  virtual ~TraceEventsReceiver(){};
+
+  /**
+   * \brief Called for each span when it ends. Calls are never concurrent, but
+   * can be done from any thread.
+   *
+   * \warning Traced functions must not be called from here.
+   */
+  virtual void OnTraceEvent(const gd::TraceEvent &event) = 0;
+};
+
+/**
+ * \brief Record spans of time (see gd::TraceScope) to find what is slow in
+ * exports, code generation and refactoring.
+ *
+ * Tracing is disabled by default and then costs only a check of a flag by
+ * span. When enabled, spans are stored to be retrieved in the Chrome
+ * trace_event format (to be opened in chrome://tracing or Perfetto) or sent to
+ * a receiver. Spans can be recorded from any thread.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API Tracing {
+ public:
+  /**
+   * \brief Start recording spans.
+   */
+  static void Enable();
+
+  /**
+   * \brief Stop recording spans. Stored spans are kept.
+   */
+  static void Disable();
+
+  static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Send the spans to the receiver instead of storing them.
+   *
+   * \param receiver The receiver, or nullptr to store spans again. It must be
+   * alive until it's unset.
+   */
+  static void SetReceiver(gd::TraceEventsReceiver *receiver);
+
+  /**
+   * \brief Return the number of stored spans.
+   */
+  static std::size_t GetEventsCount();
+
+  /**
+   * \brief Return the stored spans as JSON, in the Chrome trace_event format.
+   */
+  static gd::String GetChromeTraceJSON();
+
+  /**
+   * \brief Remove the stored spans.
+   */
+  static void Clear();
+
+  /**
+   * \brief Return the time, in microseconds, since the first call.
+   */
+  static double GetTimeNow();
+
+  /**
+   * \brief Store a span or send it to the receiver.
+   */
+  static void Record(const char *category,
+                     const char *name,
+                     const gd::String &detail,
+                     double startTime,
+                     double duration);
+
+ private:
+  static std::atomic<bool> enabled;
+};
+
+/**
+ * \brief Record a span of time, from its construction to its destruction,
+ * if tracing is enabled.
+ *
+ * Usage:
+ * \code
+ * gd::TraceScope traceScope("Export", "ExportEventsCode", layout.GetName());
+ * \endcode
+ *
+ * \see gd::Tracing
+ */
+class GD_CORE_API TraceScope {
+ public:
+  /**
+   * \param category_ The group of the span (a static string).
+   * \param name_ The name of the span (a static string).
+   */
+  TraceScope(const char *category_, const char *name_)
+      : category(category_), name(name_), startTime(-1) {
+    if (Tracing::IsEnabled()) startTime = Tracing::GetTimeNow();
+  };
+
+  /**
+   * \param detail_ What the span is about (copied only if tracing is
+   * enabled).
+   */
+  TraceScope(const char *category_,
+             const char *name_,
+             const gd::String &detail_)
+      : category(category_), name(name_), startTime(-1) {
+    if (Tracing::IsEnabled()) {
+      detail = detail_;
+      startTime = Tracing::GetTimeNow();
+    }
+  };
+
+  /**
+   * \param detail_ The first part of what the span is about (for example an
+   * extension name).
+   * \param subDetail_ The second part (for example a function name), joined to
+   * the first with "::" only if tracing is enabled.
+   */
+  TraceScope(const char *category_,
+             const char *name_,
+             const gd::String &detail_,
+             const gd::String &subDetail_)
+      : category(category_), name(name_), startTime(-1) {
+    if (Tracing::IsEnabled()) {
+      detail = detail_ + "::" + subDetail_;
+      startTime = Tracing::GetTimeNow();
+    }
+  };
+
+  ~TraceScope() {
+    if (startTime >= 0)
+      Tracing::Record(category,
+                      name,
+                      detail,
+                      startTime,
+                      Tracing::GetTimeNow() - startTime);
+  };
+
+ private:
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+  const char *category;
+  const char *name;
+  gd::String detail;
+  double startTime;  ///< -1 if the span is not recorded.
+};
+
+}  // namespace gd
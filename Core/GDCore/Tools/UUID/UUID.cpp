@@ -0,0 +1,119 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/UUID/UUID.h"
+
+#include <random>
+
+namespace {
+
+/**
+ * \brief A xoshiro256** pseudo-random generator, seeded with splitmix64.
+ *
+ * It's much faster than std::random_device, which is a system call natively
+ * and a call to the crypto API of the browser with Emscripten.
+ */
+class RandomGenerator {
+ public:
+  RandomGenerator() {
+    std::random_device randomDevice;
+    Seed((static_cast<std::uint64_t>(randomDevice()) << 32) ^ randomDevice());
+  }
+
+  void Seed(std::uint64_t seed) {
+    for (auto& value : state) {
+      seed += 0x9E3779B97F4A7C15ULL;
+      std::uint64_t z = seed;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      value = z ^ (z >> 31);
+    }
+  }
+
+  std::uint64_t Next() {
+    const std::uint64_t result = RotateLeft(state[1] * 5, 7) * 9;
+    const std::uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = RotateLeft(state[3], 45);
+    return result;
+  }
+
+ private:
+  static std::uint64_t RotateLeft(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::uint64_t state[4];
+};
+
+RandomGenerator& GetRandomGenerator() {
+  static thread_local RandomGenerator randomGenerator;
+  return randomGenerator;
+}
+
+int HexadecimalDigitValue(char32_t character) {
+  if (character >= U'0' && character <= U'9') return character - U'0';
+  if (character >= U'a' && character <= U'f') return character - U'a' + 10;
+  if (character >= U'A' && character <= U'F') return character - U'A' + 10;
+  return -1;
+}
+
+}  // namespace
+
+namespace gd {
+
+Uuid Uuid::MakeUuid4() {
+  RandomGenerator& randomGenerator = GetRandomGenerator();
+  const std::uint64_t high = randomGenerator.Next();
+  const std::uint64_t low = randomGenerator.Next();
+
+  // Set the version (4) and the variant (RFC 4122).
+  return Uuid((high & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL,
+              (low & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL);
+}
+
+void Uuid::SetDeterministicSeed(std::uint64_t seed) {
+  GetRandomGenerator().Seed(seed);
+}
+
+Uuid Uuid::FromString(const gd::String& text) {
+  std::uint64_t values[2] = {0, 0};
+  std::size_t digitsCount = 0;
+  for (char32_t character : text) {
+    if (character == U'-') continue;
+
+    const int digitValue = HexadecimalDigitValue(character);
+    if (digitValue < 0 || digitsCount >= 32) return Uuid();
+
+    std::uint64_t& value = values[digitsCount / 16];
+    value = (value << 4) | static_cast<std::uint64_t>(digitValue);
+    digitsCount++;
+  }
+
+  return digitsCount == 32 ? Uuid(values[0], values[1]) : Uuid();
+}
+
+gd::String Uuid::ToString() const {
+  if (IsEmpty()) return "";
+
+  static const char digits[] = "0123456789abcdef";
+  char text[37];
+  std::size_t position = 0;
+  for (std::size_t i = 0; i < 32; ++i) {
+    if (i == 8 || i == 12 || i == 16 || i == 20) text[position++] = '-';
+
+    const std::uint64_t value = i < 16 ? high : low;
+    text[position++] = digits[(value >> (60 - (i % 16) * 4)) & 0xF];
+  }
+  text[position] = '\0';
+
+  return gd::String(text);
+}
+
+}  // namespace gd
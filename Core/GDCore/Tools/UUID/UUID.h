@@ -7,18 +7,93 @@
 #ifndef GDCORE_TOOLS_UUID_UUID_H
 #define GDCORE_TOOLS_UUID_UUID_H
 
+#include <cstdint>
+#include <functional>
+
 #include "GDCore/String.h"
-#include "sole.h"
 
 namespace gd {
+
+/**
+ * \brief A 128-bit UUID, stored as binary and only formatted to a text (like
+ * "3f2b8e4c-1f0a-4b5e-9c3d-7a6e5f4d3c2b") when it's serialized.
+ *
+ * A default constructed gd::Uuid is empty (all bits set to zero), which is used
+ * to represent the absence of UUID.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API Uuid {
+ public:
+  Uuid() : high(0), low(0){};
+  Uuid(std::uint64_t high_, std::uint64_t low_) : high(high_), low(low_){};
+
+  /**
+   * \brief Generate a random UUID v4.
+   *
+   * Random numbers come from a fast pseudo-random generator, one per thread,
+   * seeded once from std::random_device (see SetDeterministicSeed to get
+   * reproducible UUIDs).
+   */
+  static Uuid MakeUuid4();
+
+  /**
+   * \brief Seed the generator of the calling thread with the given value, so
+   * that the next UUIDs are always the same (useful for tests).
+   */
+  static void SetDeterministicSeed(std::uint64_t seed);
+
+  /**
+   * \brief Read a UUID written as text, with or without hyphens.
+   *
+   * \return The UUID, or an empty UUID if the text is not a valid UUID.
+   */
+  static Uuid FromString(const gd::String &text);
+
+  /**
+   * \brief Return the UUID written as text, with lowercase hexadecimal digits
+   * and hyphens. An empty UUID is written as an empty string.
+   */
+  gd::String ToString() const;
+
+  /**
+   * \brief Return true if the UUID is empty.
+   */
+  bool IsEmpty() const { return high == 0 && low == 0; }
+
+  std::uint64_t GetHigh() const { return high; }
+  std::uint64_t GetLow() const { return low; }
+
+  bool operator==(const Uuid &other) const {
+    return high == other.high && low == other.low;
+  }
+  bool operator!=(const Uuid &other) const { return !(*this == other); }
+  bool operator<(const Uuid &other) const {
+    return high < other.high || (high == other.high && low < other.low);
+  }
+
+ private:
+  std::uint64_t high;
+  std::uint64_t low;
+};
+
 namespace UUID {
 
 /**
  * Generate a random UUID v4
  */
-inline gd::String MakeUuid4() { return gd::String::From(sole::uuid4()); }
+inline gd::String MakeUuid4() { return gd::Uuid::MakeUuid4().ToString(); }
 
 }  // namespace UUID
 }  // namespace gd
 
+namespace std {
+template <>
+struct hash<gd::Uuid> {
+  size_t operator()(const gd::Uuid &uuid) const {
+    return hash<std::uint64_t>()(uuid.GetHigh() ^ uuid.GetLow());
+  }
+};
+}  // namespace std
+
 #endif
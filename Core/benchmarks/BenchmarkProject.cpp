@@ -0,0 +1,29 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "../tests/DummyPlatform.h"
+#include "Benchmarks.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+#include "GDCore/Project/Project.h"
+
+void SetupBenchmarkProject(gd::Project &project,
+                           gd::Platform &platform,
+                           std::size_t scenesCount) {
+  SetupProjectWithDummyPlatform(project, platform);
+
+  // Always the same seed, so that results can be compared between runs.
+  gd::SyntheticProjectOptions options;
+  options.seed = 1;
+  options.scenesCount = scenesCount;
+  options.objectsPerScene = 20;
+  options.groupsPerScene = 3;
+  options.instancesPerScene = 50;
+  options.eventsPerScene = 30;
+  options.eventsDepth = 1;
+  options.subEventsPerEvent = 1;
+  options.instructionsPerEvent = 2;
+  gd::SyntheticProjectGenerator::Generate(project, platform, options);
+}
@@ -0,0 +1,114 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+/**
+ * Return the value at the given percentile of sorted times
+ * (using the nearest-rank method).
+ */
+double GetPercentile(const std::vector<double> &sortedTimes, double percentile) {
+  if (sortedTimes.empty()) return 0;
+
+  std::size_t rank = static_cast<std::size_t>(
+      std::ceil(percentile / 100.0 * sortedTimes.size()));
+  if (rank == 0) rank = 1;
+  return sortedTimes[std::min(rank, sortedTimes.size()) - 1];
+}
+
+}  // namespace
+
+void BenchmarkRunner::Add(const gd::String &name, Setup setup) {
+  benchmarks.push_back(std::make_pair(name, setup));
+}
+
+void BenchmarkRunner::RunAll(std::ostream &log) {
+  for (const auto &benchmark : benchmarks) {
+    const gd::String &name = benchmark.first;
+    if (!options.filter.empty() && name.find(options.filter) == gd::String::npos)
+      continue;
+
+    for (std::size_t size : options.sizes) {
+      Measured measured = benchmark.second(size);
+      for (std::size_t i = 0; i < options.warmupRuns; ++i) measured();
+
+      std::vector<double> timesInMicroseconds;
+      for (std::size_t i = 0; i < options.repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        measured();
+        auto end = std::chrono::steady_clock::now();
+
+        timesInMicroseconds.push_back(
+            std::chrono::duration<double, std::micro>(end - start).count());
+      }
+
+      results.push_back(ComputeResult(name, size, timesInMicroseconds));
+      const BenchmarkResult &result = results.back();
+      log << name << " (size " << size << ", " << result.repetitions
+          << " runs): median " << result.median << "us, p90 " << result.p90
+          << "us, min " << result.min << "us, max " << result.max << "us"
+          << std::endl;
+    }
+  }
+}
+
+BenchmarkResult BenchmarkRunner::ComputeResult(
+    const gd::String &name,
+    std::size_t size,
+    std::vector<double> timesInMicroseconds) {
+  std::sort(timesInMicroseconds.begin(), timesInMicroseconds.end());
+
+  BenchmarkResult result;
+  result.name = name;
+  result.size = size;
+  result.repetitions = timesInMicroseconds.size();
+  result.min = timesInMicroseconds.empty() ? 0 : timesInMicroseconds.front();
+  result.max = timesInMicroseconds.empty() ? 0 : timesInMicroseconds.back();
+  result.mean = timesInMicroseconds.empty()
+                    ? 0
+                    : std::accumulate(timesInMicroseconds.begin(),
+                                      timesInMicroseconds.end(),
+                                      0.0) /
+                          timesInMicroseconds.size();
+  result.median = GetPercentile(timesInMicroseconds, 50);
+  result.p90 = GetPercentile(timesInMicroseconds, 90);
+  result.p99 = GetPercentile(timesInMicroseconds, 99);
+  return result;
+}
+
+gd::String BenchmarkRunner::GetResultsAsJSON() const {
+  gd::SerializerElement element;
+  element.SetAttribute("unit", "microseconds");
+  element.SetAttribute("warmupRuns", static_cast<int>(options.warmupRuns));
+  element.SetAttribute("repetitions", static_cast<int>(options.repetitions));
+
+  gd::SerializerElement &resultsElement = element.AddChild("results");
+  resultsElement.ConsiderAsArrayOf("result");
+  for (const auto &result : results) {
+    gd::SerializerElement &resultElement = resultsElement.AddChild("result");
+    resultElement.SetAttribute("name", result.name);
+    resultElement.SetAttribute("size", static_cast<int>(result.size));
+    resultElement.SetAttribute("repetitions",
+                               static_cast<int>(result.repetitions));
+    resultElement.SetAttribute("min", result.min);
+    resultElement.SetAttribute("mean", result.mean);
+    resultElement.SetAttribute("median", result.median);
+    resultElement.SetAttribute("p90", result.p90);
+    resultElement.SetAttribute("p99", result.p99);
+    resultElement.SetAttribute("max", result.max);
+  }
+
+  return gd::Serializer::ToJSON(element);
+}
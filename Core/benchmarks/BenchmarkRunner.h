@@ -0,0 +1,90 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "GDCore/String.h"
+
+/**
+ * \brief The options used to run the benchmarks.
+ */
+struct BenchmarkOptions {
+  BenchmarkOptions() : warmupRuns(2), repetitions(10), sizes({1, 10, 100}){};
+
+  std::size_t warmupRuns;  ///< Runs done before measuring, not reported.
+  std::size_t repetitions;  ///< Measured runs for each benchmark and size.
+  std::vector<std::size_t> sizes;  ///< The sizes of the projects to test.
+  gd::String filter;  ///< If not empty, only benchmarks containing this are run.
+};
+
+/**
+ * \brief The statistics of the measured runs of a benchmark, for a size.
+ *
+ * All times are in microseconds.
+ */
+struct BenchmarkResult {
+  gd::String name;
+  std::size_t size;
+  std::size_t repetitions;
+  double min;
+  double mean;
+  double median;
+  double p90;
+  double p99;
+  double max;
+};
+
+/**
+ * \brief Run benchmarks, each at different sizes, and report the statistics of
+ * their running times.
+ *
+ * A benchmark is registered with a function preparing it for a given size
+ * (building a project, serializing it...) and returning the function that is
+ * measured. The preparation is not measured.
+ */
+class BenchmarkRunner {
+ public:
+  typedef std::function<void()> Measured;
+  typedef std::function<Measured(std::size_t size)> Setup;
+
+  BenchmarkRunner(const BenchmarkOptions &options_) : options(options_){};
+
+  /**
+   * \brief Register a benchmark.
+   */
+  void Add(const gd::String &name, Setup setup);
+
+  /**
+   * \brief Run all the registered benchmarks (matching the filter), printing
+   * a summary line for each of them.
+   */
+  void RunAll(std::ostream &log = std::cout);
+
+  /**
+   * \brief Return the results of the benchmarks that were run.
+   */
+  const std::vector<BenchmarkResult> &GetResults() const { return results; };
+
+  /**
+   * \brief Return the results, and the options used, as JSON.
+   */
+  gd::String GetResultsAsJSON() const;
+
+  /**
+   * \brief Compute the statistics of the given times (in microseconds).
+   */
+  static BenchmarkResult ComputeResult(const gd::String &name,
+                                       std::size_t size,
+                                       std::vector<double> timesInMicroseconds);
+
+ private:
+  BenchmarkOptions options;
+  std::vector<std::pair<gd::String, Setup>> benchmarks;
+  std::vector<BenchmarkResult> results;
+};
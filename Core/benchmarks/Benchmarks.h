@@ -0,0 +1,51 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+
+class BenchmarkRunner;
+namespace gd {
+class Project;
+class Platform;
+}  // namespace gd
+
+/**
+ * \brief Setup the project with the dummy platform (see DummyPlatform.h) and
+ * fill it with the given number of scenes, using
+ * gd::SyntheticProjectGenerator (always with the same seed).
+ */
+void SetupBenchmarkProject(gd::Project &project,
+                           gd::Platform &platform,
+                           std::size_t scenesCount);
+
+/**
+ * \brief Add the benchmarks of Serializer and Project loading/saving.
+ */
+void AddSerializationBenchmarks(BenchmarkRunner &runner);
+
+/**
+ * \brief Add the benchmarks of events lists loading, copying and freeing.
+ */
+void AddEventsBenchmarks(BenchmarkRunner &runner);
+
+/**
+ * \brief Add the benchmarks of the events tools (ExpressionValidator,
+ * WholeProjectRefactorer, UsedExtensionsFinder).
+ */
+void AddEventsToolsBenchmarks(BenchmarkRunner &runner);
+
+/**
+ * \brief Add the benchmarks of ExpressionParser2 when an expression is edited
+ * one keystroke at a time.
+ */
+void AddExpressionParserBenchmarks(BenchmarkRunner &runner);
+
+/**
+ * \brief Add the benchmarks of the JavaScript code generation (only when
+ * built with GDJS).
+ */
+void AddCodeGenerationBenchmarks(BenchmarkRunner &runner);
@@ -0,0 +1,77 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+
+#if defined(GD_BENCHMARKS_WITH_GDJS)
+#include <iostream>
+#include <memory>
+#include <set>
+
+#include "../tests/DummyPlatform.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+
+namespace {
+gd::String GenerateLayoutCode(gd::Project &project, const gd::Layout &layout) {
+  std::set<gd::String> includeFiles;
+  gd::DiagnosticReport diagnosticReport;
+  gdjs::LayoutCodeGenerator layoutCodeGenerator(project);
+  return layoutCodeGenerator.GenerateLayoutCompleteCode(
+      layout, includeFiles, diagnosticReport, true);
+}
+}  // namespace
+
+void AddCodeGenerationBenchmarks(BenchmarkRunner &runner) {
+  runner.Add("LayoutCodeGenerator::GenerateLayoutCompleteCode",
+             [](std::size_t size) {
+               auto platform = std::make_shared<gd::Platform>();
+               auto project = std::make_shared<gd::Project>();
+               SetupBenchmarkProject(*project, *platform, size);
+
+               return [platform, project]() {
+                 for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i)
+                   GenerateLayoutCode(*project, project->GetLayout(i));
+               };
+             });
+
+  // Scenes where most instructions are on objects groups, each having a lot
+  // of objects.
+  runner.Add(
+      "LayoutCodeGenerator::GenerateLayoutCompleteCode (objects groups)",
+      [](std::size_t size) {
+        auto platform = std::make_shared<gd::Platform>();
+        auto project = std::make_shared<gd::Project>();
+        SetupProjectWithDummyPlatform(*project, *platform);
+
+        gd::SyntheticProjectOptions options;
+        options.scenesCount = size;
+        options.objectsPerScene = 60;
+        options.groupsPerScene = 40;
+        options.objectsPerGroup = 60;
+        options.eventsPerScene = 50;
+        gd::SyntheticProjectGenerator::Generate(*project, *platform, options);
+
+        std::size_t codeSize = 0;
+        for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i)
+          codeSize += GenerateLayoutCode(*project, project->GetLayout(i)).size();
+        std::cout << "Generated code size for " << size
+                  << " scene(s) with objects groups: " << codeSize << " bytes"
+                  << std::endl;
+
+        return [platform, project]() {
+          for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i)
+            GenerateLayoutCode(*project, project->GetLayout(i));
+        };
+      });
+}
+#else
+void AddCodeGenerationBenchmarks(BenchmarkRunner &runner) {}
+#endif
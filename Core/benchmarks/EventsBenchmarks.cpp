@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <memory>
+#include <vector>
+
+#include "../tests/DummyPlatform.h"
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+/**
+ * Fill the project with scenes having a lot of (nested) events, so that
+ * the time spent allocating and freeing them is visible.
+ */
+void SetupEventsBenchmarkProject(gd::Project &project,
+                                 gd::Platform &platform,
+                                 std::size_t scenesCount) {
+  SetupProjectWithDummyPlatform(project, platform);
+
+  gd::SyntheticProjectOptions options;
+  options.seed = 1;
+  options.scenesCount = scenesCount;
+  options.objectsPerScene = 20;
+  options.groupsPerScene = 3;
+  options.instancesPerScene = 0;
+  options.eventsPerScene = 100;
+  options.eventsDepth = 2;
+  options.subEventsPerEvent = 2;
+  options.instructionsPerEvent = 4;
+  options.externalEventsCount = 0;
+  gd::SyntheticProjectGenerator::Generate(project, platform, options);
+}
+}  // namespace
+
+void AddEventsBenchmarks(BenchmarkRunner &runner) {
+  // The events are loaded, then freed, like when a project is opened then
+  // closed.
+  runner.Add("EventsListSerialization::UnserializeEventsFrom",
+             [](std::size_t size) {
+               auto platform = std::make_shared<gd::Platform>();
+               auto project = std::make_shared<gd::Project>();
+               SetupEventsBenchmarkProject(*project, *platform, size);
+               auto elements =
+                   std::make_shared<std::vector<gd::SerializerElement>>(
+                       project->GetLayoutsCount());
+               for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+                 // Go through JSON, like when a project is opened.
+                 gd::SerializerElement element;
+                 gd::EventsListSerialization::SerializeEventsTo(
+                     project->GetLayout(i).GetEvents(), element);
+                 elements->at(i) =
+                     gd::Serializer::FromJSON(gd::Serializer::ToJSON(element));
+               }
+
+               return [platform, project, elements]() {
+                 for (const auto &element : *elements) {
+                   gd::EventsList events;
+                   gd::EventsListSerialization::UnserializeEventsFrom(
+                       *project, events, element);
+                 }
+               };
+             });
+
+  // The events are copied, then the copies are freed, like when events are
+  // copied to be modified (e.g: when events functions are inlined).
+  runner.Add("EventsList copy", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto project = std::make_shared<gd::Project>();
+    SetupEventsBenchmarkProject(*project, *platform, size);
+
+    return [platform, project]() {
+      for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i)
+        gd::EventsList events = project->GetLayout(i).GetEvents();
+    };
+  });
+}
@@ -0,0 +1,178 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/UsedExtensionsFinder.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+
+namespace {
+
+/**
+ * Collect the expressions of the instructions of events, with the type of
+ * the parameter they are used for.
+ */
+class InstructionsExpressionsCollector : public gd::ArbitraryEventsWorker {
+ public:
+  InstructionsExpressionsCollector(const gd::Platform &platform_)
+      : platform(platform_){};
+  virtual ~InstructionsExpressionsCollector(){};
+
+  std::vector<std::pair<const gd::Expression *, gd::String>> expressions;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    const gd::InstructionMetadata &metadata =
+        isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : gd::MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    for (std::size_t i = 0; i < metadata.GetParametersCount() &&
+                            i < instruction.GetParametersCount();
+         ++i) {
+      const gd::ParameterMetadata &parameterMetadata =
+          metadata.GetParameter(i);
+      if (parameterMetadata.IsCodeOnly()) continue;
+
+      expressions.push_back(std::make_pair(&instruction.GetParameter(i),
+                                           parameterMetadata.GetType()));
+    }
+    return false;
+  }
+
+  const gd::Platform &platform;
+};
+
+}  // namespace
+
+void AddEventsToolsBenchmarks(BenchmarkRunner &runner) {
+  runner.Add("ExpressionValidator", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto project = std::make_shared<gd::Project>();
+    SetupBenchmarkProject(*project, *platform, size);
+
+    auto expressionsPerLayout = std::make_shared<std::vector<
+        std::vector<std::pair<const gd::Expression *, gd::String>>>>();
+    for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+      InstructionsExpressionsCollector collector(*platform);
+      collector.Launch(project->GetLayout(i).GetEvents());
+      for (const auto &expression : collector.expressions)
+        expression.first->GetRootNode();  // Parse before measuring.
+
+      expressionsPerLayout->push_back(collector.expressions);
+    }
+
+    return [platform, project, expressionsPerLayout]() {
+      for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+        auto projectScopedContainers = gd::ProjectScopedContainers::
+            MakeNewProjectScopedContainersForProjectAndLayout(
+                *project, project->GetLayout(i));
+
+        for (const auto &expression : (*expressionsPerLayout)[i]) {
+          gd::ExpressionValidator validator(
+              *platform, projectScopedContainers, expression.second);
+          expression.first->GetRootNode()->Visit(validator);
+        }
+      }
+    };
+  });
+
+  runner.Add("WholeProjectRefactorer::ObjectOrGroupRenamedInScene",
+             [](std::size_t size) {
+               auto platform = std::make_shared<gd::Platform>();
+               auto project = std::make_shared<gd::Project>();
+               SetupBenchmarkProject(*project, *platform, size);
+
+               return [platform, project]() {
+                 // Rename an object in all scenes, and then rename it back.
+                 for (const auto &names :
+                      {std::make_pair("Object0", "RenamedObject"),
+                       std::make_pair("RenamedObject", "Object0")}) {
+                   for (std::size_t i = 0; i < project->GetLayoutsCount();
+                        ++i) {
+                     gd::Layout &layout = project->GetLayout(i);
+                     layout.GetObjects().GetObject(names.first).SetName(
+                         names.second);
+                     gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+                         *project, layout, names.first, names.second, false);
+                   }
+                 }
+               };
+             });
+
+  runner.Add("WholeProjectRefactorer::ObjectsOrGroupsRenamedInScene",
+             [](std::size_t size) {
+               auto platform = std::make_shared<gd::Platform>();
+               auto project = std::make_shared<gd::Project>();
+               SetupBenchmarkProject(*project, *platform, size);
+
+               return [platform, project]() {
+                 // Rename 10 objects at once in all scenes, and then rename
+                 // them back.
+                 std::map<gd::String, gd::String> oldToNewNames;
+                 std::map<gd::String, gd::String> newToOldNames;
+                 for (std::size_t i = 0; i < 10; ++i) {
+                   gd::String name = "Object" + gd::String::From(i);
+                   oldToNewNames[name] = "Renamed" + name;
+                   newToOldNames["Renamed" + name] = name;
+                 }
+                 for (const auto *names : {&oldToNewNames, &newToOldNames}) {
+                   for (std::size_t i = 0; i < project->GetLayoutsCount();
+                        ++i) {
+                     gd::Layout &layout = project->GetLayout(i);
+                     for (const auto &oldAndNewName : *names)
+                       layout.GetObjects()
+                           .GetObject(oldAndNewName.first)
+                           .SetName(oldAndNewName.second);
+                     gd::WholeProjectRefactorer::ObjectsOrGroupsRenamedInScene(
+                         *project, layout, *names);
+                   }
+                 }
+               };
+             });
+
+  runner.Add("WholeProjectRefactorer::RenameLayout", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto project = std::make_shared<gd::Project>();
+    SetupBenchmarkProject(*project, *platform, size);
+
+    return [platform, project]() {
+      gd::Layout &layout = project->GetLayout(0);
+      layout.SetName("RenamedScene");
+      gd::WholeProjectRefactorer::RenameLayout(
+          *project, "Scene0", "RenamedScene");
+      layout.SetName("Scene0");
+      gd::WholeProjectRefactorer::RenameLayout(
+          *project, "RenamedScene", "Scene0");
+    };
+  });
+
+  runner.Add("UsedExtensionsFinder::ScanProject", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto project = std::make_shared<gd::Project>();
+    SetupBenchmarkProject(*project, *platform, size);
+
+    return [platform, project]() {
+      gd::UsedExtensionsFinder::ScanProject(*project);
+    };
+  });
+}
@@ -0,0 +1,114 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <memory>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/String.h"
+
+namespace {
+
+/**
+ * Return an expression of about 5 KB of text for each unit of \a size, made
+ * of function calls, operators and sub expressions.
+ */
+gd::String MakeLongExpression(std::size_t size) {
+  gd::String expression;
+  for (std::size_t i = 0; i < size * 200; ++i) {
+    if (i != 0) expression += " + ";
+    switch (i % 4) {
+      case 0:
+        expression += "cos(MyVariable * " + gd::String::From(i) + ")";
+        break;
+      case 1:
+        expression += "MyObject.X()";
+        break;
+      case 2:
+        expression += "(ToNumber(\"" + gd::String::From(i) + "\") - 1)";
+        break;
+      default:
+        expression += "max(MyObject.Variable(MyChild), 2)";
+        break;
+    }
+  }
+  return expression;
+}
+
+/**
+ * Return the values of the expression while a text is typed, one character
+ * at a time, at the given position, and then erased.
+ */
+std::vector<gd::String> MakeKeystrokes(const gd::String &expression,
+                                       std::size_t position,
+                                       const gd::String &typedText) {
+  std::vector<gd::String> keystrokes;
+  for (std::size_t i = 1; i <= typedText.size(); ++i) {
+    keystrokes.push_back(expression.substr(0, position) +
+                         typedText.substr(0, i) + expression.substr(position));
+  }
+  for (std::size_t i = typedText.size(); i > 0; --i) {
+    keystrokes.push_back(expression.substr(0, position) +
+                         typedText.substr(0, i - 1) +
+                         expression.substr(position));
+  }
+  return keystrokes;
+}
+
+/**
+ * The state kept between the runs of a keystrokes benchmark: the expression
+ * is the same at the end of each run.
+ */
+struct KeystrokesState {
+  gd::ExpressionParser2 parser;
+  gd::String expression;
+  std::unique_ptr<gd::ExpressionNode> node;
+  std::vector<gd::String> keystrokes;
+};
+
+std::shared_ptr<KeystrokesState> MakeKeystrokesState(std::size_t size) {
+  auto state = std::make_shared<KeystrokesState>();
+  state->expression = MakeLongExpression(size);
+  state->node = state->parser.ParseExpression(state->expression);
+
+  // Type in the parameters of a function call in the middle of the
+  // expression.
+  std::size_t position =
+      state->expression.find("cos(", state->expression.size() / 2) + 4;
+  state->keystrokes = MakeKeystrokes(state->expression, position, "1 + 2 * ");
+  return state;
+}
+
+}  // namespace
+
+void AddExpressionParserBenchmarks(BenchmarkRunner &runner) {
+  // For these benchmarks, the size is the number of blocks of 5 KB of text of
+  // the edited expression.
+  runner.Add("ExpressionParser2::ParseExpression (keystrokes)",
+             [](std::size_t size) {
+               auto state = MakeKeystrokesState(size);
+
+               return [state]() {
+                 for (const auto &expression : state->keystrokes)
+                   state->node = state->parser.ParseExpression(expression);
+               };
+             });
+
+  runner.Add("ExpressionParser2::ReparseExpression (keystrokes)",
+             [](std::size_t size) {
+               auto state = MakeKeystrokesState(size);
+
+               return [state]() {
+                 for (const auto &expression : state->keystrokes) {
+                   state->node = state->parser.ReparseExpression(
+                       state->expression, std::move(state->node), expression);
+                   state->expression = expression;
+                 }
+               };
+             });
+}
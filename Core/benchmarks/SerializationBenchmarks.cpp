@@ -0,0 +1,63 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <memory>
+
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+void AddSerializationBenchmarks(BenchmarkRunner &runner) {
+  runner.Add("Serializer::ToJSON", [](std::size_t size) {
+    gd::Platform platform;
+    gd::Project project;
+    SetupBenchmarkProject(project, platform, size);
+    auto element = std::make_shared<gd::SerializerElement>();
+    project.SerializeTo(*element);
+
+    return [element]() { gd::Serializer::ToJSON(*element); };
+  });
+
+  runner.Add("Serializer::FromJSON", [](std::size_t size) {
+    gd::Platform platform;
+    gd::Project project;
+    SetupBenchmarkProject(project, platform, size);
+    gd::SerializerElement element;
+    project.SerializeTo(element);
+    gd::String json = gd::Serializer::ToJSON(element);
+
+    return [json]() { gd::Serializer::FromJSON(json); };
+  });
+
+  runner.Add("Project::SerializeTo", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto project = std::make_shared<gd::Project>();
+    SetupBenchmarkProject(*project, *platform, size);
+
+    return [platform, project]() {
+      gd::SerializerElement element;
+      project->SerializeTo(element);
+    };
+  });
+
+  runner.Add("Project::UnserializeFrom", [](std::size_t size) {
+    auto platform = std::make_shared<gd::Platform>();
+    auto element = std::make_shared<gd::SerializerElement>();
+    {
+      gd::Project project;
+      SetupBenchmarkProject(project, *platform, size);
+      project.SerializeTo(*element);
+    }
+
+    return [platform, element]() {
+      gd::Project project;
+      project.AddPlatform(*platform);
+      project.UnserializeFrom(*element);
+    };
+  });
+}
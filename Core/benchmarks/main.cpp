@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+/**
+ * \file GDCore_benchmarks: measure the time spent in the hot paths of
+ * GDCore (and GDJS code generation) for projects of different sizes.
+ *
+ * Run with `--help` to see the options. Results can be saved as JSON
+ * with `--json <file>` to track regressions.
+ */
+#include <fstream>
+#include <iostream>
+
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+#include "GDCore/String.h"
+
+namespace {
+
+void PrintUsage() {
+  std::cout
+      << "Usage: GDCore_benchmarks [options]\n"
+         "\n"
+         "Options:\n"
+         "  --filter <text>        Only run benchmarks containing this text.\n"
+         "  --sizes <list>         Comma separated number of scenes of the "
+         "projects (default: 1,10,100).\n"
+         "  --warmup <count>       Runs before measuring (default: 2).\n"
+         "  --repetitions <count>  Measured runs (default: 10).\n"
+         "  --json <file>          Write the results as JSON in this file.\n"
+         "  --help                 Show this help.\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  BenchmarkOptions options;
+  gd::String jsonFile;
+
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = argv[i];
+    if (argument == "--help" || argument == "-h") {
+      PrintUsage();
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      std::cerr << "Missing value for " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    }
+
+    gd::String value = argv[++i];
+    if (argument == "--filter") {
+      options.filter = value;
+    } else if (argument == "--sizes") {
+      options.sizes.clear();
+      for (const auto &size : value.Split(U',')) {
+        options.sizes.push_back(size.To<std::size_t>());
+      }
+    } else if (argument == "--warmup") {
+      options.warmupRuns = value.To<std::size_t>();
+    } else if (argument == "--repetitions") {
+      options.repetitions = value.To<std::size_t>();
+    } else if (argument == "--json") {
+      jsonFile = value;
+    } else {
+      std::cerr << "Unknown argument: " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  BenchmarkRunner runner(options);
+  AddSerializationBenchmarks(runner);
+  AddEventsBenchmarks(runner);
+  AddEventsToolsBenchmarks(runner);
+  AddExpressionParserBenchmarks(runner);
+  AddCodeGenerationBenchmarks(runner);
+  runner.RunAll();
+
+  if (!jsonFile.empty()) {
+    std::ofstream file(jsonFile.Raw());
+    if (!file) {
+      std::cerr << "Unable to write " << jsonFile << std::endl;
+      return 1;
+    }
+    file << runner.GetResultsAsJSON();
+  }
+
+  return 0;
+}
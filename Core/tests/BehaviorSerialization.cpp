@@ -117,6 +117,7 @@ void CheckBehaviorProperty(ObjectsContainer &container) {
   REQUIRE(behavior.GetTypeName() == "MyEventsExtension::MyEventsBasedBehavior");
   REQUIRE(behavior.GetProperties().size() == 1);
   REQUIRE(behavior.GetProperties().at("MyProperty").GetValue() == "481516");
+  REQUIRE(behavior.GetPropertyValue("MyProperty") == "481516");
 };
 } // namespace
 
@@ -140,6 +141,36 @@ TEST_CASE("BehaviorSerialization", "[common]") {
     CheckBehaviorProperty(readProject.GetLayout("Scene").GetObjects());
   }
 
+  SECTION("Read a single property value of a custom behavior") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProject(project, platform);
+    auto &eventsBasedBehavior =
+        project.GetEventsFunctionsExtension("MyEventsExtension")
+            .GetEventsBasedBehaviors()
+            .Get("MyEventsBasedBehavior");
+    eventsBasedBehavior.GetPropertyDescriptors()
+        .InsertNew("MyBooleanProperty", 1)
+        .SetType("Boolean")
+        .SetValue("true");
+
+    auto &behavior = project.GetLayout("Scene")
+                         .GetObjects()
+                         .GetObject("MyObject")
+                         .GetBehavior("MyEventsBasedBehavior");
+    REQUIRE(behavior.GetPropertyValue("MyProperty") == "481516");
+    // Properties without a value have their default value.
+    REQUIRE(behavior.GetPropertyValue("MyBooleanProperty") == "true");
+    REQUIRE(behavior.GetPropertyValue("MyUnknownProperty") == "");
+
+    behavior.UpdateProperty("MyBooleanProperty", "0");
+    REQUIRE(behavior.GetPropertyValue("MyBooleanProperty") == "false");
+    for (const auto &property : behavior.GetProperties()) {
+      REQUIRE(behavior.GetPropertyValue(property.first) ==
+              property.second.GetValue());
+    }
+  }
+
   SECTION("Load a project with a property value on a custom behavior that no longer exists") {
     gd::Platform platform;
     gd::Project writtenProject;
@@ -7,16 +7,22 @@
  * @file Tests covering events of GDevelop Core.
  */
 #include <memory>
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/ForEachEvent.h"
 #include "GDCore/Events/Builtin/GroupEvent.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
@@ -44,6 +50,96 @@ TEST_CASE("Events", "[common][events]") {
     REQUIRE(list[1].GetType() == "ChangedInstructionType");
   }
 
+  SECTION("InstructionsList serialization") {
+    gd::InstructionsList list;
+    gd::Instruction &instruction =
+        list.Insert(gd::Instruction("InstructionType"));
+    instruction.SetInverted(true);
+    instruction.SetParametersCount(3);
+    instruction.SetParameter(0, gd::Expression("MyObject"));
+    instruction.SetParameter(1, gd::Expression("1 + 2"));
+    gd::Instruction &subInstruction = instruction.GetSubInstructions().Insert(
+        gd::Instruction("SubInstructionType"));
+    subInstruction.AddParameter(gd::Expression("\"Hello\""));
+    subInstruction.GetSubInstructions().Insert(
+        gd::Instruction("SubSubInstructionType"));
+    list.Insert(gd::Instruction("OtherInstructionType")).SetAwaited(true);
+
+    gd::SerializerElement element;
+    gd::EventsListSerialization::SerializeInstructionsTo(list, element);
+
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::InstructionsList unserializedList;
+    gd::EventsListSerialization::UnserializeInstructionsFrom(
+        project,
+        unserializedList,
+        gd::Serializer::FromJSON(gd::Serializer::ToJSON(element)));
+
+    REQUIRE(unserializedList.size() == 2);
+    const gd::Instruction &unserializedInstruction = unserializedList[0];
+    REQUIRE(unserializedInstruction.GetType() == "InstructionType");
+    REQUIRE(unserializedInstruction.IsInverted() == true);
+    REQUIRE(unserializedInstruction.GetParametersCount() == 3);
+    REQUIRE(unserializedInstruction.GetParameter(0).GetPlainString() ==
+            "MyObject");
+    REQUIRE(unserializedInstruction.GetParameter(1).GetPlainString() ==
+            "1 + 2");
+    REQUIRE(unserializedInstruction.GetParameter(2).GetPlainString() == "");
+    REQUIRE(unserializedInstruction.GetSubInstructions().size() == 1);
+    const gd::Instruction &unserializedSubInstruction =
+        unserializedInstruction.GetSubInstructions()[0];
+    REQUIRE(unserializedSubInstruction.GetType() == "SubInstructionType");
+    REQUIRE(unserializedSubInstruction.GetParametersCount() == 1);
+    REQUIRE(unserializedSubInstruction.GetParameter(0).GetPlainString() ==
+            "\"Hello\"");
+    REQUIRE(unserializedSubInstruction.GetSubInstructions().size() == 1);
+    REQUIRE(unserializedSubInstruction.GetSubInstructions()[0].GetType() ==
+            "SubSubInstructionType");
+    REQUIRE(unserializedList[1].GetType() == "OtherInstructionType");
+    REQUIRE(unserializedList[1].IsAwaited() == true);
+    REQUIRE(unserializedList[1].GetParametersCount() == 0);
+  }
+
+  SECTION("Moved expressions keep their value") {
+    std::vector<gd::Expression> parameters;
+    parameters.push_back(gd::Expression("MyObject.X()"));
+    parameters.push_back(gd::Expression("1 + 2"));
+    REQUIRE(parameters[0].GetRootNode() != nullptr);
+
+    gd::Instruction instruction("InstructionType");
+    instruction.SetParameters(std::move(parameters));
+    REQUIRE(instruction.GetParametersCount() == 2);
+    REQUIRE(instruction.GetParameter(0).GetPlainString() == "MyObject.X()");
+    REQUIRE(instruction.GetParameter(0).GetRootNode() != nullptr);
+    REQUIRE(instruction.GetParameter(1).GetPlainString() == "1 + 2");
+
+    gd::Expression expression("3 + 4");
+    expression = std::move(instruction.GetParameter(1));
+    REQUIRE(expression.GetPlainString() == "1 + 2");
+  }
+
+  SECTION("Expressions that can't contain a name") {
+    gd::Expression expression(
+        "MyObject.X() + MyExtension::MyFunction(\"MyText\") + MyVariable.MyChild");
+    REQUIRE(expression.MayContainName("MyObject") == true);
+    REQUIRE(expression.MayContainName("MyVariable") == true);
+    REQUIRE(expression.MayContainName("MyChild") == true);
+    REQUIRE(expression.MayContainName("MyText") == true);
+    REQUIRE(expression.MayContainName("MyExtension::MyFunction") == true);
+    REQUIRE(expression.MayContainName("MyOtherObject") == false);
+    REQUIRE(expression.MayContainName("MyExtension::MyOtherFunction") == false);
+
+    // Spaces are allowed around namespace separators.
+    REQUIRE(gd::Expression("MyExtension :: MyFunction()")
+                .MayContainName("MyExtension::MyFunction") == true);
+    // Escaped characters are allowed in texts.
+    REQUIRE(gd::Expression("\"My\\\"Text\"").MayContainName("My\"Text") ==
+            true);
+    REQUIRE(expression.MayContainName("") == true);
+  }
+
   SECTION("StandardEvent") {
     gd::Instruction instr("InstructionType");
     gd::StandardEvent event;
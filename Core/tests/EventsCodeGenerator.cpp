@@ -15,6 +15,37 @@
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+
+class TestEventsCodeGenerator : public gd::EventsCodeGenerator {
+ public:
+  TestEventsCodeGenerator(const gd::Project& project,
+                          const gd::Layout& layout,
+                          const gd::Platform& platform,
+                          bool supportsLoops_)
+      : gd::EventsCodeGenerator(project, layout, platform),
+        supportsLoops(supportsLoops_){};
+
+  using gd::EventsCodeGenerator::GenerateObjectsCode;
+
+  virtual gd::String GenerateObjectsListsLoop(
+      const std::vector<gd::String>& objectsListNames,
+      const std::function<gd::String(const gd::String& objectsList)>&
+          generateCode) override {
+    if (!supportsLoops) return "";
+
+    gd::String loopCode = "loop(";
+    for (auto& objectsListName : objectsListNames)
+      loopCode += objectsListName + ";";
+    return loopCode + ") {" + generateCode("list") + "}";
+  }
+
+ private:
+  bool supportsLoops;
+};
+
+}  // namespace
+
 TEST_CASE("EventsCodeGenerator", "[common][events]") {
   SECTION("Basics") {
     gd::Project project;
@@ -31,4 +62,53 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+  SECTION("Objects of a group") {
+    gd::Project project;
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    gd::Platform platform;
+
+    SECTION("Code is repeated for each object when loops are not supported") {
+      TestEventsCodeGenerator codeGenerator(project, layout, platform, false);
+      REQUIRE(codeGenerator.GenerateObjectsCode(
+                  {"GDEnemyObjects1", "GDBossObjects1"},
+                  {"GDEnemyObjects1.hit();", "GDBossObjects1.hit();"}) ==
+              "GDEnemyObjects1.hit();GDBossObjects1.hit();");
+    }
+    SECTION("A loop is generated when the code is the same for all objects") {
+      TestEventsCodeGenerator codeGenerator(project, layout, platform, true);
+      REQUIRE(codeGenerator.GenerateObjectsCode(
+                  {"GDEnemyObjects1", "GDBossObjects1"},
+                  {"for (x of GDEnemyObjects1) x.hit(GDEnemyObjects1.length);",
+                   "for (x of GDBossObjects1) x.hit(GDBossObjects1.length);"}) ==
+              "loop(GDEnemyObjects1;GDBossObjects1;) {for (x of list) "
+              "x.hit(list.length);}");
+
+      // A single object does not need a loop.
+      REQUIRE(codeGenerator.GenerateObjectsCode({"GDEnemyObjects1"},
+                                                {"GDEnemyObjects1.hit();"}) ==
+              "GDEnemyObjects1.hit();");
+    }
+    SECTION("No loop is generated when the code is specific to an object") {
+      TestEventsCodeGenerator codeGenerator(project, layout, platform, true);
+      REQUIRE(codeGenerator.GenerateObjectsCode(
+                  {"GDEnemyObjects1", "GDBossObjects1"},
+                  {"GDEnemyObjects1.hit();", "GDBossObjects1.hitHarder();"}) ==
+              "GDEnemyObjects1.hit();GDBossObjects1.hitHarder();");
+
+      // Other identifiers containing the name of the objects list are not
+      // considered as a usage of it.
+      REQUIRE(codeGenerator.GenerateObjectsCode(
+                  {"GDEnemyObjects1", "GDBossObjects1"},
+                  {"GDEnemyObjects1.hit(GDEnemyObjects12);",
+                   "GDBossObjects1.hit(GDEnemyObjects12);"}) ==
+              "loop(GDEnemyObjects1;GDBossObjects1;) "
+              "{list.hit(GDEnemyObjects12);}");
+      REQUIRE(codeGenerator.GenerateObjectsCode(
+                  {"GDEnemyObjects1", "GDBossObjects1"},
+                  {"GDEnemyObjects1.hit(GDEnemyObjects12);",
+                   "GDBossObjects1.hit(GDBossObjects12);"}) ==
+              "GDEnemyObjects1.hit(GDEnemyObjects12);"
+              "GDBossObjects1.hit(GDBossObjects12);");
+    }
+  }
 }
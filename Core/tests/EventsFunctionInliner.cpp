@@ -0,0 +1,320 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsFunctionInliner.h"
+
+#include <memory>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, parameters[i]);
+  return instruction;
+}
+
+gd::StandardEvent &InsertActionsEvent(
+    gd::EventsList &events, const std::vector<gd::Instruction> &actions) {
+  gd::StandardEvent event;
+  for (auto &action : actions) event.GetActions().Insert(action);
+  return dynamic_cast<gd::StandardEvent &>(events.InsertEvent(event));
+}
+
+const gd::InstructionsList &GetActions(gd::EventsList &events) {
+  return dynamic_cast<gd::StandardEvent &>(events.GetEvent(0)).GetActions();
+}
+
+/**
+ * A free function changing a variable of its object and doing something with
+ * its number.
+ */
+gd::EventsFunction &InsertFreeFunction(gd::EventsFunctionsExtension &extension,
+                                       const gd::String &name) {
+  auto &eventsFunction = extension.InsertNewEventsFunction(name, 0);
+  eventsFunction.GetParameters()
+      .AddNewParameter("MyObject")
+      .GetValueTypeMetadata()
+      .SetName("object");
+  eventsFunction.GetParameters()
+      .AddNewParameter("MyNumber")
+      .GetValueTypeMetadata()
+      .SetName("expression");
+  InsertActionsEvent(
+      eventsFunction.GetEvents(),
+      {MakeInstruction("SetNumberObjectVariable",
+                       {"MyObject", "MyVariable", "=", "MyNumber * 2"}),
+       MakeInstruction("MyExtension::DoSomething", {"MyNumber"})});
+  return eventsFunction;
+}
+
+}  // namespace
+
+TEST_CASE("EventsFunctionInliner", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MySprite", 0);
+  layout.GetVariables().InsertNew("MySceneVariable", 0);
+  auto projectScopedContainers = gd::ProjectScopedContainers::
+      MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+
+  auto &extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  InsertFreeFunction(extension, "MyFunction");
+
+  SECTION("Calls to small free functions are replaced by their actions") {
+    gd::EventsList events;
+    InsertActionsEvent(
+        events,
+        {MakeInstruction("MyExtension::DoSomething", {"1"}),
+         MakeInstruction("MyEventsExtension::MyFunction",
+                         {"", "MySprite", "1 + MySceneVariable"}),
+         MakeInstruction("MyExtension::DoSomething", {"2"})});
+
+    gd::EventsFunctionInliner inliner(platform, project);
+    inliner.Launch(events, projectScopedContainers);
+
+    REQUIRE(inliner.GetInlinedCallsCount() == 1);
+    const auto &actions = GetActions(events);
+    REQUIRE(actions.size() == 4);
+    REQUIRE(actions[0].GetParameter(0).GetPlainString() == "1");
+    REQUIRE(actions[1].GetType() == "SetNumberObjectVariable");
+    REQUIRE(actions[1].GetParameter(0).GetPlainString() == "MySprite");
+    REQUIRE(actions[1].GetParameter(1).GetPlainString() == "MyVariable");
+    REQUIRE(actions[1].GetParameter(3).GetPlainString() ==
+            "(1 + MySceneVariable) * 2");
+    REQUIRE(actions[2].GetType() == "MyExtension::DoSomething");
+    REQUIRE(actions[2].GetParameter(0).GetPlainString() ==
+            "(1 + MySceneVariable)");
+    REQUIRE(actions[3].GetParameter(0).GetPlainString() == "2");
+  }
+
+  SECTION("Calls with arguments depending on objects are not inlined") {
+    gd::EventsList events;
+    InsertActionsEvent(
+        events,
+        {MakeInstruction("MyEventsExtension::MyFunction",
+                         {"", "MySprite", "MySprite.GetObjectNumber()"}),
+         MakeInstruction("MyEventsExtension::MyFunction",
+                         {"", "MySprite", "MySprite.MyVariable"}),
+         MakeInstruction("MyEventsExtension::MyFunction",
+                         {"", "MySprite", "MyExtension::GetNumber()"}),
+         MakeInstruction("MyEventsExtension::MyFunction",
+                         {"", "MySprite", ""})});
+
+    gd::EventsFunctionInliner inliner(platform, project);
+    inliner.Launch(events, projectScopedContainers);
+
+    REQUIRE(inliner.GetInlinedCallsCount() == 0);
+    REQUIRE(GetActions(events).size() == 4);
+  }
+
+  SECTION("Functions that can't be moved in the calling events are not "
+          "inlined") {
+    // A function with a condition.
+    auto &withCondition = InsertFreeFunction(extension, "WithCondition");
+    dynamic_cast<gd::StandardEvent &>(withCondition.GetEvents().GetEvent(0))
+        .GetConditions()
+        .Insert(MakeInstruction("BooleanVariable",
+                                {"MySceneVariable", "True"}));
+
+    // A function with a sub-event.
+    auto &withSubEvent = InsertFreeFunction(extension, "WithSubEvent");
+    InsertActionsEvent(withSubEvent.GetEvents().GetEvent(0).GetSubEvents(),
+                       {MakeInstruction("MyExtension::DoSomething", {"1"})});
+
+    // An asynchronous function.
+    InsertFreeFunction(extension, "Async").SetAsync(true);
+
+    // A function with too many actions.
+    auto &tooLong = InsertFreeFunction(extension, "TooLong");
+    for (std::size_t i = 0;
+         i < gd::EventsFunctionInliner::maxInlinedActionsCount;
+         ++i) {
+      dynamic_cast<gd::StandardEvent &>(tooLong.GetEvents().GetEvent(0))
+          .GetActions()
+          .Insert(MakeInstruction("MyExtension::DoSomething", {"1"}));
+    }
+
+    // A function using a variable of the extension.
+    auto &withVariable = InsertFreeFunction(extension, "WithVariable");
+    dynamic_cast<gd::StandardEvent &>(withVariable.GetEvents().GetEvent(0))
+        .GetActions()
+        .Insert(MakeInstruction("MyExtension::DoSomething",
+                                {"MyExtensionVariable + 1"}));
+
+    gd::EventsList events;
+    InsertActionsEvent(
+        events,
+        {MakeInstruction("MyEventsExtension::WithCondition",
+                         {"", "MySprite", "1"}),
+         MakeInstruction("MyEventsExtension::WithSubEvent",
+                         {"", "MySprite", "1"}),
+         MakeInstruction("MyEventsExtension::Async", {"", "MySprite", "1"}),
+         MakeInstruction("MyEventsExtension::TooLong", {"", "MySprite", "1"}),
+         MakeInstruction("MyEventsExtension::WithVariable",
+                         {"", "MySprite", "1"})});
+
+    gd::EventsFunctionInliner inliner(platform, project);
+    inliner.Launch(events, projectScopedContainers);
+
+    REQUIRE(inliner.GetInlinedCallsCount() == 0);
+    REQUIRE(GetActions(events).size() == 5);
+  }
+
+  SECTION("Calls in functions are inlined, but not recursive calls") {
+    // The metadata of events functions are declared when extensions are
+    // loaded: declare the one of the function called by another function.
+    auto eventsFunctionsPlatformExtension =
+        std::make_shared<gd::PlatformExtension>();
+    eventsFunctionsPlatformExtension->SetExtensionInformation(
+        "MyEventsExtension", "", "", "", "");
+    eventsFunctionsPlatformExtension
+        ->AddAction("MyFunction", "", "", "", "", "", "")
+        .AddCodeOnlyParameter("currentScene", "")
+        .AddParameter("object", "")
+        .AddParameter("expression", "");
+    platform.AddExtension(eventsFunctionsPlatformExtension);
+
+    // A function calling MyFunction.
+    auto &caller = extension.InsertNewEventsFunction("Caller", 0);
+    caller.GetParameters()
+        .AddNewParameter("CallerObject")
+        .GetValueTypeMetadata()
+        .SetName("object");
+    InsertActionsEvent(caller.GetEvents(),
+                       {MakeInstruction("MyEventsExtension::MyFunction",
+                                        {"", "CallerObject", "3"})});
+
+    // Functions calling each other.
+    auto &recursive = extension.InsertNewEventsFunction("Recursive", 0);
+    InsertActionsEvent(
+        recursive.GetEvents(),
+        {MakeInstruction("MyEventsExtension::OtherRecursive", {""})});
+    auto &otherRecursive =
+        extension.InsertNewEventsFunction("OtherRecursive", 0);
+    InsertActionsEvent(
+        otherRecursive.GetEvents(),
+        {MakeInstruction("MyEventsExtension::Recursive", {""})});
+
+    // A function calling itself.
+    auto &selfCalling = extension.InsertNewEventsFunction("SelfCalling", 0);
+    InsertActionsEvent(
+        selfCalling.GetEvents(),
+        {MakeInstruction("MyEventsExtension::SelfCalling", {""})});
+
+    gd::EventsList events;
+    InsertActionsEvent(
+        events,
+        {MakeInstruction("MyEventsExtension::Caller", {"", "MySprite"}),
+         MakeInstruction("MyEventsExtension::Recursive", {""}),
+         MakeInstruction("MyEventsExtension::SelfCalling", {""})});
+
+    gd::EventsFunctionInliner inliner(platform, project);
+    inliner.Launch(events, projectScopedContainers);
+
+    const auto &actions = GetActions(events);
+    REQUIRE(actions.size() == 4);
+    REQUIRE(actions[0].GetType() == "SetNumberObjectVariable");
+    REQUIRE(actions[0].GetParameter(0).GetPlainString() == "MySprite");
+    REQUIRE(actions[0].GetParameter(3).GetPlainString() == "(3) * 2");
+    REQUIRE(actions[1].GetType() == "MyExtension::DoSomething");
+    REQUIRE(actions[1].GetParameter(0).GetPlainString() == "(3)");
+    // The recursive calls are inlined until the function is called again.
+    REQUIRE(actions[2].GetType() == "MyEventsExtension::Recursive");
+    REQUIRE(actions[3].GetType() == "MyEventsExtension::SelfCalling");
+  }
+
+  SECTION("Calls to behavior functions are inlined only if they act on the "
+          "object") {
+    auto &eventsBasedBehavior =
+        extension.GetEventsBasedBehaviors().InsertNew("MyEventsBehavior", 0);
+    auto &behaviorFunctions = eventsBasedBehavior.GetEventsFunctions();
+
+    auto &setter = behaviorFunctions.InsertNewEventsFunction("SetValue", 0);
+    setter.GetParameters()
+        .AddNewParameter("Object")
+        .GetValueTypeMetadata()
+        .SetName("object");
+    setter.GetParameters()
+        .AddNewParameter("Behavior")
+        .GetValueTypeMetadata()
+        .SetName("behavior")
+        .SetExtraInfo("MyEventsExtension::MyEventsBehavior");
+    setter.GetParameters()
+        .AddNewParameter("Value")
+        .GetValueTypeMetadata()
+        .SetName("expression");
+    InsertActionsEvent(
+        setter.GetEvents(),
+        {MakeInstruction("SetNumberObjectVariable",
+                         {"Object", "MyVariable", "=", "Value"}),
+         MakeInstruction(
+             "MyExtension::BehaviorDoSomething",
+             {"Object",
+              "Behavior",
+              "Object.Behavior::GetBehaviorNumberWith1Param(Value)"})});
+
+    auto &freeActionMethod =
+        behaviorFunctions.InsertNewEventsFunction("FreeActionMethod", 0);
+    freeActionMethod.GetParameters()
+        .AddNewParameter("Object")
+        .GetValueTypeMetadata()
+        .SetName("object");
+    freeActionMethod.GetParameters()
+        .AddNewParameter("Behavior")
+        .GetValueTypeMetadata()
+        .SetName("behavior")
+        .SetExtraInfo("MyEventsExtension::MyEventsBehavior");
+    InsertActionsEvent(freeActionMethod.GetEvents(),
+                       {MakeInstruction("MyExtension::DoSomething", {"1"})});
+
+    gd::EventsList events;
+    InsertActionsEvent(
+        events,
+        {MakeInstruction("MyEventsExtension::MyEventsBehavior::SetValue",
+                         {"MySprite", "MyBehavior", "4"}),
+         MakeInstruction(
+             "MyEventsExtension::MyEventsBehavior::FreeActionMethod",
+             {"MySprite", "MyBehavior"})});
+
+    gd::EventsFunctionInliner inliner(platform, project);
+    inliner.Launch(events, projectScopedContainers);
+
+    REQUIRE(inliner.GetInlinedCallsCount() == 1);
+    const auto &actions = GetActions(events);
+    REQUIRE(actions.size() == 3);
+    REQUIRE(actions[0].GetParameter(0).GetPlainString() == "MySprite");
+    REQUIRE(actions[0].GetParameter(3).GetPlainString() == "(4)");
+    REQUIRE(actions[1].GetParameter(0).GetPlainString() == "MySprite");
+    REQUIRE(actions[1].GetParameter(1).GetPlainString() == "MyBehavior");
+    REQUIRE(actions[1].GetParameter(2).GetPlainString() ==
+            "MySprite.MyBehavior::GetBehaviorNumberWith1Param((4))");
+    REQUIRE(actions[2].GetType() ==
+            "MyEventsExtension::MyEventsBehavior::FreeActionMethod");
+  }
+}
@@ -6,9 +6,11 @@
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 #include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/Events/ExpressionNodeLocationFinder.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariableOwnerFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariablePathFinder.h"
@@ -3596,6 +3598,129 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
     }
   }
 
+  SECTION("Reparse an edited expression") {
+    // Reparsing must give the same nodes, locations and errors as parsing the
+    // edited expression from scratch.
+    auto requireSameAsParsing = [&](const gd::String &previousExpression,
+                                    const gd::String &expression) {
+      gd::ExpressionParser2 reparser;
+      auto reparsedNode = reparser.ReparseExpression(
+          previousExpression,
+          reparser.ParseExpression(previousExpression),
+          expression);
+      auto node = parser.ParseExpression(expression);
+      REQUIRE(reparsedNode != nullptr);
+      REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*reparsedNode) ==
+              gd::ExpressionParser2NodePrinter::PrintNode(*node));
+
+      gd::ExpressionValidator reparsedValidator(
+          platform, projectScopedContainers, "number");
+      reparsedNode->Visit(reparsedValidator);
+      gd::ExpressionValidator validator(
+          platform, projectScopedContainers, "number");
+      node->Visit(validator);
+      auto &reparsedErrors = reparsedValidator.GetAllErrors();
+      auto &errors = validator.GetAllErrors();
+      REQUIRE(reparsedErrors.size() == errors.size());
+      for (std::size_t i = 0; i < errors.size(); i++) {
+        REQUIRE(reparsedErrors[i]->GetMessage() == errors[i]->GetMessage());
+        REQUIRE(reparsedErrors[i]->GetStartPosition() ==
+                errors[i]->GetStartPosition());
+        REQUIRE(reparsedErrors[i]->GetEndPosition() ==
+                errors[i]->GetEndPosition());
+      }
+
+      for (std::size_t position = 0; position <= expression.size();
+           position++) {
+        auto reparsedNodeAtPosition =
+            gd::ExpressionNodeLocationFinder::GetNodeAtPosition(*reparsedNode,
+                                                                position);
+        auto nodeAtPosition =
+            gd::ExpressionNodeLocationFinder::GetNodeAtPosition(*node,
+                                                                position);
+        REQUIRE((reparsedNodeAtPosition == nullptr) ==
+                (nodeAtPosition == nullptr));
+        if (!nodeAtPosition) continue;
+
+        REQUIRE(reparsedNodeAtPosition->location.GetStartPosition() ==
+                nodeAtPosition->location.GetStartPosition());
+        REQUIRE(reparsedNodeAtPosition->location.GetEndPosition() ==
+                nodeAtPosition->location.GetEndPosition());
+        REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                    *reparsedNodeAtPosition) ==
+                gd::ExpressionParser2NodePrinter::PrintNode(*nodeAtPosition));
+        REQUIRE((reparsedNodeAtPosition->parent == nullptr) ==
+                (nodeAtPosition->parent == nullptr));
+      }
+    };
+
+    SECTION("Edits inside function calls and parenthesis") {
+      requireSameAsParsing("cos(1, 2) + 3", "cos(1, 23) + 3");
+      requireSameAsParsing("cos( 1 ) + 3", "cos(  1 ) + 3");
+      requireSameAsParsing("cos() + 3", "cos(1) + 3");
+      requireSameAsParsing("abs(cos(1) + sin(2)) * 2",
+                           "abs(cos(1) + sin(22)) * 2");
+      requireSameAsParsing("(1 + 2) * 3", "(1 + 24) * 3");
+      requireSameAsParsing("(1 + 2) * 3", "(1 + ) * 3");
+      requireSameAsParsing("1 + ToString(MySpriteObject.X()) + 2",
+                           "1 + ToString(MySpriteObject.Xy()) + 2");
+      requireSameAsParsing(
+          "MySpriteObject.MyBehavior::MyFunc(1, 2) + 3",
+          "MySpriteObject.MyBehavior::MyFunc(1, 2 + 4) + 3");
+      requireSameAsParsing("ToString(\"héllo\") + cos(1) + \"wörld\"",
+                           "ToString(\"héllo\") + cos(12) + \"wörld\"");
+      // "é" and "è" only differ by their last byte.
+      requireSameAsParsing("ToString(\"é\") + 1", "ToString(\"è\") + 1");
+      requireSameAsParsing("ToString(\"é\") + 1", "ToString(\"éè\") + 1");
+    }
+
+    SECTION("Edits of an expression parsed by another parser") {
+      gd::ExpressionParser2 reparser;
+      auto reparsedNode = reparser.ReparseExpression(
+          "cos(1) + ToString(\"é\")",
+          parser.ParseExpression("cos(1) + ToString(\"é\")"),
+          "cos(12) + ToString(\"é\")");
+      REQUIRE(reparsedNode != nullptr);
+      REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*reparsedNode) ==
+              "cos(12) + ToString(\"é\")");
+      REQUIRE(reparsedNode->location.GetEndPosition() == 23);
+    }
+
+    SECTION("Edits changing where function calls and parenthesis end") {
+      requireSameAsParsing("ToString(\"ab\") + 1", "ToString(\"a)b\") + 1");
+      requireSameAsParsing("ToString(\"ab\") + 1",
+                           "ToString(\"a\"b\") + 1");
+      requireSameAsParsing("cos(1) + 2", "cos(1 + 2");
+      requireSameAsParsing("cos(1 + 2", "cos(1) + 2");
+      requireSameAsParsing("(1 + 2) * 3", "(1 + 2)) * 3");
+      requireSameAsParsing("MySpriteObject.X(", "MySpriteObject.X()");
+    }
+
+    SECTION("Edits outside of function calls and parenthesis") {
+      requireSameAsParsing("cos(1)", "cos(1)");
+      requireSameAsParsing("cos(1)", "1 + cos(1)");
+      requireSameAsParsing("MySceneStructureVariable[\"MyChild\"] + cos(1)",
+                           "MySceneStructureVariable[\"MyChil\"] + cos(1)");
+    }
+
+    SECTION("Any character removed or inserted") {
+      std::vector<gd::String> expressions = {
+          "abs(cos(1, 2) + (3 * MySpriteObject.X())) - ToString(\"a(b)\")",
+          "MySpriteObject.MyBehavior::MyFunc(MySceneVariable, (1 + 2) * 3)",
+          "MySceneStructureVariable[\"MyChild\" + ToString(1)].MyChild + "
+          "ToString(  cos( 1 ),  )",
+      };
+      for (const auto &expression : expressions) {
+        for (std::size_t i = 0; i < expression.size(); i++) {
+          gd::String editedExpression =
+              expression.substr(0, i) + expression.substr(i + 1);
+          requireSameAsParsing(expression, editedExpression);
+          requireSameAsParsing(editedExpression, expression);
+        }
+      }
+    }
+  }
+
   SECTION("Location") {
     SECTION("Single node locations") {
       {
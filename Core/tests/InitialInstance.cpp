@@ -14,6 +14,9 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 
 TEST_CASE("InitialInstance", "[common][instances]") {
@@ -26,4 +29,54 @@ TEST_CASE("InitialInstance", "[common][instances]") {
   SECTION("GetRawStringProperty") {
     REQUIRE(instance.GetRawStringProperty("NotExistingProperty") == "");
   }
+
+  SECTION("Copies are independent once modified") {
+    instance.SetRawDoubleProperty("MyNumber", 1);
+    instance.SetRawStringProperty("MyString", "Hello");
+
+    gd::InitialInstance copy = instance;
+    REQUIRE(copy.GetRawDoubleProperty("MyNumber") == 1);
+    REQUIRE(copy.GetRawStringProperty("MyString") == "Hello");
+
+    copy.SetRawDoubleProperty("MyNumber", 2);
+    copy.SetRawStringProperty("MyString", "World");
+    REQUIRE(copy.GetRawDoubleProperty("MyNumber") == 2);
+    REQUIRE(copy.GetRawStringProperty("MyString") == "World");
+    REQUIRE(instance.GetRawDoubleProperty("MyNumber") == 1);
+    REQUIRE(instance.GetRawStringProperty("MyString") == "Hello");
+  }
+
+  SECTION("Variables can still be modified after the instance is copied") {
+    gd::VariablesContainer &variables = instance.GetVariables();
+    variables.InsertNew("MyVariable").SetValue(1);
+
+    gd::InitialInstance copy = instance;
+    variables.Get("MyVariable").SetValue(2);
+    REQUIRE(instance.GetVariables().Get("MyVariable").GetValue() == 2);
+    REQUIRE(copy.GetVariables().Get("MyVariable").GetValue() == 1);
+
+    copy.GetVariables().Get("MyVariable").SetValue(3);
+    REQUIRE(instance.GetVariables().Get("MyVariable").GetValue() == 2);
+  }
+
+  SECTION("Variables are unserialized") {
+    instance.GetVariables().InsertNew("MyVariable").SetValue(1);
+    gd::SerializerElement element;
+    instance.SerializeTo(element);
+
+    gd::InitialInstance unserializedInstance;
+    unserializedInstance.UnserializeFrom(element);
+    const auto &unserializedVariables =
+        static_cast<const gd::InitialInstance &>(unserializedInstance)
+            .GetVariables();
+    REQUIRE(unserializedVariables.Count() == 1);
+    REQUIRE(unserializedVariables.Get("MyVariable").GetValue() == 1);
+
+    // Unserializing an instance without variables removes them.
+    gd::InitialInstance instanceWithoutVariables;
+    gd::SerializerElement elementWithoutVariables;
+    instanceWithoutVariables.SerializeTo(elementWithoutVariables);
+    unserializedInstance.UnserializeFrom(elementWithoutVariables);
+    REQUIRE(unserializedInstance.GetVariables().Count() == 0);
+  }
 }
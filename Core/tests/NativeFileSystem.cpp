@@ -0,0 +1,108 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(EMSCRIPTEN) && !defined(WINDOWS)
+#include "GDCore/IDE/NativeFileSystem.h"
+
+#include <unistd.h>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("NativeFileSystem", "[common]") {
+  gd::NativeFileSystem fs(4);
+  gd::String testDir = fs.GetTempDir() + "/GDCoreTests-NativeFileSystem-" +
+                       gd::String::From(getpid());
+  fs.MkDir(testDir);
+  fs.ClearDir(testDir);
+
+  SECTION("Paths") {
+    REQUIRE(fs.FileNameFrom("/a/b/file.js") == "file.js");
+    REQUIRE(fs.FileNameFrom("file.js") == "file.js");
+    REQUIRE(fs.DirNameFrom("/a/b/file.js") == "/a/b");
+    REQUIRE(fs.DirNameFrom("/file.js") == "/");
+    REQUIRE(fs.DirNameFrom("file.js") == ".");
+    REQUIRE(fs.IsAbsolute("/a/b"));
+    REQUIRE(fs.IsAbsolute("C:/a/b"));
+    REQUIRE_FALSE(fs.IsAbsolute("a/b"));
+
+    gd::String filename = "../c/./file.js";
+    fs.MakeAbsolute(filename, "/a/b");
+    REQUIRE(filename == "/a/c/file.js");
+
+    fs.MakeRelative(filename, "/a/b/d");
+    REQUIRE(filename == "../../c/file.js");
+
+    filename = "/a/b/c/file.js";
+    fs.MakeRelative(filename, "/a/b");
+    REQUIRE(filename == "c/file.js");
+  }
+
+  SECTION("Write, read and copy files") {
+    fs.MkDir(testDir + "/sub/folder");
+    REQUIRE(fs.DirExists(testDir + "/sub/folder"));
+
+    REQUIRE(fs.WriteToFile(testDir + "/sub/file.txt", u8"Hello ԘWorld"));
+    REQUIRE(fs.FileExists(testDir + "/sub/file.txt"));
+    REQUIRE_FALSE(fs.FileExists(testDir + "/sub/folder"));
+    REQUIRE(fs.ReadFile(testDir + "/sub/file.txt") == u8"Hello ԘWorld");
+
+    // Missing directories are created.
+    REQUIRE(fs.CopyFile(testDir + "/sub/file.txt",
+                        testDir + "/other/folder/copy.txt"));
+    REQUIRE(fs.ReadFile(testDir + "/other/folder/copy.txt") ==
+            u8"Hello ԘWorld");
+
+    REQUIRE_FALSE(
+        fs.CopyFile(testDir + "/missing.txt", testDir + "/copy-missing.txt"));
+
+    std::vector<gd::String> files = fs.ReadDir(testDir + "/sub", ".TXT");
+    REQUIRE(files.size() == 1);
+    REQUIRE(files[0] == testDir + "/sub/file.txt");
+
+    REQUIRE(fs.ClearDir(testDir));
+    REQUIRE(fs.DirExists(testDir));
+    REQUIRE_FALSE(fs.DirExists(testDir + "/sub"));
+
+    // Directories are created again after being cleared.
+    REQUIRE(fs.WriteToFile(testDir + "/sub/file.txt", "Hello again"));
+    REQUIRE(fs.ReadFile(testDir + "/sub/file.txt") == "Hello again");
+  }
+
+  SECTION("Batch operations") {
+    std::vector<std::pair<gd::String, gd::String>> filesToWrite;
+    for (std::size_t i = 0; i < 50; ++i) {
+      filesToWrite.push_back(std::make_pair(
+          testDir + "/batch/folder" + gd::String::From(i % 5) + "/file" +
+              gd::String::From(i) + ".js",
+          "content " + gd::String::From(i)));
+    }
+
+    std::vector<gd::String> failedFiles;
+    REQUIRE(fs.WriteFiles(filesToWrite, failedFiles));
+    REQUIRE(failedFiles.empty());
+
+    std::vector<std::pair<gd::String, gd::String>> filesToCopy;
+    for (const auto &fileToWrite : filesToWrite) {
+      filesToCopy.push_back(std::make_pair(
+          fileToWrite.first,
+          testDir + "/batch-copy/" + fs.FileNameFrom(fileToWrite.first)));
+    }
+    filesToCopy.push_back(std::make_pair(testDir + "/missing.js",
+                                         testDir + "/batch-copy/missing.js"));
+
+    REQUIRE_FALSE(fs.CopyFiles(filesToCopy, failedFiles));
+    REQUIRE(failedFiles.size() == 1);
+    REQUIRE(failedFiles[0] == testDir + "/batch-copy/missing.js");
+
+    for (std::size_t i = 0; i < 50; ++i) {
+      REQUIRE(fs.ReadFile(testDir + "/batch-copy/file" + gd::String::From(i) +
+                          ".js") == "content " + gd::String::From(i));
+    }
+  }
+
+  fs.ClearDir(testDir);
+}
+#endif
@@ -7,6 +7,10 @@
  * @file Tests covering common features of GDevelop Core.
  */
 #include "GDCore/IDE/NewNameGenerator.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "GDCore/String.h"
 #include "catch.hpp"
 
@@ -29,4 +33,31 @@ TEST_CASE("NewNameGenerator", "[common]") {
                          name == "abcTest2";
                 }) == "abcTest3");
   }
+
+  SECTION("Generating a lot of names") {
+    gd::NewNamesGenerator newNamesGenerator({"Test", "abcTest", "abcTest3"});
+    REQUIRE(newNamesGenerator.Generate("Test", "abc") == "abcTest2");
+    REQUIRE(newNamesGenerator.Generate("Test", "abc") == "abcTest4");
+    REQUIRE(newNamesGenerator.Generate("Test", "abc") == "abcTest5");
+    REQUIRE(newNamesGenerator.Generate("Other") == "Other");
+    REQUIRE(newNamesGenerator.Generate("Other") == "Other2");
+
+    newNamesGenerator.AddName("abcTest6");
+    REQUIRE(newNamesGenerator.IsUsed("abcTest6"));
+    REQUIRE(newNamesGenerator.Generate("Test", "abc") == "abcTest7");
+
+    // Names are generated like with gd::NewNameGenerator::Generate.
+    std::vector<gd::String> existingNames;
+    gd::NewNamesGenerator otherNewNamesGenerator;
+    for (std::size_t i = 0; i < 50; ++i) {
+      gd::String expectedName = gd::NewNameGenerator::Generate(
+          "Enemy", "My", [&existingNames](const gd::String &name) {
+            return std::find(existingNames.begin(),
+                             existingNames.end(),
+                             name) != existingNames.end();
+          });
+      REQUIRE(otherNewNamesGenerator.Generate("Enemy", "My") == expectedName);
+      existingNames.push_back(expectedName);
+    }
+  }
 }
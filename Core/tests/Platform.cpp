@@ -0,0 +1,135 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Platform.h"
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+
+std::shared_ptr<gd::PlatformExtension> MakeExtension(const gd::String &name) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, name, "", "", "");
+  extension->AddObject<gd::ObjectConfiguration>("MyObject", "", "", "");
+  extension->AddBehavior("MyBehavior", "", "", "", "", "", "",
+                         std::make_shared<gd::Behavior>(),
+                         std::make_shared<gd::BehaviorsSharedData>());
+  extension->AddEvent(
+      "MyEvent", "", "", "", "", std::make_shared<gd::StandardEvent>());
+  return extension;
+}
+
+/**
+ * \brief Add a lazy extension, recording when it's declared.
+ */
+void AddLazyExtension(gd::Platform &platform,
+                      const gd::String &name,
+                      std::vector<gd::String> &declaredExtensionNames) {
+  platform.AddLazyExtension(name, [name, &declaredExtensionNames]() {
+    declaredExtensionNames.push_back(name);
+    return MakeExtension(name);
+  });
+}
+
+std::vector<gd::String> GetExtensionNames(const gd::Platform &platform) {
+  std::vector<gd::String> names;
+  for (const auto &extension : platform.GetAllPlatformExtensions())
+    names.push_back(extension->GetName());
+  return names;
+}
+
+}  // namespace
+
+TEST_CASE("Platform", "[common]") {
+  SECTION("Lazy extensions are declared when asked by their name") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensionNames;
+    AddLazyExtension(platform, "Extension1", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension2", declaredExtensionNames);
+
+    REQUIRE(platform.IsExtensionLoaded("Extension1"));
+    REQUIRE(platform.IsExtensionLoaded("Extension2"));
+    REQUIRE_FALSE(platform.IsExtensionLoaded("Extension3"));
+    REQUIRE(declaredExtensionNames.empty());
+
+    auto extension = platform.GetExtension("Extension2");
+    REQUIRE(extension != nullptr);
+    REQUIRE(extension->GetName() == "Extension2");
+    REQUIRE(declaredExtensionNames == std::vector<gd::String>{"Extension2"});
+
+    // Asking again doesn't declare it again.
+    REQUIRE(platform.GetExtension("Extension2") == extension);
+    REQUIRE(declaredExtensionNames.size() == 1);
+  }
+
+  SECTION("Objects, behaviors and events only declare their extension") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensionNames;
+    AddLazyExtension(platform, "Extension1", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension2", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension3", declaredExtensionNames);
+
+    REQUIRE(platform.CreateObjectConfiguration("Extension2::MyObject") !=
+            nullptr);
+    REQUIRE(declaredExtensionNames == std::vector<gd::String>{"Extension2"});
+
+    REQUIRE(!gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(platform,
+                                                  "Extension3::MyBehavior")));
+    REQUIRE(declaredExtensionNames ==
+            (std::vector<gd::String>{"Extension2", "Extension3"}));
+
+    REQUIRE(platform.CreateEvent("Extension1::MyEvent") != nullptr);
+    REQUIRE(declaredExtensionNames ==
+            (std::vector<gd::String>{
+                "Extension2", "Extension3", "Extension1"}));
+  }
+
+  SECTION("Extensions keep the order in which they were added") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensionNames;
+    AddLazyExtension(platform, "Extension1", declaredExtensionNames);
+    platform.AddExtension(MakeExtension("Extension2"));
+    AddLazyExtension(platform, "Extension3", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension4", declaredExtensionNames);
+
+    platform.GetExtension("Extension4");
+    REQUIRE(GetExtensionNames(platform) ==
+            (std::vector<gd::String>{
+                "Extension1", "Extension2", "Extension3", "Extension4"}));
+    REQUIRE(declaredExtensionNames ==
+            (std::vector<gd::String>{
+                "Extension4", "Extension1", "Extension3"}));
+  }
+
+  SECTION("Lazy extensions can be replaced or removed") {
+    gd::Platform platform;
+    std::vector<gd::String> declaredExtensionNames;
+    AddLazyExtension(platform, "Extension1", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension2", declaredExtensionNames);
+    AddLazyExtension(platform, "Extension3", declaredExtensionNames);
+
+    auto replacingExtension = MakeExtension("Extension1");
+    platform.AddExtension(replacingExtension);
+    platform.RemoveExtension("Extension2");
+    REQUIRE_FALSE(platform.IsExtensionLoaded("Extension2"));
+
+    REQUIRE(GetExtensionNames(platform) ==
+            (std::vector<gd::String>{"Extension3", "Extension1"}));
+    REQUIRE(platform.GetExtension("Extension1") == replacingExtension);
+    REQUIRE(declaredExtensionNames == std::vector<gd::String>{"Extension3"});
+  }
+}
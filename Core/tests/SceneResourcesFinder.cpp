@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+
+#include <set>
+#include <unordered_map>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+
+void AddEventUsingResources(gd::EventsList &events,
+                            const gd::String &bitmapFontResourceName,
+                            const gd::String &imageResourceName,
+                            const gd::String &audioResourceName) {
+  gd::StandardEvent standardEvent;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomethingWithResources");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, bitmapFontResourceName);
+  instruction.SetParameter(1, imageResourceName);
+  instruction.SetParameter(2, audioResourceName);
+  standardEvent.GetActions().Insert(instruction);
+  events.InsertEvent(standardEvent);
+}
+
+void AddLinkEvent(gd::EventsList &events, const gd::String &target) {
+  gd::LinkEvent linkEvent;
+  linkEvent.SetTarget(target);
+  events.InsertEvent(linkEvent);
+}
+
+}  // namespace
+
+TEST_CASE("SceneResourcesFinder", "[common][resources]") {
+  SECTION("Resources of every scene are found at once") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &resourcesManager = project.GetResourcesManager();
+    resourcesManager.AddResource("font1", "path/to/font1.fnt", "bitmapFont");
+    resourcesManager.AddResource("image1", "path/to/image1.png", "image");
+    resourcesManager.AddResource("image2", "path/to/image2.png", "image");
+    resourcesManager.AddResource("image3", "path/to/image3.png", "image");
+    resourcesManager.AddResource("image4", "path/to/image4.png", "image");
+    resourcesManager.AddResource("audio1", "path/to/audio1.aac", "audio");
+    resourcesManager.AddResource("audio2", "path/to/audio2.aac", "audio");
+
+    auto &scene1 = project.InsertNewLayout("Scene1", 0);
+    auto &scene2 = project.InsertNewLayout("Scene2", 1);
+    auto &scene3 = project.InsertNewLayout("Scene3", 2);
+    auto &scene4 = project.InsertNewLayout("Scene4", 3);
+    auto &sharedEvents = project.InsertNewExternalEvents("SharedEvents", 0);
+    auto &otherEvents = project.InsertNewExternalEvents("OtherEvents", 1);
+
+    AddEventUsingResources(scene1.GetEvents(), "", "image1", "");
+    AddEventUsingResources(scene2.GetEvents(), "", "image2", "");
+    AddEventUsingResources(sharedEvents.GetEvents(), "font1", "image3", "");
+    AddEventUsingResources(otherEvents.GetEvents(), "", "image4", "audio1");
+
+    // Scene1 and Scene2 both include the shared events, which include the
+    // other events. Scene3 includes the events of Scene2.
+    AddLinkEvent(scene1.GetEvents(), "SharedEvents");
+    AddLinkEvent(scene2.GetEvents(), "SharedEvents");
+    AddLinkEvent(sharedEvents.GetEvents(), "OtherEvents");
+    AddLinkEvent(scene3.GetEvents(), "Scene2");
+    // Scene4 includes itself, so its dependencies are ignored.
+    AddLinkEvent(scene4.GetEvents(), "Scene4");
+    AddLinkEvent(scene4.GetEvents(), "OtherEvents");
+
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventExtension", 0);
+    auto &function = extension.InsertNewEventsFunction("MyFreeFunction", 0);
+    AddEventUsingResources(function.GetEvents(), "", "", "audio2");
+
+    std::set<gd::String> projectResourceNames;
+    std::unordered_map<gd::String, std::set<gd::String>> scenesResourceNames;
+    gd::SceneResourcesFinder::FindProjectAndScenesResources(
+        project, projectResourceNames, scenesResourceNames);
+
+    REQUIRE(projectResourceNames.empty());
+    REQUIRE(scenesResourceNames.size() == 4);
+    REQUIRE(scenesResourceNames["Scene1"] ==
+            (std::set<gd::String>{
+                "font1", "image1", "image3", "image4", "audio1", "audio2"}));
+    REQUIRE(scenesResourceNames["Scene2"] ==
+            (std::set<gd::String>{
+                "font1", "image2", "image3", "image4", "audio1", "audio2"}));
+    REQUIRE(scenesResourceNames["Scene3"] ==
+            (std::set<gd::String>{
+                "font1", "image2", "image3", "image4", "audio1", "audio2"}));
+    REQUIRE(scenesResourceNames["Scene4"] ==
+            std::set<gd::String>{"audio2"});
+
+    // The results are the same as when scenes are analyzed one by one.
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+      auto &layout = project.GetLayout(i);
+      REQUIRE(scenesResourceNames[layout.GetName()] ==
+              gd::SceneResourcesFinder::FindSceneResources(project, layout));
+    }
+  }
+}
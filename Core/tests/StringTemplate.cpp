@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/StringTemplate.h"
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("StringTemplate", "[common]") {
+  SECTION("Placeholders are replaced by the values") {
+    gd::StringTemplate stringTemplate(
+        "NAME() { return this._data.NAME || DEFAULT; }",
+        {"NAME", "DEFAULT"});
+    REQUIRE(stringTemplate.GetPlaceholdersCount() == 3);
+    REQUIRE(stringTemplate.Render({"Speed", "0"}) ==
+            "Speed() { return this._data.Speed || 0; }");
+    REQUIRE(stringTemplate.Render({"Name", "\"\""}) ==
+            "Name() { return this._data.Name || \"\"; }");
+  }
+
+  SECTION("Texts without placeholders are kept as is") {
+    gd::StringTemplate stringTemplate("Hello world", {"NAME"});
+    REQUIRE(stringTemplate.GetPlaceholdersCount() == 0);
+    REQUIRE(stringTemplate.Render({"Speed"}) == "Hello world");
+    REQUIRE(gd::StringTemplate("", {"NAME"}).Render({"Speed"}) == "");
+  }
+
+  SECTION("The longest placeholder is used") {
+    gd::StringTemplate stringTemplate(
+        "PROPERTIES_CODE SHARED_PROPERTIES_CODE INITIALIZE_PROPERTIES_CODE",
+        {"PROPERTIES_CODE",
+         "INITIALIZE_PROPERTIES_CODE",
+         "SHARED_PROPERTIES_CODE"});
+    REQUIRE(stringTemplate.Render({"a", "b", "c"}) == "a c b");
+  }
+
+  SECTION("Placeholders can be next to other characters") {
+    gd::StringTemplate stringTemplate("_EXTENSION_NAME_CLASS_NAMESharedData",
+                                      {"EXTENSION_NAME", "CLASS_NAME"});
+    REQUIRE(stringTemplate.Render({"MyExtension", "MyBehavior"}) ==
+            "_MyExtension_MyBehaviorSharedData");
+  }
+
+  SECTION("Values are not searched for placeholders") {
+    gd::StringTemplate stringTemplate("NAME: VALUE", {"NAME", "VALUE"});
+    REQUIRE(stringTemplate.Render({"VALUE", "NAME"}) == "VALUE: NAME");
+  }
+
+  SECTION("Values can be UTF-8 strings") {
+    gd::StringTemplate stringTemplate(u8"«NAME»", {"NAME"});
+    REQUIRE(stringTemplate.Render({u8"Vitesse à l'écran"}) ==
+            u8"«Vitesse à l'écran»");
+  }
+
+  SECTION("Rendering can be appended to an existing string") {
+    gd::StringTemplate stringTemplate("NAME;", {"NAME"});
+    gd::String output = "start;";
+    stringTemplate.RenderTo(output, {"a"});
+    stringTemplate.RenderTo(output, {"b"});
+    REQUIRE(output == "start;a;b;");
+  }
+}
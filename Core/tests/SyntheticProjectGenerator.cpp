@@ -0,0 +1,176 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::String GenerateProjectJSON(const gd::SyntheticProjectOptions &options) {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  gd::SyntheticProjectGenerator::Generate(project, platform, options);
+
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  gd::String json = gd::Serializer::ToJSON(element);
+
+  // Persistent UUIDs are random: remove them.
+  const gd::String uuidAttribute = "\"persistentUuid\":\"";
+  for (std::size_t position = json.find(uuidAttribute);
+       position != gd::String::npos;
+       position = json.find(uuidAttribute, position)) {
+    const std::size_t uuidEnd =
+        json.find(U'"', position + uuidAttribute.size());
+    json.erase(position, uuidEnd + 1 - position);
+  }
+  return json;
+}
+
+/**
+ * Check that the expressions of the instructions have no errors.
+ */
+class InstructionsExpressionsChecker : public gd::ArbitraryEventsWorker {
+ public:
+  InstructionsExpressionsChecker(
+      const gd::Platform &platform_,
+      const gd::ProjectScopedContainers &projectScopedContainers_)
+      : platform(platform_),
+        projectScopedContainers(projectScopedContainers_),
+        instructionsCount(0),
+        invalidExpressionsCount(0){};
+  virtual ~InstructionsExpressionsChecker(){};
+
+  std::size_t instructionsCount;
+  std::size_t invalidExpressionsCount;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    instructionsCount++;
+    const gd::InstructionMetadata &metadata =
+        isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : gd::MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    for (std::size_t i = 0; i < metadata.GetParametersCount() &&
+                            i < instruction.GetParametersCount();
+         ++i) {
+      const gd::ParameterMetadata &parameterMetadata =
+          metadata.GetParameter(i);
+      if (!gd::ParameterMetadata::IsExpression("number",
+                                               parameterMetadata.GetType()) &&
+          parameterMetadata.GetType() != "string")
+        continue;
+
+      auto node = instruction.GetParameter(i).GetRootNode();
+      if (!gd::ExpressionValidator::HasNoErrors(platform,
+                                                projectScopedContainers,
+                                                parameterMetadata.GetType(),
+                                                *node))
+        invalidExpressionsCount++;
+    }
+    return false;
+  }
+
+  const gd::Platform &platform;
+  const gd::ProjectScopedContainers &projectScopedContainers;
+};
+
+}  // namespace
+
+TEST_CASE("SyntheticProjectGenerator", "[common]") {
+  SECTION("Generates a project with the requested sizes") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::SyntheticProjectOptions options;
+    options.scenesCount = 4;
+    options.objectsPerScene = 6;
+    options.groupsPerScene = 2;
+    options.instancesPerScene = 15;
+    options.eventsPerScene = 5;
+    options.eventsDepth = 2;
+    options.subEventsPerEvent = 3;
+    options.variablesPerScene = 3;
+    options.globalVariablesCount = 2;
+    options.externalEventsCount = 2;
+    options.eventsFunctionsExtensionsCount = 2;
+    options.eventsFunctionsPerExtension = 4;
+    gd::SyntheticProjectGenerator::Generate(project, platform, options);
+
+    REQUIRE(project.GetLayoutsCount() == 4);
+    REQUIRE(project.GetVariables().Count() == 2);
+    REQUIRE(project.GetExternalEventsCount() == 2);
+    REQUIRE(project.GetExternalEvents(1).GetAssociatedLayout() == "Scene1");
+    REQUIRE(project.GetEventsFunctionsExtensionsCount() == 2);
+    REQUIRE(project.GetEventsFunctionsExtension(1).GetEventsFunctionsCount() ==
+            4);
+
+    gd::Layout &layout = project.GetLayout(3);
+    REQUIRE(layout.GetObjects().GetObjectsCount() == 6);
+    REQUIRE(layout.GetObjects().GetObjectGroups().size() == 2);
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 15);
+    REQUIRE(layout.GetVariables().Count() == 3);
+
+    // 5 events, each with 3 sub-events, each with 3 sub-events.
+    REQUIRE(layout.GetEvents().GetEventsCount() == 5);
+    REQUIRE(layout.GetEvents().GetEvent(0).GetSubEvents().GetEventsCount() ==
+            3);
+    REQUIRE(layout.GetEvents()
+                .GetEvent(0)
+                .GetSubEvents()
+                .GetEvent(2)
+                .GetSubEvents()
+                .GetEventsCount() == 3);
+
+    // Scenes with external events have a link to them.
+    REQUIRE(project.GetLayout(0).GetEvents().GetEventsCount() == 6);
+    REQUIRE(project.GetLayout(2).GetEvents().GetEventsCount() == 5);
+
+    // Generated expressions are valid.
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(
+              project, project.GetLayout(i));
+      InstructionsExpressionsChecker checker(platform,
+                                             projectScopedContainers);
+      checker.Launch(project.GetLayout(i).GetEvents());
+
+      REQUIRE(checker.instructionsCount > 0);
+      REQUIRE(checker.invalidExpressionsCount == 0);
+    }
+  }
+
+  SECTION("Is deterministic") {
+    gd::SyntheticProjectOptions options;
+    options.seed = 42;
+    gd::String json = GenerateProjectJSON(options);
+    REQUIRE(json == GenerateProjectJSON(options));
+
+    options.seed = 43;
+    REQUIRE(json != GenerateProjectJSON(options));
+  }
+}
@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Tracing.h"
+
+#include <vector>
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/ThreadPool.h"
+#include "catch.hpp"
+
+namespace {
+
+class TestTraceEventsReceiver : public gd::TraceEventsReceiver {
+ public:
+  virtual void OnTraceEvent(const gd::TraceEvent &event) override {
+    events.push_back(event);
+  }
+
+  std::vector<gd::TraceEvent> events;
+};
+
+}  // namespace
+
+TEST_CASE("Tracing", "[common]") {
+  gd::Tracing::Clear();
+
+  SECTION("Nothing is recorded when disabled") {
+    REQUIRE_FALSE(gd::Tracing::IsEnabled());
+    { gd::TraceScope traceScope("Test", "Disabled", "Some detail"); }
+    REQUIRE(gd::Tracing::GetEventsCount() == 0);
+  }
+
+  SECTION("Nested spans are recorded") {
+    gd::Tracing::Enable();
+    {
+      gd::TraceScope traceScope("Test", "Parent");
+      { gd::TraceScope childTraceScope("Test", "Child", "Scene 1"); }
+    }
+    gd::Tracing::Disable();
+    REQUIRE(gd::Tracing::GetEventsCount() == 2);
+
+    gd::SerializerElement trace =
+        gd::Serializer::FromJSON(gd::Tracing::GetChromeTraceJSON());
+    gd::SerializerElement &events = trace.GetChild("traceEvents");
+    events.ConsiderAsArrayOf("traceEvent");
+    REQUIRE(events.GetChildrenCount() == 2);
+
+    // Spans are recorded when they end.
+    const gd::SerializerElement &child = events.GetChild(0);
+    const gd::SerializerElement &parent = events.GetChild(1);
+    REQUIRE(child.GetStringAttribute("name") == "Child");
+    REQUIRE(child.GetStringAttribute("cat") == "Test");
+    REQUIRE(child.GetStringAttribute("ph") == "X");
+    REQUIRE(child.GetChild("args").GetStringAttribute("detail") == "Scene 1");
+    REQUIRE(parent.GetStringAttribute("name") == "Parent");
+    REQUIRE(parent.GetDoubleAttribute("ts") <= child.GetDoubleAttribute("ts"));
+    REQUIRE(parent.GetDoubleAttribute("dur") >=
+            child.GetDoubleAttribute("dur"));
+
+    gd::Tracing::Clear();
+    REQUIRE(gd::Tracing::GetEventsCount() == 0);
+  }
+
+  SECTION("Spans can be sent to a receiver") {
+    TestTraceEventsReceiver receiver;
+    gd::Tracing::SetReceiver(&receiver);
+    gd::Tracing::Enable();
+    { gd::TraceScope traceScope("Test", "Received", "Some detail"); }
+    gd::Tracing::Disable();
+    gd::Tracing::SetReceiver(nullptr);
+
+    REQUIRE(gd::Tracing::GetEventsCount() == 0);
+    REQUIRE(receiver.events.size() == 1);
+    REQUIRE(receiver.events[0].GetName() == "Received");
+    REQUIRE(receiver.events[0].GetDetail() == "Some detail");
+    REQUIRE(receiver.events[0].GetDuration() >= 0);
+  }
+
+  SECTION("Spans can be recorded from several threads") {
+    gd::ThreadPool threadPool(4);
+    gd::Tracing::Enable();
+    for (std::size_t i = 0; i < 100; ++i) {
+      threadPool.Push([]() {
+        gd::TraceScope traceScope("Test", "Task");
+        { gd::TraceScope childTraceScope("Test", "Subtask"); }
+      });
+    }
+    threadPool.Wait();
+    gd::Tracing::Disable();
+
+    REQUIRE(gd::Tracing::GetEventsCount() == 200);
+    gd::Tracing::Clear();
+  }
+}
@@ -0,0 +1,101 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/UUID/UUID.h"
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("UUID", "[common]") {
+  SECTION("UUIDs are random version 4 UUIDs") {
+    gd::Uuid uuid = gd::Uuid::MakeUuid4();
+    REQUIRE_FALSE(uuid.IsEmpty());
+    REQUIRE(uuid != gd::Uuid::MakeUuid4());
+
+    gd::String text = uuid.ToString();
+    REQUIRE(text.size() == 36);
+    REQUIRE(text[8] == '-');
+    REQUIRE(text[13] == '-');
+    REQUIRE(text[14] == '4');
+    REQUIRE(text[18] == '-');
+    REQUIRE(text[23] == '-');
+  }
+
+  SECTION("UUIDs are written and read as text") {
+    gd::Uuid uuid =
+        gd::Uuid::FromString("3F2B8E4C-1f0a-4b5e-9c3d-7a6e5f4d3c2b");
+    REQUIRE(uuid.GetHigh() == 0x3f2b8e4c1f0a4b5eULL);
+    REQUIRE(uuid.GetLow() == 0x9c3d7a6e5f4d3c2bULL);
+    REQUIRE(uuid.ToString() == "3f2b8e4c-1f0a-4b5e-9c3d-7a6e5f4d3c2b");
+
+    gd::Uuid randomUuid = gd::Uuid::MakeUuid4();
+    REQUIRE(gd::Uuid::FromString(randomUuid.ToString()) == randomUuid);
+
+    REQUIRE(gd::Uuid::FromString("").IsEmpty());
+    REQUIRE(gd::Uuid::FromString("3f2b8e4c-1f0a").IsEmpty());
+    REQUIRE(gd::Uuid::FromString("3f2b8e4c-1f0a-4b5e-9c3d-7a6e5f4d3c2bff")
+                .IsEmpty());
+    REQUIRE(gd::Uuid::FromString("xf2b8e4c-1f0a-4b5e-9c3d-7a6e5f4d3c2b")
+                .IsEmpty());
+    REQUIRE(gd::Uuid().ToString() == "");
+  }
+
+  SECTION("UUIDs can be generated from a deterministic seed") {
+    gd::Uuid::SetDeterministicSeed(42);
+    gd::Uuid uuid1 = gd::Uuid::MakeUuid4();
+    gd::Uuid uuid2 = gd::Uuid::MakeUuid4();
+    REQUIRE(uuid1 != uuid2);
+
+    gd::Uuid::SetDeterministicSeed(42);
+    REQUIRE(gd::Uuid::MakeUuid4() == uuid1);
+    REQUIRE(gd::Uuid::MakeUuid4() == uuid2);
+  }
+
+  SECTION("Variables keep their UUID when serialized") {
+    gd::Variable variable;
+    variable.ResetPersistentUuid();
+    gd::Uuid uuid = variable.GetPersistentUuid();
+    REQUIRE_FALSE(uuid.IsEmpty());
+
+    gd::SerializerElement element;
+    variable.SerializeTo(element);
+    REQUIRE(element.GetStringAttribute("persistentUuid") == uuid.ToString());
+
+    gd::Variable unserializedVariable;
+    unserializedVariable.UnserializeFrom(element);
+    REQUIRE(unserializedVariable.GetPersistentUuid() == uuid);
+
+    variable.ClearPersistentUuid();
+    gd::SerializerElement clearedElement;
+    variable.SerializeTo(clearedElement);
+    REQUIRE_FALSE(clearedElement.HasAttribute("persistentUuid"));
+  }
+
+  SECTION("Instances generate their UUID when serialized") {
+    gd::InitialInstance instance;
+    gd::SerializerElement element1;
+    instance.SerializeTo(element1);
+    gd::SerializerElement element2;
+    instance.SerializeTo(element2);
+    gd::String uuid = element1.GetStringAttribute("persistentUuid");
+    REQUIRE(uuid.size() == 36);
+    REQUIRE(element2.GetStringAttribute("persistentUuid") == uuid);
+
+    gd::InitialInstance unserializedInstance;
+    unserializedInstance.UnserializeFrom(element1);
+    gd::SerializerElement element3;
+    unserializedInstance.SerializeTo(element3);
+    REQUIRE(element3.GetStringAttribute("persistentUuid") == uuid);
+
+    unserializedInstance.ResetPersistentUuid();
+    gd::SerializerElement element4;
+    unserializedInstance.SerializeTo(element4);
+    REQUIRE(element4.GetStringAttribute("persistentUuid").size() == 36);
+    REQUIRE(element4.GetStringAttribute("persistentUuid") != uuid);
+  }
+}
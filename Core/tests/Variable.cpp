@@ -91,6 +91,52 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+  SECTION("Copy and assignment of arrays") {
+    gd::Variable variable1;
+    variable1.CastTo(gd::Variable::Array);
+    variable1.PushNew().SetString("Hello World");
+    variable1.PushNew().SetValue(42);
+
+    gd::Variable variable2;
+    variable2.CastTo(gd::Variable::Array);
+    variable2.PushNew().SetValue(1);
+    variable2 = variable1;
+    gd::Variable variable3(variable1);
+
+    REQUIRE(variable2.GetChildrenCount() == 2);
+    REQUIRE(variable2.GetAtIndex(0).GetString() == "Hello World");
+    REQUIRE(variable2.GetAtIndex(1).GetValue() == 42);
+    REQUIRE(variable3.GetChildrenCount() == 2);
+    REQUIRE(variable3 == variable1);
+
+    variable2.GetAtIndex(1).SetValue(43);
+    REQUIRE(variable1.GetAtIndex(1).GetValue() == 42);
+
+    // Copying a primitive removes the children.
+    gd::Variable number;
+    number.SetValue(3);
+    variable2 = number;
+    REQUIRE(variable2.GetType() == gd::Variable::Number);
+    REQUIRE(variable2.GetAllChildren().empty());
+    REQUIRE(variable2.GetAllChildrenArray().empty());
+    REQUIRE(variable2.GetValue() == 3);
+  }
+  SECTION("Primitives have no children") {
+    gd::Variable variable;
+    variable.SetString("Hello");
+    REQUIRE(variable.GetChildrenCount() == 0);
+    REQUIRE(variable.HasChild("Child") == false);
+    REQUIRE(variable.GetAllChildren().empty());
+    REQUIRE(variable.GetAllChildrenArray().empty());
+    REQUIRE(variable.GetAllChildrenNames().empty());
+
+    const gd::Variable &constVariable = variable;
+    REQUIRE(&constVariable.GetAtIndex(0) == &gd::Variable::badVariable);
+    variable.RemoveChild("Child");
+    variable.RemoveAtIndex(0);
+    variable.MoveChildInArray(0, 1);
+    REQUIRE(variable.GetString() == "Hello");
+  }
   SECTION("Can find identical number variables") {
     gd::Variable variable;
     variable.SetValue(123);
@@ -1452,6 +1452,89 @@ TEST_CASE("WholeProjectRefactorer", "[common]") {
     }
   }
 
+  SECTION("Objects and groups renamed at once (in layout)") {
+    SECTION("Groups and initial instances") {
+      gd::Project project;
+      gd::Platform platform;
+      SetupProjectWithDummyPlatform(project, platform);
+      auto &layout1 = project.InsertNewLayout("Layout1", 0);
+      auto &externalLayout1 =
+          project.InsertNewExternalLayout("ExternalLayout1", 0);
+      externalLayout1.SetAssociatedLayout("Layout1");
+
+      gd::ObjectGroup group1;
+      group1.AddObject("Object1");
+      group1.AddObject("Object2");
+      group1.AddObject("GlobalObject1");
+      layout1.GetObjects().GetObjectGroups().Insert(group1);
+
+      layout1.GetObjects().InsertNewObject(
+          project, "MyExtension::Sprite", "Object1", 0);
+      layout1.GetObjects().InsertNewObject(
+          project, "MyExtension::Sprite", "Object2", 0);
+
+      gd::InitialInstance instance1;
+      instance1.SetObjectName("Object1");
+      gd::InitialInstance instance2;
+      instance2.SetObjectName("Object2");
+      gd::InitialInstance instance3;
+      instance3.SetObjectName("GlobalObject1");
+      layout1.GetInitialInstances().InsertInitialInstance(instance1);
+      layout1.GetInitialInstances().InsertInitialInstance(instance2);
+      layout1.GetInitialInstances().InsertInitialInstance(instance3);
+      externalLayout1.GetInitialInstances().InsertInitialInstance(instance2);
+
+      // Object2 takes the old name of Object1.
+      gd::WholeProjectRefactorer::ObjectsOrGroupsRenamedInScene(
+          project, layout1, {{"Object1", "Object3"}, {"Object2", "Object1"}});
+      gd::WholeProjectRefactorer::GlobalObjectsOrGroupsRenamed(
+          project, {{"GlobalObject1", "GlobalObject3"}});
+
+      auto &group = layout1.GetObjects().GetObjectGroups()[0];
+      REQUIRE(group.GetAllObjectsNames() ==
+              (std::vector<gd::String>{"Object3", "Object1", "GlobalObject3"}));
+
+      auto &instances = layout1.GetInitialInstances();
+      REQUIRE(instances.GetInstancesCount() == 3);
+      REQUIRE(instances.HasInstancesOfObject("Object1") == true);
+      REQUIRE(instances.HasInstancesOfObject("Object2") == false);
+      REQUIRE(instances.HasInstancesOfObject("Object3") == true);
+      REQUIRE(instances.HasInstancesOfObject("GlobalObject1") == false);
+      REQUIRE(instances.HasInstancesOfObject("GlobalObject3") == true);
+      REQUIRE(externalLayout1.GetInitialInstances().HasInstancesOfObject(
+                  "Object1") == true);
+      REQUIRE(externalLayout1.GetInitialInstances().HasInstancesOfObject(
+                  "Object2") == false);
+    }
+
+    SECTION("Events") {
+      gd::Project project;
+      gd::Platform platform;
+      SetupProjectWithDummyPlatform(project, platform);
+      auto &eventsExtension = SetupProjectWithEventsFunctionExtension(project);
+
+      auto &layout = project.GetLayout("Scene");
+
+      gd::WholeProjectRefactorer::ObjectsOrGroupsRenamedInScene(
+          project, layout,
+          {{"ObjectWithMyBehavior", "RenamedObjectWithMyBehavior"},
+           {"GroupWithMyBehavior", "RenamedGroupWithMyBehavior"}});
+
+      for (auto *eventsList : GetEventsListsAssociatedToScene(project)) {
+        REQUIRE(GetEventFirstActionFirstParameterString(eventsList->GetEvent(
+                    FreeFunctionWithObjects)) == "RenamedObjectWithMyBehavior");
+        REQUIRE(GetEventFirstActionFirstParameterString(
+                    eventsList->GetEvent(FreeFunctionWithObjectExpression)) ==
+                "RenamedObjectWithMyBehavior.GetObjectNumber() + RenamedObjectWithMyBehavior.MyVariable + RenamedObjectWithMyBehavior.MyStructureVariable.Child");
+        REQUIRE(GetEventFirstActionFirstParameterString(eventsList->GetEvent(
+                    FreeFunctionWithGroup)) == "RenamedGroupWithMyBehavior");
+        REQUIRE(GetEventFirstActionFirstParameterString(eventsList->GetEvent(
+                    FreeFunctionWithObjectExpressionOnGroup)) ==
+                "RenamedGroupWithMyBehavior.GetObjectNumber()");
+      }
+    }
+  }
+
   SECTION("Group renamed (in layout)") {
     SECTION("Events") {
       gd::Project project;
@@ -8,6 +8,8 @@
 #include "EventsCodeGenerator.h"
 #include "GDCore/Project/EventsBasedBehavior.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Tools/StringTemplate.h"
+#include "GDCore/Tools/Tracing.h"
 
 namespace gdjs {
 
@@ -21,6 +23,10 @@ gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorCompleteCode(
     const std::map<gd::String, gd::String>& behaviorMethodMangledNames,
     std::set<gd::String>& includeFiles,
     bool compilationForRuntime) {
+  gd::TraceScope traceScope("CodeGeneration",
+                            "GenerateRuntimeBehaviorCompleteCode",
+                            eventsFunctionsExtension.GetName(),
+                            eventsBasedBehavior.GetName());
   auto& eventsFunctionsVector =
       eventsBasedBehavior.GetEventsFunctions().GetInternalVector();
 
@@ -186,7 +192,7 @@ gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorTemplateCode(
     std::function<gd::String()> generateUpdateFromBehaviorDataCode,
     std::function<gd::String()> generateGetNetworkSyncDataCode,
     std::function<gd::String()> generateUpdateFromNetworkSyncDataCode) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate runtimeBehaviorTemplate(R"jscode_template(
 CODE_NAMESPACE = CODE_NAMESPACE || {};
 
 /**
@@ -259,163 +265,185 @@ CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.getSharedData = function(instanceConta
 METHODS_CODE
 
 gdjs.registerBehavior("EXTENSION_NAME::BEHAVIOR_NAME", CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME);
-)jscode_template")
-      .FindAndReplace("EXTENSION_NAME", extensionName)
-      .FindAndReplace("BEHAVIOR_NAME", eventsBasedBehavior.GetName())
-      .FindAndReplace("BEHAVIOR_FULL_NAME", eventsBasedBehavior.GetFullName())
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("INITIALIZE_SHARED_PROPERTIES_CODE",
-                      generateInitializeSharedPropertiesCode())
-      .FindAndReplace("INITIALIZE_PROPERTIES_CODE",
-                      generateInitializePropertiesCode())
-      .FindAndReplace("UPDATE_FROM_BEHAVIOR_DATA_CODE",
-                      generateUpdateFromBehaviorDataCode())
-      .FindAndReplace("GET_NETWORK_SYNC_DATA_CODE",
-                      generateGetNetworkSyncDataCode())
-      .FindAndReplace("UPDATE_FROM_NETWORK_SYNC_DATA_CODE",
-                      generateUpdateFromNetworkSyncDataCode())
-      // It must be done before PROPERTIES_CODE.
-      .FindAndReplace("SHARED_PROPERTIES_CODE", generateSharedPropertiesCode())
-      .FindAndReplace("PROPERTIES_CODE", generatePropertiesCode())
-      .FindAndReplace("METHODS_CODE", generateMethodsCode());
-  ;
+)jscode_template",
+      {"EXTENSION_NAME",
+       "BEHAVIOR_NAME",
+       "BEHAVIOR_FULL_NAME",
+       "RUNTIME_BEHAVIOR_CLASSNAME",
+       "CODE_NAMESPACE",
+       "INITIALIZE_SHARED_PROPERTIES_CODE",
+       "INITIALIZE_PROPERTIES_CODE",
+       "UPDATE_FROM_BEHAVIOR_DATA_CODE",
+       "GET_NETWORK_SYNC_DATA_CODE",
+       "UPDATE_FROM_NETWORK_SYNC_DATA_CODE",
+       "SHARED_PROPERTIES_CODE",
+       "PROPERTIES_CODE",
+       "METHODS_CODE"});
+
+  return runtimeBehaviorTemplate.Render(
+      {extensionName,
+       eventsBasedBehavior.GetName(),
+       eventsBasedBehavior.GetFullName(),
+       eventsBasedBehavior.GetName(),
+       codeNamespace,
+       generateInitializeSharedPropertiesCode(),
+       generateInitializePropertiesCode(),
+       generateUpdateFromBehaviorDataCode(),
+       generateGetNetworkSyncDataCode(),
+       generateUpdateFromNetworkSyncDataCode(),
+       generateSharedPropertiesCode(),
+       generatePropertiesCode(),
+       generateMethodsCode()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateInitializePropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._behaviorData.PROPERTY_NAME = behaviorData.PROPERTY_NAME !== undefined ? behaviorData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializePropertyTemplate(
+      R"jscode_template(
+    this._behaviorData.PROPERTY_NAME = behaviorData.PROPERTY_NAME !== undefined ? behaviorData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializePropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 
 gd::String BehaviorCodeGenerator::GenerateInitializeSharedPropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this.PROPERTY_NAME = sharedData.PROPERTY_NAME !== undefined ? sharedData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializeSharedPropertyTemplate(
+      R"jscode_template(
+    this.PROPERTY_NAME = sharedData.PROPERTY_NAME !== undefined ? sharedData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializeSharedPropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 
 gd::String
 BehaviorCodeGenerator::GenerateInitializePropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._behaviorData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializePropertyTemplate(
+      R"jscode_template(
+    this._behaviorData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializePropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 
 gd::String
 BehaviorCodeGenerator::GenerateInitializeSharedPropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializeSharedPropertyTemplate(
+      R"jscode_template(
+    this.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializeSharedPropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 
 gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorPropertyTemplateCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate propertyTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this._behaviorData.PROPERTY_NAME !== undefined ? this._behaviorData.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this._behaviorData.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("GETTER_NAME",
-                      GetBehaviorPropertyGetterName(property.GetName()))
-      .FindAndReplace("SETTER_NAME",
-                      GetBehaviorPropertySetterName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetBehaviorPropertyToggleFunctionName(property.GetName()),
-                     GetBehaviorPropertyGetterName(property.GetName()),
-                     GetBehaviorPropertySetterName(property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME", "GETTER_NAME", "SETTER_NAME", "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  const gd::String getterName =
+      GetBehaviorPropertyGetterName(property.GetName());
+  const gd::String setterName =
+      GetBehaviorPropertySetterName(property.GetName());
+  return propertyTemplate.Render(
+      {property.GetName(),
+       getterName,
+       setterName,
+       GeneratePropertyValueCode(property),
+       property.GetType() == "Boolean"
+           ? GenerateToggleBooleanPropertyTemplateCode(
+                 GetBehaviorPropertyToggleFunctionName(property.GetName()),
+                 getterName,
+                 setterName)
+           : ""});
 }
 
 gd::String BehaviorCodeGenerator::GenerateToggleBooleanPropertyTemplateCode(
     const gd::String& toggleFunctionName,
     const gd::String& getterName,
     const gd::String& setterName) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate toggleTemplate(
+      R"jscode_template(
   TOGGLE_NAME() {
     this.SETTER_NAME(!this.GETTER_NAME());
-  })jscode_template")
-      .FindAndReplace("TOGGLE_NAME", toggleFunctionName)
-      .FindAndReplace("GETTER_NAME", getterName)
-      .FindAndReplace("SETTER_NAME", setterName);
+  })jscode_template",
+      {"TOGGLE_NAME", "GETTER_NAME", "SETTER_NAME"});
+  return toggleTemplate.Render({toggleFunctionName, getterName, setterName});
 }
 
 gd::String
 BehaviorCodeGenerator::GenerateRuntimeBehaviorSharedPropertyTemplateCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate sharedPropertyTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this.PROPERTY_NAME !== undefined ? this.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace(
-          "GETTER_NAME",
-          GetBehaviorSharedPropertyGetterInternalName(property.GetName()))
-      .FindAndReplace(
-          "SETTER_NAME",
-          GetBehaviorSharedPropertySetterInternalName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetBehaviorSharedPropertyToggleFunctionInternalName(
-                         property.GetName()),
-                     GetBehaviorSharedPropertyGetterInternalName(
-                         property.GetName()),
-                     GetBehaviorSharedPropertySetterInternalName(
-                         property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME", "GETTER_NAME", "SETTER_NAME", "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  const gd::String getterName =
+      GetBehaviorSharedPropertyGetterInternalName(property.GetName());
+  const gd::String setterName =
+      GetBehaviorSharedPropertySetterInternalName(property.GetName());
+  return sharedPropertyTemplate.Render(
+      {property.GetName(),
+       getterName,
+       setterName,
+       GeneratePropertyValueCode(property),
+       property.GetType() == "Boolean"
+           ? GenerateToggleBooleanPropertyTemplateCode(
+                 GetBehaviorSharedPropertyToggleFunctionInternalName(
+                     property.GetName()),
+                 getterName,
+                 setterName)
+           : ""});
 }
 
 gd::String BehaviorCodeGenerator::GenerateUpdatePropertyFromBehaviorDataCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate updatePropertyTemplate(
+      R"jscode_template(
     if (oldBehaviorData.PROPERTY_NAME !== newBehaviorData.PROPERTY_NAME)
-      this._behaviorData.PROPERTY_NAME = newBehaviorData.PROPERTY_NAME;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+      this._behaviorData.PROPERTY_NAME = newBehaviorData.PROPERTY_NAME;)jscode_template",
+      {"PROPERTY_NAME"});
+  return updatePropertyTemplate.Render({property.GetName()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateGetPropertyNetworkSyncDataCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    PROPERTY_NAME: this._behaviorData.PROPERTY_NAME,)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+  static const gd::StringTemplate getPropertyNetworkSyncDataTemplate(
+      R"jscode_template(
+    PROPERTY_NAME: this._behaviorData.PROPERTY_NAME,)jscode_template",
+      {"PROPERTY_NAME"});
+  return getPropertyNetworkSyncDataTemplate.Render({property.GetName()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateUpdatePropertyFromNetworkSyncDataCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate updatePropertyFromNetworkSyncDataTemplate(
+      R"jscode_template(
     if (networkSyncData.props.PROPERTY_NAME !== undefined)
-      this._behaviorData.PROPERTY_NAME = networkSyncData.props.PROPERTY_NAME;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+      this._behaviorData.PROPERTY_NAME = networkSyncData.props.PROPERTY_NAME;)jscode_template",
+      {"PROPERTY_NAME"});
+  return updatePropertyFromNetworkSyncDataTemplate.Render(
+      {property.GetName()});
 }
 
 gd::String BehaviorCodeGenerator::GeneratePropertyValueCode(
@@ -439,29 +467,31 @@ gd::String BehaviorCodeGenerator::
     GenerateBehaviorOnDestroyToDeprecatedOnOwnerRemovedFromScene(
         const gd::EventsBasedBehavior& eventsBasedBehavior,
         const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate onDestroyTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.prototype.onDestroy = function() {
   // Redirect call to onOwnerRemovedFromScene (the old name of onDestroy)
   if (this.onOwnerRemovedFromScene) this.onOwnerRemovedFromScene();
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace);
+)jscode_template",
+      {"RUNTIME_BEHAVIOR_CLASSNAME", "CODE_NAMESPACE"});
+  return onDestroyTemplate.Render(
+      {eventsBasedBehavior.GetName(), codeNamespace});
 }
 
 gd::String BehaviorCodeGenerator::GenerateDefaultDoStepPreEventsFunctionCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate doStepPreEventsTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.prototype.doStepPreEvents = function() {
   PRELUDE_CODE
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("PRELUDE_CODE", GenerateDoStepPreEventsPreludeCode());
+)jscode_template",
+      {"RUNTIME_BEHAVIOR_CLASSNAME", "CODE_NAMESPACE", "PRELUDE_CODE"});
+  return doStepPreEventsTemplate.Render({eventsBasedBehavior.GetName(),
+                                         codeNamespace,
+                                         GenerateDoStepPreEventsPreludeCode()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateDoStepPreEventsPreludeCode() {
@@ -15,6 +15,8 @@
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/EventsFunctionInliner.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/Behavior.h"
@@ -28,6 +30,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertiesContainer.h"
+#include "GDJS/Events/Builtin/JsCodeEvent.h"
 #include "GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
@@ -36,7 +39,51 @@ using namespace std;
 
 namespace gdjs {
 
+namespace {
+
+/**
+ * Find if events could use the "eventsFunctionContext" of their function
+ * after the function returned: asynchronous actions keep it for their
+ * callbacks (or pass it to functions running later) and JavaScript code can
+ * keep a reference to it.
+ */
+class ContextUsedAfterReturnFinder : public gd::ReadOnlyArbitraryEventsWorker {
+ public:
+  ContextUsedAfterReturnFinder(const gd::Platform& platform_)
+      : platform(platform_), isContextUsedAfterReturn(false){};
+  virtual ~ContextUsedAfterReturnFinder(){};
+
+  bool IsContextUsedAfterReturn() const { return isContextUsedAfterReturn; }
+
+ private:
+  void DoVisitEvent(const gd::BaseEvent& event) override {
+    const JsCodeEvent* jsCodeEvent = dynamic_cast<const JsCodeEvent*>(&event);
+    if (jsCodeEvent &&
+        jsCodeEvent->GetInlineCode().find("eventsFunctionContext") !=
+            gd::String::npos) {
+      isContextUsedAfterReturn = true;
+      StopAnyEventIteration();
+    }
+  }
+
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    if (isCondition) return;
+    if (gd::MetadataProvider::GetActionMetadata(platform, instruction.GetType())
+            .IsAsync()) {
+      isContextUsedAfterReturn = true;
+      StopAnyEventIteration();
+    }
+  }
+
+  const gd::Platform& platform;
+  bool isContextUsedAfterReturn;
+};
+
+}  // namespace
+
 gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
+    const gd::Project& project,
     gdjs::EventsCodeGenerator& codeGenerator,
     gd::String fullyQualifiedFunctionName,
     gd::String functionArgumentsCode,
@@ -52,6 +99,10 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   // Preprocessing then code generation can make changes to the events, so we
   // need to do the work on a copy of the events.
   gd::EventsList generatedEvents = events;
+  gd::EventsFunctionInliner eventsFunctionInliner(codeGenerator.GetPlatform(),
+                                                  project);
+  eventsFunctionInliner.Launch(generatedEvents,
+                               codeGenerator.GetProjectScopedContainers());
   codeGenerator.PreprocessEventList(generatedEvents);
   gd::String wholeEventsCode =
       codeGenerator.GenerateEventsListCode(generatedEvents, context);
@@ -109,6 +160,7 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
+      project,
       codeGenerator,
       codeGenerator.GetCodeNamespaceAccessor() + "func",
       "runtimeScene",
@@ -145,6 +197,7 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
+      project,
       codeGenerator,
       codeGenerator.GetCodeNamespaceAccessor() + "func",
       codeGenerator.GenerateEventsFunctionParameterDeclarationsList(
@@ -228,6 +281,7 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
           "Behavior");
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
+      project,
       codeGenerator,
       fullyQualifiedFunctionName,
       codeGenerator.GenerateEventsFunctionParameterDeclarationsList(
@@ -319,6 +373,7 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
       "Object");
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
+      project,
       codeGenerator,
       fullyQualifiedFunctionName,
       codeGenerator.GenerateEventsFunctionParameterDeclarationsList(
@@ -376,16 +431,16 @@ gd::String EventsCodeGenerator::GenerateFreeEventsFunctionContext(
     const gd::EventsFunctionsExtension& eventsFunctionsExtension,
     const gd::EventsFunction& eventsFunction,
     const gd::String& onceTriggersVariable) {
-  gd::String objectsGettersMap;
-  gd::String objectArraysMap;
-  gd::String behaviorNamesMap;
+  std::vector<std::pair<gd::String, gd::String>> objectsLists;
+  std::vector<std::pair<gd::String, gd::String>> objectArrays;
+  std::vector<std::pair<gd::String, gd::String>> behaviorNames;
   return GenerateEventsFunctionContext(eventsFunctionsExtension,
                                        eventsFunctionsExtension,
                                        eventsFunction,
                                        onceTriggersVariable,
-                                       objectsGettersMap,
-                                       objectArraysMap,
-                                       behaviorNamesMap);
+                                       objectsLists,
+                                       objectArrays,
+                                       behaviorNames);
 }
 
 gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
@@ -397,27 +452,24 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
     const gd::String& thisBehaviorName) {
   // See the comment at the start of the GenerateEventsFunctionContext function
 
-  gd::String objectsGettersMap;
-  gd::String objectArraysMap;
-  gd::String behaviorNamesMap;
+  std::vector<std::pair<gd::String, gd::String>> objectsLists;
+  std::vector<std::pair<gd::String, gd::String>> objectArrays;
+  std::vector<std::pair<gd::String, gd::String>> behaviorNames;
 
   // If we have an object considered as the current object ("this") (usually
   // called Object in behavior events function), generate a slightly more
   // optimized getter for it (bypassing "Object" hashmap, and directly return
   // the array containing it).
   if (!thisObjectName.empty()) {
-    objectsGettersMap +=
-        ConvertToStringExplicit(thisObjectName) + ": " + thisObjectName + "\n";
-    objectArraysMap +=
-        ConvertToStringExplicit(thisObjectName) + ": thisObjectList\n";
+    objectsLists.push_back(std::make_pair(thisObjectName, thisObjectName));
+    objectArrays.push_back(std::make_pair(thisObjectName, "thisObjectList"));
   }
 
   if (!thisBehaviorName.empty()) {
     // If we have a behavior considered as the current behavior ("this")
     // (usually called Behavior in behavior events function), generate a
     // slightly more optimized getter for it.
-    behaviorNamesMap += ConvertToStringExplicit(thisBehaviorName) + ": " +
-                        thisBehaviorName + "\n";
+    behaviorNames.push_back(std::make_pair(thisBehaviorName, thisBehaviorName));
 
     // Add required behaviors from properties
     for (size_t i = 0;
@@ -425,15 +477,12 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
          i++) {
       const gd::NamedPropertyDescriptor& propertyDescriptor =
           eventsBasedBehavior.GetPropertyDescriptors().Get(i);
-      const std::vector<gd::String>& extraInfo =
-          propertyDescriptor.GetExtraInfo();
       if (propertyDescriptor.GetType() == "Behavior") {
         // Generate map that will be used to transform from behavior name used
         // in function to the "real" behavior name from the caller.
-        gd::String comma = behaviorNamesMap.empty() ? "" : ", ";
-        behaviorNamesMap +=
-            comma + ConvertToStringExplicit(propertyDescriptor.GetName()) +
-            ": this._get" + propertyDescriptor.GetName() + "()\n";
+        behaviorNames.push_back(
+            std::make_pair(propertyDescriptor.GetName(),
+                           "this._get" + propertyDescriptor.GetName() + "()"));
       }
     }
   }
@@ -442,9 +491,9 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
                                        eventsBasedBehavior.GetEventsFunctions(),
                                        eventsFunction,
                                        onceTriggersVariable,
-                                       objectsGettersMap,
-                                       objectArraysMap,
-                                       behaviorNamesMap,
+                                       objectsLists,
+                                       objectArrays,
+                                       behaviorNames,
                                        thisObjectName,
                                        thisBehaviorName);
 }
@@ -457,30 +506,25 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionContext(
     const gd::String& thisObjectName) {
   // See the comment at the start of the GenerateEventsFunctionContext function
 
-  gd::String objectsGettersMap;
-  gd::String objectArraysMap;
-  gd::String behaviorNamesMap;
+  std::vector<std::pair<gd::String, gd::String>> objectsLists;
+  std::vector<std::pair<gd::String, gd::String>> objectArrays;
+  std::vector<std::pair<gd::String, gd::String>> behaviorNames;
 
   // If we have an object considered as the current object ("this") (usually
   // called Object in behavior events function), generate a slightly more
   // optimized getter for it (bypassing "Object" hashmap, and directly return
   // the array containing it).
   if (!thisObjectName.empty()) {
-    objectsGettersMap +=
-        ConvertToStringExplicit(thisObjectName) + ": " + thisObjectName + "\n";
-    objectArraysMap +=
-        ConvertToStringExplicit(thisObjectName) + ": thisObjectList\n";
+    objectsLists.push_back(std::make_pair(thisObjectName, thisObjectName));
+    objectArrays.push_back(std::make_pair(thisObjectName, "thisObjectList"));
 
     // Add child-objects
     for (auto& childObject : eventsBasedObject.GetObjects().GetObjects()) {
       const auto& childName = ManObjListName(childObject->GetName());
       // child-object are never picked because they are not parameters.
-      objectsGettersMap += ", " +
-                           ConvertToStringExplicit(childObject->GetName()) +
-                           ": " + childName + "\n";
-      objectArraysMap += ", " +
-                         ConvertToStringExplicit(childObject->GetName()) +
-                         ": this" + childName + "List\n";
+      objectsLists.push_back(std::make_pair(childObject->GetName(), childName));
+      objectArrays.push_back(
+          std::make_pair(childObject->GetName(), "this" + childName + "List"));
     }
   }
 
@@ -488,9 +532,9 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionContext(
                                        eventsBasedObject.GetEventsFunctions(),
                                        eventsFunction,
                                        onceTriggersVariable,
-                                       objectsGettersMap,
-                                       objectArraysMap,
-                                       behaviorNamesMap,
+                                       objectsLists,
+                                       objectArrays,
+                                       behaviorNames,
                                        thisObjectName);
 }
 
@@ -499,9 +543,9 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
     const gd::EventsFunctionsContainer& eventsFunctionsContainer,
     const gd::EventsFunction& eventsFunction,
     const gd::String& onceTriggersVariable,
-    gd::String& objectsGettersMap,
-    gd::String& objectArraysMap,
-    gd::String& behaviorNamesMap,
+    std::vector<std::pair<gd::String, gd::String>>& objectsLists,
+    std::vector<std::pair<gd::String, gd::String>>& objectArrays,
+    std::vector<std::pair<gd::String, gd::String>>& behaviorNames,
     const gd::String& thisObjectName,
     const gd::String& thisBehaviorName) {
   const auto& extensionName = eventsFunctionsExtension.GetName();
@@ -520,7 +564,15 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
   // the parameter name).
   // * For other parameters, allow to access to them without transformation.
   // Conditions/expressions are available to deal with them in events.
-
+  //
+  // *Optimization*: functions can be called a lot (for example for each
+  // instance, at each frame) so the context must not be costly to create.
+  // Its methods are declared once, in a class, and its content is stored
+  // in objects and arrays that are reused: contexts are recycled in a pool
+  // (when they can't be used once the function returned) and the arrays of
+  // objects are only built when needed by the events.
+
+  std::vector<gd::String> argumentsValues;
   gd::String argumentsGetters;
 
   for (const auto& parameterPtr : parameters.GetInternalVector()) {
@@ -536,14 +588,11 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
       }
 
       // Generate map that will be used to get the lists of objects passed
-      // as parameters (either as objects lists or array).
-      gd::String comma = objectsGettersMap.empty() ? "" : ", ";
-      objectsGettersMap += comma +
-                           ConvertToStringExplicit(parameter.GetName()) + ": " +
-                           parameterMangledName + "\n";
-      objectArraysMap += comma + ConvertToStringExplicit(parameter.GetName()) +
-                         ": gdjs.objectsListsToArray(" + parameterMangledName +
-                         ")\n";
+      // as parameters (either as objects lists or array, built from the lists
+      // when first needed).
+      objectsLists.push_back(
+          std::make_pair(parameter.GetName(), parameterMangledName));
+      objectArrays.push_back(std::make_pair(parameter.GetName(), "null"));
     } else if (gd::ParameterMetadata::IsBehavior(parameter.GetType())) {
       if (parameter.GetName() == thisBehaviorName) {
         continue;
@@ -551,134 +600,219 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
 
       // Generate map that will be used to transform from behavior name used in
       // function to the "real" behavior name from the caller.
-      gd::String comma = behaviorNamesMap.empty() ? "" : ", ";
-      behaviorNamesMap += comma + ConvertToStringExplicit(parameter.GetName()) +
-                          ": " + parameterMangledName + "\n";
+      behaviorNames.push_back(
+          std::make_pair(parameter.GetName(), parameterMangledName));
     } else {
       argumentsGetters +=
-          "if (argName === " + ConvertToStringExplicit(parameter.GetName()) +
-          ") return " + parameterMangledName + ";\n";
+          "    if (argName === " +
+          ConvertToStringExplicit(parameter.GetName()) +
+          ") return this._arguments[" +
+          gd::String::From(argumentsValues.size()) + "];\n";
+      argumentsValues.push_back(parameterMangledName);
     }
   }
 
-  const gd::String async = eventsFunction.IsAsync()
-                               ? "  task: new gdjs.ManuallyResolvableTask(),\n"
-                               : "";
-
-  return gd::String("var eventsFunctionContext = {\n") +
-         // The async task, if there is one
-         async +
-         // The object name to parameter map:
-         "  _objectsMap: {\n" + objectsGettersMap +
-         "},\n"
-         // The object name to arrays map:
-         "  _objectArraysMap: {\n" +
-         objectArraysMap +
-         "},\n"
-         // The behavior name to parameter map:
-         "  _behaviorNamesMap: {\n" +
-         behaviorNamesMap +
-         "},\n"
-         "  globalVariablesForExtension: "
-         "runtimeScene.getGame().getVariablesForExtension(" +
-         ConvertToStringExplicit(extensionName) + "),\n" +
-         "  sceneVariablesForExtension: "
-         "runtimeScene.getScene().getVariablesForExtension(" +
-         ConvertToStringExplicit(extensionName) + "),\n" +
-         // The local variables stack:
-         "  localVariables: [],\n"
-         // Function that will be used to query objects, when a new object list
-         // is needed by events. We assume it's used a lot by the events
-         // generated code, so we cache the arrays in a map.
-         "  getObjects: function(objectName) {\n" +
-         "    return eventsFunctionContext._objectArraysMap[objectName] || "
-         "[];\n" +
-         "  },\n" +
-         // Function that can be used in JS code to get the lists of objects
-         // and filter/alter them (not actually used in events).
-         "  getObjectsLists: function(objectName) {\n" +
-         "    return eventsFunctionContext._objectsMap[objectName] || null;\n"
-         "  },\n" +
-         // Function that will be used to query behavior name (as behavior name
-         // can be different between the parameter name vs the actual behavior
-         // name passed as argument).
-         "  getBehaviorName: function(behaviorName) {\n" +
-         // TODO EBO Handle behavior name collision between parameters and
-         // children
-         "    return eventsFunctionContext._behaviorNamesMap[behaviorName] || "
-         "behaviorName;\n"
-         "  },\n" +
-         // Creator function that will be used to create new objects. We
-         // need to check if the function was given the context of the calling
-         // function (parentEventsFunctionContext). If this is the case, use it
-         // to create the new object as the object names used in the function
-         // are not the same as the objects available in the scene.
-         "  createObject: function(objectName) {\n"
-         "    const objectsList = "
-         "eventsFunctionContext._objectsMap[objectName];\n" +
-         // TODO: we could speed this up by storing a map of object names, but
-         // the cost of creating/storing it for each events function might not
-         // be worth it.
-         "    if (objectsList) {\n" +
-         "      const object = parentEventsFunctionContext ?\n" +
-         "        "
-         "parentEventsFunctionContext.createObject(objectsList.firstKey()) "
-         ":\n" +
-         "        runtimeScene.createObject(objectsList.firstKey());\n" +
-         // Add the new instance to object lists
-         "      if (object) {\n" +
-         "        objectsList.get(objectsList.firstKey()).push(object);\n" +
-         "        "
-         "eventsFunctionContext._objectArraysMap[objectName].push(object);\n" +
-         "      }\n" + "      return object;" + "    }\n" +
-         // Unknown object, don't create anything:
-         "    return null;\n" +
-         "  },\n"
-         // Function to count instances on the scene. We need it here because
-         // it needs the objects map to get the object names of the parent
-         // context.
-         "  getInstancesCountOnScene: function(objectName) {\n"
-         "    const objectsList = "
-         "eventsFunctionContext._objectsMap[objectName];\n" +
-         "    let count = 0;\n" + "    if (objectsList) {\n" +
-         "      for(const objectName in objectsList.items)\n" +
-         "        count += parentEventsFunctionContext ?\n" +
-         "parentEventsFunctionContext.getInstancesCountOnScene(objectName) "
-         ":\n" +
-         "        runtimeScene.getInstancesCountOnScene(objectName);\n" +
-         "    }\n" + "    return count;\n" +
-         "  },\n"
-         // Allow to get a layer directly from the context for convenience:
-         "  getLayer: function(layerName) {\n"
-         "    return runtimeScene.getLayer(layerName);\n"
-         "  },\n"
-         // Getter for arguments that are not objects
-         "  getArgument: function(argName) {\n" +
-         argumentsGetters + "    return \"\";\n" + "  },\n" +
-         // Expose OnceTriggers (will be pointing either to the runtime scene
-         // ones, or the ones from the behavior):
-         "  getOnceTriggers: function() { return " + onceTriggersVariable +
-         "; }\n" + "};\n";
+  const bool isAsync = eventsFunction.IsAsync();
+  const bool isRecyclable = IsEventsFunctionContextRecyclable(eventsFunction);
+  const gd::String contextClassName =
+      GetCodeNamespaceAccessor() + "EventsFunctionContext";
+  const gd::String contextsPoolName =
+      GetCodeNamespaceAccessor() + "eventsFunctionContextsPool";
+
+  // Generate the code clearing the context (so that it does not keep
+  // references to the objects, the scene...) and the code filling it for a
+  // call.
+  gd::String clearCode = isAsync ? "    this.task = null;\n" : "";
+  clearCode +=
+      "    this.globalVariablesForExtension = null;\n"
+      "    this.sceneVariablesForExtension = null;\n"
+      "    this.localVariables.length = 0;\n"
+      "    this._runtimeScene = null;\n"
+      "    this._parentEventsFunctionContext = null;\n"
+      "    this._onceTriggers = null;\n";
+  gd::String initializationCode =
+      isAsync ? "eventsFunctionContext.task = "
+                "new gdjs.ManuallyResolvableTask();\n"
+              : "";
+  initializationCode +=
+      "eventsFunctionContext.globalVariablesForExtension = "
+      "runtimeScene.getGame().getVariablesForExtension(" +
+      ConvertToStringExplicit(extensionName) + ");\n" +
+      "eventsFunctionContext.sceneVariablesForExtension = "
+      "runtimeScene.getScene().getVariablesForExtension(" +
+      ConvertToStringExplicit(extensionName) + ");\n" +
+      "eventsFunctionContext._runtimeScene = runtimeScene;\n"
+      "eventsFunctionContext._parentEventsFunctionContext = "
+      "parentEventsFunctionContext;\n"
+      "eventsFunctionContext._onceTriggers = " +
+      onceTriggersVariable + ";\n";
+  if (isRecyclable)
+    initializationCode += "eventsFunctionContext.returnValue = undefined;\n";
+
+  for (const auto& objectsList : objectsLists) {
+    const gd::String key = ConvertToStringExplicit(objectsList.first);
+    clearCode += "    this._objectsMap[" + key + "] = null;\n";
+    initializationCode += "eventsFunctionContext._objectsMap[" + key +
+                          "] = " + objectsList.second + ";\n";
+  }
+  for (const auto& objectArray : objectArrays) {
+    const gd::String key = ConvertToStringExplicit(objectArray.first);
+    clearCode += "    this._objectArraysMap[" + key + "] = null;\n";
+    if (objectArray.second != "null")
+      initializationCode += "eventsFunctionContext._objectArraysMap[" + key +
+                            "] = " + objectArray.second + ";\n";
+  }
+  for (const auto& behaviorName : behaviorNames) {
+    const gd::String key = ConvertToStringExplicit(behaviorName.first);
+    clearCode += "    this._behaviorNamesMap[" + key + "] = \"\";\n";
+    initializationCode += "eventsFunctionContext._behaviorNamesMap[" + key +
+                          "] = " + behaviorName.second + ";\n";
+  }
+  for (std::size_t i = 0; i < argumentsValues.size(); ++i) {
+    const gd::String index = gd::String::From(i);
+    clearCode += "    this._arguments[" + index + "] = null;\n";
+    initializationCode += "eventsFunctionContext._arguments[" + index +
+                          "] = " + argumentsValues[i] + ";\n";
+  }
+
+  AddCustomCodeOutsideMain(
+      contextClassName + " = class {\n" +
+      "  constructor() {\n"
+      "    this.returnValue = undefined;\n"
+      "    this.localVariables = [];\n"
+      "    this._objectsMap = {};\n"
+      "    this._objectArraysMap = {};\n"
+      "    this._behaviorNamesMap = {};\n"
+      "    this._arguments = [];\n"
+      "    this._clear();\n"
+      "  }\n"
+      "  _clear() {\n" +
+      clearCode +
+      "  }\n"
+      // Function that will be used to query objects, when a new object list
+      // is needed by events. We assume it's used a lot by the events
+      // generated code, so we cache the arrays in a map.
+      "  getObjects(objectName) {\n"
+      "    let objectsArray = this._objectArraysMap[objectName];\n"
+      "    if (objectsArray === null) {\n"
+      "      objectsArray = gdjs.objectsListsToArray("
+      "this._objectsMap[objectName]);\n"
+      "      this._objectArraysMap[objectName] = objectsArray;\n"
+      "    }\n"
+      "    return objectsArray || [];\n"
+      "  }\n"
+      // Function that can be used in JS code to get the lists of objects
+      // and filter/alter them (not actually used in events).
+      "  getObjectsLists(objectName) {\n"
+      "    return this._objectsMap[objectName] || null;\n"
+      "  }\n"
+      // Function that will be used to query behavior name (as behavior name
+      // can be different between the parameter name vs the actual behavior
+      // name passed as argument).
+      "  getBehaviorName(behaviorName) {\n"
+      // TODO EBO Handle behavior name collision between parameters and
+      // children
+      "    return this._behaviorNamesMap[behaviorName] || behaviorName;\n"
+      "  }\n"
+      // Creator function that will be used to create new objects. We
+      // need to check if the function was given the context of the calling
+      // function (parentEventsFunctionContext). If this is the case, use it
+      // to create the new object as the object names used in the function
+      // are not the same as the objects available in the scene.
+      "  createObject(objectName) {\n"
+      "    const objectsList = this._objectsMap[objectName];\n"
+      // TODO: we could speed this up by storing a map of object names, but
+      // the cost of creating/storing it for each events function might not
+      // be worth it.
+      "    if (objectsList) {\n"
+      "      const object = this._parentEventsFunctionContext ?\n"
+      "        this._parentEventsFunctionContext.createObject("
+      "objectsList.firstKey()) :\n"
+      "        this._runtimeScene.createObject(objectsList.firstKey());\n"
+      // Add the new instance to object lists (the array is only updated if
+      // it was already built from the lists).
+      "      if (object) {\n"
+      "        objectsList.get(objectsList.firstKey()).push(object);\n"
+      "        const objectsArray = this._objectArraysMap[objectName];\n"
+      "        if (objectsArray) objectsArray.push(object);\n"
+      "      }\n"
+      "      return object;\n"
+      "    }\n"
+      // Unknown object, don't create anything:
+      "    return null;\n"
+      "  }\n"
+      // Function to count instances on the scene. We need it here because
+      // it needs the objects map to get the object names of the parent
+      // context.
+      "  getInstancesCountOnScene(objectName) {\n"
+      "    const objectsList = this._objectsMap[objectName];\n"
+      "    let count = 0;\n"
+      "    if (objectsList) {\n"
+      "      for(const objectName in objectsList.items)\n"
+      "        count += this._parentEventsFunctionContext ?\n"
+      "          this._parentEventsFunctionContext.getInstancesCountOnScene("
+      "objectName) :\n"
+      "          this._runtimeScene.getInstancesCountOnScene(objectName);\n"
+      "    }\n"
+      "    return count;\n"
+      "  }\n"
+      // Allow to get a layer directly from the context for convenience:
+      "  getLayer(layerName) {\n"
+      "    return this._runtimeScene.getLayer(layerName);\n"
+      "  }\n"
+      // Getter for arguments that are not objects
+      "  getArgument(argName) {\n" +
+      argumentsGetters +
+      "    return \"\";\n"
+      "  }\n"
+      // Expose OnceTriggers (will be pointing either to the runtime scene
+      // ones, or the ones from the behavior):
+      "  getOnceTriggers() { return this._onceTriggers; }\n"
+      "};\n" +
+      (isRecyclable ? contextsPoolName + " = [];\n" : ""));
+
+  return gd::String("var eventsFunctionContext = ") +
+         (isRecyclable ? contextsPoolName + ".pop() || " : "") + "new " +
+         contextClassName + "();\n" + initializationCode;
 }
 
 gd::String EventsCodeGenerator::GenerateEventsFunctionReturn(
     const gd::EventsFunction& eventsFunction) {
   if (eventsFunction.IsAsync()) return "return eventsFunctionContext.task";
+
+  // Give back the context to the pool, now that events are done with it. The
+  // return value is kept by the context until it's reused.
+  const gd::String releaseCode =
+      IsEventsFunctionContextRecyclable(eventsFunction)
+          ? "eventsFunctionContext._clear();\n" + GetCodeNamespaceAccessor() +
+                "eventsFunctionContextsPool.push(eventsFunctionContext);\n"
+          : "";
+
   // We don't use IsCondition because ExpressionAndCondition event functions
   // don't need a boolean function. They use the expression function with a
   // relational operator.
   if (eventsFunction.GetFunctionType() == gd::EventsFunction::Condition) {
-    return "return !!eventsFunctionContext.returnValue;";
+    return releaseCode + "return !!eventsFunctionContext.returnValue;";
   } else if (eventsFunction.IsExpression()) {
     if (eventsFunction.GetExpressionType().IsNumber()) {
-      return "return Number(eventsFunctionContext.returnValue) || 0;";
+      return releaseCode +
+             "return Number(eventsFunctionContext.returnValue) || 0;";
     } else {
       // Default on string because it's more likely that future expression
       // types are strings.
-      return "return \"\" + eventsFunctionContext.returnValue;";
+      return releaseCode + "return \"\" + eventsFunctionContext.returnValue;";
     }
   }
-  return "return;";
+  return releaseCode + "return;";
+}
+
+bool EventsCodeGenerator::IsEventsFunctionContextRecyclable(
+    const gd::EventsFunction& eventsFunction) {
+  if (eventsFunction.IsAsync()) return false;
+
+  ContextUsedAfterReturnFinder finder(GetPlatform());
+  finder.Launch(eventsFunction.GetEvents());
+  return !finder.IsContextUsedAfterReturn();
 }
 
 std::pair<gd::String, gd::String>
@@ -1054,6 +1188,38 @@ gd::String EventsCodeGenerator::GetObjectListName(
          gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
 }
 
+gd::String EventsCodeGenerator::GenerateObjectsListsLoop(
+    const std::vector<gd::String>& objectsListNames,
+    const std::function<gd::String(const gd::String& objectsList)>&
+        generateCode) {
+  //*Optimization:* the objects lists are always the same static arrays (see
+  // GenerateObject), so the array of them is declared once and shared by all
+  // the instructions using the same objects lists.
+  gd::String arrayContent;
+  for (auto& objectsListName : objectsListNames) {
+    if (!arrayContent.empty()) arrayContent += ", ";
+    arrayContent += objectsListName;
+  }
+
+  auto it = objectsListsArrays.find(arrayContent);
+  if (it == objectsListsArrays.end()) {
+    gd::String arrayName = GetCodeNamespaceAccessor() + "objectsListsArray" +
+                           gd::String::From(objectsListsArrays.size());
+    AddCustomCodeOutsideMain(arrayName + " = [" + arrayContent + "];\n");
+    it = objectsListsArrays.insert(std::make_pair(arrayContent, arrayName))
+             .first;
+  }
+  const gd::String& arrayName = it->second;
+
+  gd::String loopCode;
+  loopCode += "for (var groupIndex = 0; groupIndex < " + arrayName +
+              ".length; ++groupIndex) {\n";
+  loopCode += "const groupObjectsList = " + arrayName + "[groupIndex];\n";
+  loopCode += generateCode("groupObjectsList");
+  loopCode += "}\n";
+  return loopCode;
+}
+
 gd::String EventsCodeGenerator::GenerateGetBehaviorNameCode(
     const gd::String& behaviorName) {
   if (HasProjectAndLayout()) {
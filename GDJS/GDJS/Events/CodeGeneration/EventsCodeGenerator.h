@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -196,6 +197,15 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   virtual gd::String GetObjectListName(
       const gd::String& name, const gd::EventsCodeGenerationContext& context) override;
 
+  /**
+   * \brief Generate a loop over an array of the objects lists, declared once
+   * outside of the events.
+   */
+  virtual gd::String GenerateObjectsListsLoop(
+      const std::vector<gd::String>& objectsListNames,
+      const std::function<gd::String(const gd::String& objectsList)>&
+          generateCode) override;
+
   /**
    * \brief Get the namespace to be used to store code generated
    * objects/values/functions, with the extra "dot" at the end to be used to
@@ -358,7 +368,13 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
     const gd::String& rhs) override;
 
  private:
+  /**
+   * \brief Generate the code of a function running the events, after
+   * inlining the calls to small events functions of the project (see
+   * gd::EventsFunctionInliner).
+   */
   static gd::String GenerateEventsListCompleteFunctionCode(
+      const gd::Project& project,
       gdjs::EventsCodeGenerator& codeGenerator,
       gd::String fullyQualifiedFunctionName,
       gd::String functionArgumentsCode,
@@ -431,9 +447,25 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& onceTriggersVariable,
       const gd::String& thisObjectName);
 
+  /**
+   * \brief Generate the code returning the value of an events function, and
+   * giving back its "eventsFunctionContext" to the pool of contexts when it can
+   * be recycled.
+   */
   gd::String GenerateEventsFunctionReturn(
       const gd::EventsFunction& eventFunction);
 
+  /**
+   * \brief Check if the "eventsFunctionContext" of a function can be reused
+   * for the next calls once the function returned.
+   *
+   * It's not the case when the function is asynchronous, or if its events
+   * could use the context after the function returned (asynchronous actions,
+   * JavaScript code referring to the context).
+   */
+  bool IsEventsFunctionContextRecyclable(
+      const gd::EventsFunction& eventsFunction);
+
   /**
    * \brief Construct a code generator for the specified project and layout.
    */
@@ -447,23 +479,37 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
+  std::map<gd::String, gd::String>
+      objectsListsArrays;  ///< The names of the arrays of objects lists
+                           ///< declared by GenerateObjectsListsLoop, by their
+                           ///< content.
 
  private:
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
    * to provides access objects, object creation and access to arguments from
    * the rest of the events.
+   *
+   * The context is an instance of a class declared once for the function
+   * (outside of the function code), taken from a pool when it can be recycled.
+   *
+   * \param objectsLists The code of the objects lists of the objects that are
+   * not parameters of the function, by object name.
+   * \param objectArrays The code of the arrays of these objects, by object
+   * name. Arrays of objects parameters are built only when first needed.
+   * \param behaviorNames The code of the names of the behaviors that are not
+   * parameters of the function, by behavior name.
    */
-   gd::String GenerateEventsFunctionContext(
-       const gd::EventsFunctionsExtension &eventsFunctionsExtension,
-       const gd::EventsFunctionsContainer &eventsFunctionsContainer,
-       const gd::EventsFunction &eventsFunction,
-       const gd::String &onceTriggersVariable,
-       gd::String &objectsGettersMap,
-       gd::String &objectArraysMap,
-       gd::String &behaviorNamesMap,
-       const gd::String &thisObjectName = "",
-       const gd::String &thisBehaviorName = "");
+  gd::String GenerateEventsFunctionContext(
+      const gd::EventsFunctionsExtension& eventsFunctionsExtension,
+      const gd::EventsFunctionsContainer& eventsFunctionsContainer,
+      const gd::EventsFunction& eventsFunction,
+      const gd::String& onceTriggersVariable,
+      std::vector<std::pair<gd::String, gd::String>>& objectsLists,
+      std::vector<std::pair<gd::String, gd::String>>& objectArrays,
+      std::vector<std::pair<gd::String, gd::String>>& behaviorNames,
+      const gd::String& thisObjectName = "",
+      const gd::String& thisBehaviorName = "");
 };
 
 }  // namespace gdjs
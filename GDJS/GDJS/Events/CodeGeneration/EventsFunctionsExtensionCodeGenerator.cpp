@@ -7,6 +7,8 @@
 
 #include "EventsCodeGenerator.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/StringTemplate.h"
+#include "GDCore/Tools/Tracing.h"
 
 namespace gdjs {
 gd::String
@@ -16,15 +18,21 @@ EventsFunctionsExtensionCodeGenerator::GenerateFreeEventsFunctionCompleteCode(
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
     bool compilationForRuntime) {
-  gd::String lifecycleCleanupCode =
-      gd::String(R"jscode_template(
+  gd::TraceScope traceScope("CodeGeneration",
+                            "GenerateFreeEventsFunctionCompleteCode",
+                            extension.GetName(),
+                            eventsFunction.GetName());
+  static const gd::StringTemplate lifecycleCleanupTemplate(
+      R"jscode_template(
 if (typeof CODE_NAMESPACE !== "undefined") {
   CODE_NAMESPACE.registeredGdjsCallbacks.forEach(callback =>
     gdjs._unregisterCallback(callback)
   );
 }
-)jscode_template")
-          .FindAndReplace("CODE_NAMESPACE", codeNamespace);
+)jscode_template",
+      {"CODE_NAMESPACE"});
+  gd::String lifecycleCleanupCode =
+      lifecycleCleanupTemplate.Render({codeNamespace});
 
   gd::String eventsFunctionCode =
       EventsCodeGenerator::GenerateEventsFunctionCode(project,
@@ -34,10 +42,8 @@ if (typeof CODE_NAMESPACE !== "undefined") {
                                                       includeFiles,
                                                       compilationForRuntime);
 
-  gd::String lifecycleRegistrationCode = "";
-  lifecycleRegistrationCode +=
-      gd::String("CODE_NAMESPACE.registeredGdjsCallbacks = [];")
-          .FindAndReplace("CODE_NAMESPACE", codeNamespace);
+  gd::String lifecycleRegistrationCode =
+      codeNamespace + ".registeredGdjsCallbacks = [];";
 
   if (gd::EventsFunctionsExtension::IsExtensionLifecycleEventsFunction(
           eventsFunction.GetName())) {
@@ -65,16 +71,18 @@ gd::String EventsFunctionsExtensionCodeGenerator::
     return "";
   }
 
-  auto generateCallbackRegistrationCode =
-      [&](const gd::String& registerFunctionName) {
-        return gd::String(R"jscode_template(
+  static const gd::StringTemplate callbackRegistrationTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.registeredGdjsCallbacks.push((runtimeScene) => {
     CODE_NAMESPACE.func(runtimeScene, runtimeScene);
 })
 gdjs.REGISTER_FUNCTION_NAME(CODE_NAMESPACE.registeredGdjsCallbacks[CODE_NAMESPACE.registeredGdjsCallbacks.length - 1]);
-)jscode_template")
-            .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-            .FindAndReplace("REGISTER_FUNCTION_NAME", registerFunctionName);
+)jscode_template",
+      {"CODE_NAMESPACE", "REGISTER_FUNCTION_NAME"});
+  auto generateCallbackRegistrationCode =
+      [&](const gd::String& registerFunctionName) {
+        return callbackRegistrationTemplate.Render(
+            {codeNamespace, registerFunctionName});
       };
 
   if (eventsFunctionName == "onFirstSceneLoaded") {
@@ -8,6 +8,8 @@
 #include "EventsCodeGenerator.h"
 #include "GDCore/Project/EventsBasedObject.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Tools/StringTemplate.h"
+#include "GDCore/Tools/Tracing.h"
 
 namespace gdjs {
 
@@ -24,6 +26,10 @@ gd::String ObjectCodeGenerator::GenerateRuntimeObjectCompleteCode(
     const std::map<gd::String, gd::String>& objectMethodMangledNames,
     std::set<gd::String>& includeFiles,
     bool compilationForRuntime) {
+  gd::TraceScope traceScope("CodeGeneration",
+                            "GenerateRuntimeObjectCompleteCode",
+                            eventsFunctionsExtension.GetName(),
+                            eventsBasedObject.GetName());
   auto& eventsFunctionsVector =
       eventsBasedObject.GetEventsFunctions().GetInternalVector();
 
@@ -115,13 +121,18 @@ gd::String ObjectCodeGenerator::GenerateRuntimeObjectCompleteCode(
       },
       // generateInitializeAnimatableCode
       [&]() {
-        return gd::String(R"jscode_template(
+        static const gd::StringTemplate initializeAnimatableTemplate(
+            R"jscode_template(
     this._animator = new gdjs.SpriteAnimator(
         objectData.animatable.animations,
         gdjs.RENDERER_CLASS_NAME.getAnimationFrameTextureManager(
             parentInstanceContainer.getGame().getImageManager()));
-)jscode_template")
-      .FindAndReplace("RENDERER_CLASS_NAME", eventsBasedObject.IsRenderedIn3D() ? "CustomRuntimeObject3DRenderer" : "CustomRuntimeObject2DRenderer");
+)jscode_template",
+            {"RENDERER_CLASS_NAME"});
+        return initializeAnimatableTemplate.Render(
+            {eventsBasedObject.IsRenderedIn3D()
+                 ? "CustomRuntimeObject3DRenderer"
+                 : "CustomRuntimeObject2DRenderer"});
       },
       // generateAnimatableCode
       [&]() {
@@ -197,7 +208,7 @@ gd::String ObjectCodeGenerator::GenerateRuntimeObjectTemplateCode(
     std::function<gd::String()> generateInitializeAnimatableCode,
     std::function<gd::String()> generateAnimatableCode,
     std::function<gd::String()> generateTextContainerCode) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate runtimeObjectTemplate(R"jscode_template(
 CODE_NAMESPACE = CODE_NAMESPACE || {};
 
 /**
@@ -237,92 +248,108 @@ CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME = class RUNTIME_OBJECT_CLASSNAME extends
 METHODS_CODE
 
 gdjs.registerObject("EXTENSION_NAME::OBJECT_NAME", CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME);
-)jscode_template")
-      .FindAndReplace("EXTENSION_NAME", extensionName)
-      .FindAndReplace("OBJECT_NAME", eventsBasedObject.GetName())
-      .FindAndReplace("OBJECT_FULL_NAME", eventsBasedObject.GetFullName())
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace("RUNTIME_OBJECT_BASE_CLASS_NAME",
-                      eventsBasedObject.IsRenderedIn3D() ? "gdjs.CustomRuntimeObject3D" : "gdjs.CustomRuntimeObject2D")
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("INITIALIZE_PROPERTIES_CODE",
-                      generateInitializePropertiesCode())
-      .FindAndReplace("INITIALIZE_ANIMATABLE_CODE",
-                      eventsBasedObject.IsAnimatable()
-                          ? generateInitializeAnimatableCode()
-                          : "")
-      .FindAndReplace("UPDATE_FROM_OBJECT_DATA_CODE", generateUpdateFromObjectDataCode())
-      .FindAndReplace("PROPERTIES_CODE", generatePropertiesCode())
-      .FindAndReplace("ANIMATABLE_CODE", eventsBasedObject.IsAnimatable() ? generateAnimatableCode() : "")
-      .FindAndReplace("TEXT_CONTAINER_CODE", eventsBasedObject.IsTextContainer() ? generateTextContainerCode() : "")
-      .FindAndReplace("METHODS_CODE", generateMethodsCode());
-  ;
+)jscode_template",
+      {"EXTENSION_NAME",
+       "OBJECT_NAME",
+       "OBJECT_FULL_NAME",
+       "RUNTIME_OBJECT_CLASSNAME",
+       "RUNTIME_OBJECT_BASE_CLASS_NAME",
+       "CODE_NAMESPACE",
+       "INITIALIZE_PROPERTIES_CODE",
+       "INITIALIZE_ANIMATABLE_CODE",
+       "UPDATE_FROM_OBJECT_DATA_CODE",
+       "PROPERTIES_CODE",
+       "ANIMATABLE_CODE",
+       "TEXT_CONTAINER_CODE",
+       "METHODS_CODE"});
+
+  return runtimeObjectTemplate.Render(
+      {extensionName,
+       eventsBasedObject.GetName(),
+       eventsBasedObject.GetFullName(),
+       eventsBasedObject.GetName(),
+       eventsBasedObject.IsRenderedIn3D() ? "gdjs.CustomRuntimeObject3D"
+                                          : "gdjs.CustomRuntimeObject2D",
+       codeNamespace,
+       generateInitializePropertiesCode(),
+       eventsBasedObject.IsAnimatable() ? generateInitializeAnimatableCode()
+                                        : "",
+       generateUpdateFromObjectDataCode(),
+       generatePropertiesCode(),
+       eventsBasedObject.IsAnimatable() ? generateAnimatableCode() : "",
+       eventsBasedObject.IsTextContainer() ? generateTextContainerCode() : "",
+       generateMethodsCode()});
 }
 // TODO these 2 methods are probably not needed if the properties are merged by GDJS.
 gd::String ObjectCodeGenerator::GenerateInitializePropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._objectData.PROPERTY_NAME = objectData.content.PROPERTY_NAME !== undefined ? objectData.content.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializePropertyTemplate(
+      R"jscode_template(
+    this._objectData.PROPERTY_NAME = objectData.content.PROPERTY_NAME !== undefined ? objectData.content.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializePropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 gd::String
 ObjectCodeGenerator::GenerateInitializePropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._objectData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::StringTemplate initializePropertyTemplate(
+      R"jscode_template(
+    this._objectData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return initializePropertyTemplate.Render(
+      {property.GetName(), GeneratePropertyValueCode(property)});
 }
 
 gd::String ObjectCodeGenerator::GenerateRuntimeObjectPropertyTemplateCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate propertyTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this._objectData.PROPERTY_NAME !== undefined ? this._objectData.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this._objectData.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("GETTER_NAME",
-                      GetObjectPropertyGetterName(property.GetName()))
-      .FindAndReplace("SETTER_NAME",
-                      GetObjectPropertySetterName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetObjectPropertyToggleFunctionName(property.GetName()),
-                     GetObjectPropertyGetterName(property.GetName()),
-                     GetObjectPropertySetterName(property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME", "GETTER_NAME", "SETTER_NAME", "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  const gd::String getterName = GetObjectPropertyGetterName(property.GetName());
+  const gd::String setterName = GetObjectPropertySetterName(property.GetName());
+  return propertyTemplate.Render(
+      {property.GetName(),
+       getterName,
+       setterName,
+       GeneratePropertyValueCode(property),
+       property.GetType() == "Boolean"
+           ? GenerateToggleBooleanPropertyTemplateCode(
+                 GetObjectPropertyToggleFunctionName(property.GetName()),
+                 getterName,
+                 setterName)
+           : ""});
 }
 
 gd::String ObjectCodeGenerator::GenerateToggleBooleanPropertyTemplateCode(
     const gd::String &toggleFunctionName, const gd::String &getterName,
     const gd::String &setterName) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate toggleTemplate(
+      R"jscode_template(
   TOGGLE_NAME() {
     this.SETTER_NAME(!this.GETTER_NAME());
-  })jscode_template")
-      .FindAndReplace("TOGGLE_NAME", toggleFunctionName)
-      .FindAndReplace("GETTER_NAME", getterName)
-      .FindAndReplace("SETTER_NAME", setterName);
+  })jscode_template",
+      {"TOGGLE_NAME", "GETTER_NAME", "SETTER_NAME"});
+  return toggleTemplate.Render({toggleFunctionName, getterName, setterName});
 }
 
 gd::String ObjectCodeGenerator::GenerateUpdatePropertyFromObjectDataCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate updatePropertyTemplate(
+      R"jscode_template(
     if (oldObjectData.content.PROPERTY_NAME !== newObjectData.content.PROPERTY_NAME)
-      this._objectData.PROPERTY_NAME = newObjectData.content.PROPERTY_NAME;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+      this._objectData.PROPERTY_NAME = newObjectData.content.PROPERTY_NAME;)jscode_template",
+      {"PROPERTY_NAME"});
+  return updatePropertyTemplate.Render({property.GetName()});
 }
 
 gd::String ObjectCodeGenerator::GeneratePropertyValueCode(
@@ -344,16 +371,18 @@ gd::String ObjectCodeGenerator::GeneratePropertyValueCode(
 gd::String ObjectCodeGenerator::GenerateDefaultDoStepPreEventsFunctionCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::StringTemplate doStepPreEventsTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME.prototype.doStepPreEvents = function() {
   PRELUDE_CODE
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("PRELUDE_CODE",
-                      GenerateDoStepPreEventsPreludeCode(eventsBasedObject));}
+)jscode_template",
+      {"RUNTIME_OBJECT_CLASSNAME", "CODE_NAMESPACE", "PRELUDE_CODE"});
+  return doStepPreEventsTemplate.Render(
+      {eventsBasedObject.GetName(),
+       codeNamespace,
+       GenerateDoStepPreEventsPreludeCode(eventsBasedObject)});
+}
 
 gd::String ObjectCodeGenerator::GenerateDoStepPreEventsPreludeCode(
     const gd::EventsBasedObject& eventsBasedObject) {
@@ -68,130 +68,162 @@ gd::PlatformExtension *CreateGDJSParticleSystemExtension();
 #endif
 
 void JsPlatform::ReloadBuiltinExtensions() {
-  // Adding built-in extensions.
+  // Adding built-in extensions. They are only declared when they are first
+  // used, as declaring all of them takes time at startup.
   std::cout << "* Loading builtin extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AsyncExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new AnimatableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new EffectExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new FlippableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ResizableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ScalableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new OpacityExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new TextContainerExtension));
-  std::cout.flush();
+  AddLazyExtension("BuiltinObject", []() {
+    return std::make_shared<BaseObjectExtension>();
+  });
+  AddLazyExtension("Sprite", []() {
+    return std::make_shared<SpriteExtension>();
+  });
+  AddLazyExtension("BuiltinCommonInstructions", []() {
+    return std::make_shared<CommonInstructionsExtension>();
+  });
+  AddLazyExtension("BuiltinAsync", []() {
+    return std::make_shared<AsyncExtension>();
+  });
+  AddLazyExtension("BuiltinCommonConversions", []() {
+    return std::make_shared<CommonConversionsExtension>();
+  });
+  AddLazyExtension("BuiltinVariables", []() {
+    return std::make_shared<VariablesExtension>();
+  });
+  AddLazyExtension("BuiltinMouse", []() {
+    return std::make_shared<MouseExtension>();
+  });
+  AddLazyExtension("BuiltinKeyboard", []() {
+    return std::make_shared<KeyboardExtension>();
+  });
+  AddLazyExtension("BuiltinScene", []() {
+    return std::make_shared<SceneExtension>();
+  });
+  AddLazyExtension("BuiltinTime", []() {
+    return std::make_shared<TimeExtension>();
+  });
+  AddLazyExtension("BuiltinMathematicalTools", []() {
+    return std::make_shared<MathematicalToolsExtension>();
+  });
+  AddLazyExtension("BuiltinCamera", []() {
+    return std::make_shared<CameraExtension>();
+  });
+  AddLazyExtension("BuiltinAudio", []() {
+    return std::make_shared<AudioExtension>();
+  });
+  AddLazyExtension("BuiltinFile", []() {
+    return std::make_shared<FileExtension>();
+  });
+  AddLazyExtension("BuiltinNetwork", []() {
+    return std::make_shared<NetworkExtension>();
+  });
+  AddLazyExtension("BuiltinWindow", []() {
+    return std::make_shared<WindowExtension>();
+  });
+  AddLazyExtension("BuiltinStringInstructions", []() {
+    return std::make_shared<StringInstructionsExtension>();
+  });
+  AddLazyExtension("BuiltinAdvanced", []() {
+    return std::make_shared<AdvancedExtension>();
+  });
+  AddLazyExtension("BuiltinExternalLayouts", []() {
+    return std::make_shared<ExternalLayoutsExtension>();
+  });
+  AddLazyExtension("AnimatableCapability", []() {
+    return std::make_shared<AnimatableExtension>();
+  });
+  AddLazyExtension("EffectCapability", []() {
+    return std::make_shared<EffectExtension>();
+  });
+  AddLazyExtension("FlippableCapability", []() {
+    return std::make_shared<FlippableExtension>();
+  });
+  AddLazyExtension("ResizableCapability", []() {
+    return std::make_shared<ResizableExtension>();
+  });
+  AddLazyExtension("ScalableCapability", []() {
+    return std::make_shared<ScalableExtension>();
+  });
+  AddLazyExtension("OpacityCapability", []() {
+    return std::make_shared<OpacityExtension>();
+  });
+  AddLazyExtension("TextContainerCapability", []() {
+    return std::make_shared<TextContainerExtension>();
+  });
   std::cout << "done." << std::endl;
 
 #if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
                         // to load.
   std::cout << "* Loading other extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  AddLazyExtension("PlatformBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPlatformBehaviorExtension());
+  });
+  AddLazyExtension("DestroyOutsideBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDestroyOutsideBehaviorExtension());
+  });
+  AddLazyExtension("TiledSpriteObject", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTiledSpriteObjectExtension());
+  });
+  AddLazyExtension("DraggableBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDraggableBehaviorExtension());
+  });
+  AddLazyExtension("TopDownMovementBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTopDownMovementBehaviorExtension());
+  });
+  AddLazyExtension("TextObject", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextObjectExtension());
+  });
+  AddLazyExtension("ParticleSystem", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSParticleSystemExtension());
+  });
+  AddLazyExtension("PanelSpriteObject", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPanelSpriteObjectExtension());
+  });
+  AddLazyExtension("AnchorBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSAnchorBehaviorExtension());
+  });
+  AddLazyExtension("PrimitiveDrawing", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPrimitiveDrawingExtension());
+  });
+  AddLazyExtension("TextEntryObject", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextEntryObjectExtension());
+  });
+  AddLazyExtension("Inventory", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSInventoryExtension());
+  });
+  AddLazyExtension("LinkedObjects", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSLinkedObjectsExtension());
+  });
+  AddLazyExtension("SystemInfo", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSSystemInfoExtension());
+  });
+  AddLazyExtension("Shopify", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSShopifyExtension());
+  });
+  AddLazyExtension("PathfindingBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPathfindingBehaviorExtension());
+  });
+  AddLazyExtension("PhysicsBehavior", []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPhysicsBehaviorExtension());
+  });
 #endif
   std::cout << "done." << std::endl;
 };
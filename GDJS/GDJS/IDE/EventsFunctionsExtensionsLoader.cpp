@@ -0,0 +1,617 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/EventsFunctionsExtensionsLoader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <map>
+#include <set>
+
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/AbstractFunctionMetadata.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/ThreadPool.h"
+#include "GDCore/Tools/Tracing.h"
+#include "GDCore/Tools/VersionWrapper.h"
+#include "GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h"
+#include "GDJS/Events/CodeGeneration/ObjectCodeGenerator.h"
+
+namespace gdjs {
+
+namespace {
+
+/**
+ * \brief Replace the output directory in the include files stored in the
+ * cache, as it can change between runs.
+ */
+const gd::String outputDirPlaceholder = "{EVENTS_FUNCTIONS_OUTPUT_DIR}";
+
+const std::uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+
+/**
+ * \brief Update a 64-bit FNV-1a hash with some bytes, followed by a separator
+ * (which is not a valid UTF-8 byte).
+ */
+void HashBytes(std::uint64_t &hash, const char *bytes, std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(bytes[i]);
+    hash *= 1099511628211ULL;
+  }
+  hash ^= 0xff;
+  hash *= 1099511628211ULL;
+}
+
+void HashString(std::uint64_t &hash, const gd::String &str) {
+  HashBytes(hash, str.Raw().data(), str.Raw().size());
+}
+
+gd::String ToHexadecimal(std::uint64_t hash) {
+  static const char digits[] = "0123456789abcdef";
+  std::string hexadecimalHash(16, '0');
+  for (std::size_t i = 0; i < 16; ++i) {
+    hexadecimalHash[15 - i] = digits[hash & 0xf];
+    hash >>= 4;
+  }
+  return gd::String::FromUTF8(hexadecimalHash);
+}
+
+/**
+ * \brief Update a hash with a serialized value, and collect the namespaces
+ * (the identifiers followed by "::") found in it.
+ */
+void HashSerializerValue(std::uint64_t &hash,
+                         const gd::SerializerValue &value,
+                         std::set<gd::String> &namespaces) {
+  if (value.IsBoolean()) {
+    HashString(hash, value.GetBool() ? "true" : "false");
+  } else if (value.IsInt()) {
+    int intValue = value.GetInt();
+    HashBytes(hash, reinterpret_cast<const char *>(&intValue), sizeof(int));
+  } else if (value.IsDouble()) {
+    double doubleValue = value.GetDouble();
+    HashBytes(
+        hash, reinterpret_cast<const char *>(&doubleValue), sizeof(double));
+  } else {
+    const std::string &str = value.GetRawString().Raw();
+    HashBytes(hash, str.data(), str.size());
+
+    for (std::size_t separator = str.find("::"); separator != std::string::npos;
+         separator = str.find("::", separator + 2)) {
+      std::size_t start = separator;
+      while (start > 0 && (std::isalnum(static_cast<unsigned char>(
+                               str[start - 1])) ||
+                           str[start - 1] == '_'))
+        start--;
+      if (start != separator)
+        namespaces.insert(
+            gd::String::FromUTF8(str.substr(start, separator - start)));
+    }
+  }
+}
+
+/**
+ * \brief Update a hash with a serialized element, without converting it to
+ * JSON, and collect the namespaces found in its values.
+ */
+void HashSerializerElement(std::uint64_t &hash,
+                           const gd::SerializerElement &element,
+                           std::set<gd::String> &namespaces) {
+  if (!element.IsValueUndefined())
+    HashSerializerValue(hash, element.GetValue(), namespaces);
+  HashString(hash, "{");
+  for (const auto &attribute : element.GetAllAttributes()) {
+    HashString(hash, attribute.first);
+    HashSerializerValue(hash, attribute.second, namespaces);
+  }
+  HashString(hash, "[");
+  for (const auto &child : element.GetAllChildren()) {
+    HashString(hash, child.first);
+    HashSerializerElement(hash, *child.second, namespaces);
+  }
+  HashString(hash, "]");
+}
+
+/**
+ * \brief Parse all the expressions of the events.
+ */
+class ExpressionsParser : public gd::ArbitraryEventsWorker {
+ public:
+  virtual ~ExpressionsParser(){};
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    for (std::size_t i = 0; i < instruction.GetParametersCount(); ++i)
+      instruction.GetParameter(i).GetRootNode();
+    return false;
+  }
+
+  bool DoVisitEventExpression(gd::Expression &expression,
+                              const gd::ParameterMetadata &metadata) override {
+    expression.GetRootNode();
+    return false;
+  }
+};
+
+}  // namespace
+
+gd::String EventsFunctionsExtensionsLoader::GetIncludeFileFor(
+    const gd::String &outputDir, const gd::String &codeNamespace) {
+  return outputDir + "/" + codeNamespace + ".js";
+}
+
+bool EventsFunctionsExtensionsLoader::LoadProjectEventsFunctionsExtensions(
+    gd::Project &project,
+    gd::Platform &platform,
+    gd::AbstractFileSystem &fs,
+    const gd::String &outputDir) {
+  gd::TraceScope traceScope("CodeGeneration",
+                            "LoadProjectEventsFunctionsExtensions");
+  generatedCodesCount = 0;
+  reusedCodesCount = 0;
+  declaredExtensionsCount = 0;
+  reusedExtensionsCount = 0;
+
+  const std::map<gd::String, gd::String> extensionsHashes =
+      ComputeExtensionsHashes(project);
+
+  // Declare all the extensions before generating any code: events in
+  // functions could be using functions of other extensions. Extensions
+  // declared for the same project that did not change are used again (with
+  // their code).
+  if (declaredExtensionsProject != &project ||
+      declaredExtensionsOutputDir != outputDir) {
+    declaredExtensions.clear();
+    declaredExtensionsProject = &project;
+    declaredExtensionsOutputDir = outputDir;
+  }
+
+  std::map<gd::String, DeclaredExtension> previousDeclaredExtensions;
+  std::swap(previousDeclaredExtensions, declaredExtensions);
+  std::vector<CodeGenerationTask *> codeGenerationTasks;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(i);
+    const gd::String &name = eventsFunctionsExtension.GetName();
+    const gd::String &hash = extensionsHashes.at(name);
+
+    auto previousDeclaredExtension = previousDeclaredExtensions.find(name);
+    if (previousDeclaredExtension != previousDeclaredExtensions.end() &&
+        previousDeclaredExtension->second.hash == hash &&
+        previousDeclaredExtension->second.eventsFunctionsExtension ==
+            &eventsFunctionsExtension) {
+      auto &declaredExtension = declaredExtensions[name];
+      declaredExtension = std::move(previousDeclaredExtension->second);
+      platform.AddExtension(declaredExtension.extension);
+      reusedExtensionsCount++;
+      continue;
+    }
+
+    auto &declaredExtension = declaredExtensions[name];
+    declaredExtension.hash = hash;
+    declaredExtension.eventsFunctionsExtension = &eventsFunctionsExtension;
+    declaredExtension.extension = DeclareEventsFunctionsExtension(
+        project,
+        eventsFunctionsExtension,
+        outputDir,
+        &declaredExtension.codeGenerationTasks);
+    platform.AddExtension(declaredExtension.extension);
+    declaredExtensionsCount++;
+
+    for (auto &task : declaredExtension.codeGenerationTasks)
+      codeGenerationTasks.push_back(&task);
+  }
+
+  // Take the code of the extensions that did not change from the cache, and
+  // generate the other ones in parallel.
+  std::vector<CodeGenerationTask *> tasksToRun;
+  for (auto *task : codeGenerationTasks) {
+    const gd::String &hash = extensionsHashes.at(task->extensionName);
+    auto cachedCode = cachedCodes.find(task->codeName);
+    if (cachedCode != cachedCodes.end() && cachedCode->second.hash == hash) {
+      task->code = cachedCode->second.code;
+      for (const auto &includeFile : cachedCode->second.includeFiles) {
+        task->includeFiles.insert(
+            includeFile.substr(0, outputDirPlaceholder.size()) ==
+                    outputDirPlaceholder
+                ? outputDir + includeFile.substr(outputDirPlaceholder.size())
+                : includeFile);
+      }
+      reusedCodesCount++;
+      continue;
+    }
+
+    tasksToRun.push_back(task);
+  }
+
+  if (!tasksToRun.empty()) {
+    ParseEventsFunctionsExpressions(project);
+    // Extensions of the platform are declared when first used, which can't be
+    // done from several threads.
+    platform.DeclareLazyExtensions();
+
+    gd::ThreadPool threadPool(threadsCount);
+    for (auto *task : tasksToRun) {
+      threadPool.Push(
+          [task]() { task->code = task->generateCode(task->includeFiles); });
+    }
+    threadPool.Wait();
+    generatedCodesCount = tasksToRun.size();
+  }
+
+  // Make the files used by the code of a function, behavior or object
+  // included with it, including the ones used by these files. Extensions that
+  // were used again already have them, as the extensions they use did not
+  // change either.
+  std::map<gd::String, const CodeGenerationTask *> tasksByIncludeFile;
+  for (const auto &declaredExtension : declaredExtensions) {
+    for (const auto &task : declaredExtension.second.codeGenerationTasks)
+      tasksByIncludeFile[GetIncludeFileFor(outputDir, task.codeName)] = &task;
+  }
+
+  for (const auto *task : codeGenerationTasks) {
+    const gd::String includeFile =
+        GetIncludeFileFor(outputDir, task->codeName);
+
+    std::set<gd::String> dependencyIncludeFiles = task->includeFiles;
+    std::vector<gd::String> includeFilesToVisit(task->includeFiles.begin(),
+                                                task->includeFiles.end());
+    while (!includeFilesToVisit.empty()) {
+      auto dependencyTask = tasksByIncludeFile.find(includeFilesToVisit.back());
+      includeFilesToVisit.pop_back();
+      if (dependencyTask == tasksByIncludeFile.end()) continue;
+
+      for (const auto &dependencyIncludeFile :
+           dependencyTask->second->includeFiles) {
+        if (dependencyIncludeFiles.insert(dependencyIncludeFile).second)
+          includeFilesToVisit.push_back(dependencyIncludeFile);
+      }
+    }
+    for (const auto &dependencyIncludeFile : dependencyIncludeFiles) {
+      if (dependencyIncludeFile != includeFile)
+        task->addIncludeFile(dependencyIncludeFile);
+    }
+
+    auto &cachedCode = cachedCodes[task->codeName];
+    cachedCode.hash = extensionsHashes.at(task->extensionName);
+    cachedCode.code = task->code;
+    cachedCode.includeFiles.clear();
+    for (const auto &dependencyIncludeFile : task->includeFiles) {
+      cachedCode.includeFiles.insert(
+          dependencyIncludeFile.substr(0, outputDir.size() + 1) ==
+                  outputDir + "/"
+              ? outputDirPlaceholder +
+                    dependencyIncludeFile.substr(outputDir.size())
+              : dependencyIncludeFile);
+    }
+  }
+
+  std::vector<std::pair<gd::String, gd::String>> filesToWrite;
+  for (const auto &taskAndIncludeFile : tasksByIncludeFile) {
+    filesToWrite.push_back(std::make_pair(taskAndIncludeFile.first,
+                                          taskAndIncludeFile.second->code));
+  }
+
+  fs.MkDir(outputDir);
+  std::vector<gd::String> failedFiles;
+  if (!fs.WriteFiles(filesToWrite, failedFiles)) {
+    lastError = _("Unable to write ") + gd::String::From(failedFiles.size()) +
+                _(" events functions code file(s), including ") +
+                failedFiles[0];
+    return false;
+  }
+
+  return true;
+}
+
+void EventsFunctionsExtensionsLoader::UnloadProjectEventsFunctionsExtensions(
+    const gd::Project &project, gd::Platform &platform) {
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    platform.RemoveExtension(project.GetEventsFunctionsExtension(i).GetName());
+  }
+}
+
+std::shared_ptr<gd::PlatformExtension>
+EventsFunctionsExtensionsLoader::DeclareEventsFunctionsExtension(
+    gd::Project &project,
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+    const gd::String &outputDir,
+    std::vector<CodeGenerationTask> *codeGenerationTasks) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  MetadataDeclarationHelper::DeclareExtension(*extension,
+                                              eventsFunctionsExtension);
+
+  const gd::String codeNamespacePrefix =
+      MetadataDeclarationHelper::GetExtensionCodeNamespacePrefix(
+          eventsFunctionsExtension);
+
+  // Using anything from the extension always includes its free functions.
+  std::vector<gd::String> extensionIncludeFiles;
+  for (std::size_t i = 0;
+       i < eventsFunctionsExtension.GetEventsFunctionsCount();
+       ++i) {
+    extensionIncludeFiles.push_back(GetIncludeFileFor(
+        outputDir,
+        MetadataDeclarationHelper::GetFreeFunctionCodeName(
+            eventsFunctionsExtension,
+            eventsFunctionsExtension.GetEventsFunction(i))));
+  }
+
+  // Declare all behaviors and their functions
+  for (const auto &eventsBasedBehavior :
+       eventsFunctionsExtension.GetEventsBasedBehaviors()
+           .GetInternalVector()) {
+    std::map<gd::String, gd::String> behaviorMethodMangledNames;
+    auto &behaviorMetadata = MetadataDeclarationHelper::GenerateBehaviorMetadata(
+        project,
+        *extension,
+        eventsFunctionsExtension,
+        *eventsBasedBehavior,
+        behaviorMethodMangledNames);
+
+    const gd::String codeNamespace =
+        MetadataDeclarationHelper::GetBehaviorFunctionCodeNamespace(
+            *eventsBasedBehavior, codeNamespacePrefix);
+    behaviorMetadata.AddIncludeFile(
+        GetIncludeFileFor(outputDir, codeNamespace));
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      behaviorMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (codeGenerationTasks) {
+      CodeGenerationTask task;
+      task.extensionName = eventsFunctionsExtension.GetName();
+      task.codeName = codeNamespace;
+      const gd::EventsBasedBehavior *behavior = eventsBasedBehavior.get();
+      task.generateCode = [&project,
+                           &eventsFunctionsExtension,
+                           behavior,
+                           codeNamespace,
+                           behaviorMethodMangledNames](
+                              std::set<gd::String> &includeFiles) {
+        BehaviorCodeGenerator behaviorCodeGenerator(project);
+        return behaviorCodeGenerator.GenerateRuntimeBehaviorCompleteCode(
+            eventsFunctionsExtension,
+            *behavior,
+            codeNamespace,
+            behaviorMethodMangledNames,
+            includeFiles,
+            // Always generate functions for runtime, as extensions can be
+            // used either for preview or export.
+            true);
+      };
+      gd::BehaviorMetadata *metadata = &behaviorMetadata;
+      task.addIncludeFile = [extension, metadata](const gd::String &file) {
+        metadata->AddIncludeFile(file);
+      };
+      codeGenerationTasks->push_back(std::move(task));
+    }
+  }
+
+  // Declare all objects and their functions
+  for (const auto &eventsBasedObject :
+       eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+    std::map<gd::String, gd::String> objectMethodMangledNames;
+    auto &objectMetadata = MetadataDeclarationHelper::GenerateObjectMetadata(
+        project,
+        *extension,
+        eventsFunctionsExtension,
+        *eventsBasedObject,
+        objectMethodMangledNames);
+
+    const gd::String codeNamespace =
+        MetadataDeclarationHelper::GetObjectFunctionCodeNamespace(
+            *eventsBasedObject, codeNamespacePrefix);
+    objectMetadata.AddIncludeFile(GetIncludeFileFor(outputDir, codeNamespace));
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      objectMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (codeGenerationTasks) {
+      CodeGenerationTask task;
+      task.extensionName = eventsFunctionsExtension.GetName();
+      task.codeName = codeNamespace;
+      const gd::EventsBasedObject *object = eventsBasedObject.get();
+      task.generateCode = [&project,
+                           &eventsFunctionsExtension,
+                           object,
+                           codeNamespace,
+                           objectMethodMangledNames](
+                              std::set<gd::String> &includeFiles) {
+        ObjectCodeGenerator objectCodeGenerator(project);
+        return objectCodeGenerator.GenerateRuntimeObjectCompleteCode(
+            eventsFunctionsExtension,
+            *object,
+            codeNamespace,
+            objectMethodMangledNames,
+            includeFiles,
+            true);
+      };
+      gd::ObjectMetadata *metadata = &objectMetadata;
+      task.addIncludeFile = [extension, metadata](const gd::String &file) {
+        metadata->AddIncludeFile(file);
+      };
+      codeGenerationTasks->push_back(std::move(task));
+    }
+  }
+
+  // Declare all free functions
+  MetadataDeclarationHelper metadataDeclarationHelper;
+  for (std::size_t i = 0;
+       i < eventsFunctionsExtension.GetEventsFunctionsCount();
+       ++i) {
+    const auto &eventsFunction = eventsFunctionsExtension.GetEventsFunction(i);
+    auto &functionMetadata =
+        metadataDeclarationHelper.GenerateFreeFunctionMetadata(
+            project, *extension, eventsFunctionsExtension, eventsFunction);
+
+    const gd::String functionName =
+        MetadataDeclarationHelper::GetFreeFunctionCodeName(
+            eventsFunctionsExtension, eventsFunction);
+    functionMetadata.AddIncludeFile(GetIncludeFileFor(outputDir, functionName));
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      functionMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (codeGenerationTasks) {
+      CodeGenerationTask task;
+      task.extensionName = eventsFunctionsExtension.GetName();
+      task.codeName = functionName;
+      const gd::String codeNamespace =
+          MetadataDeclarationHelper::GetFreeFunctionCodeNamespace(
+              eventsFunction, codeNamespacePrefix);
+      task.generateCode = [&project,
+                           &eventsFunctionsExtension,
+                           &eventsFunction,
+                           codeNamespace](std::set<gd::String> &includeFiles) {
+        EventsFunctionsExtensionCodeGenerator codeGenerator(project);
+        return codeGenerator.GenerateFreeEventsFunctionCompleteCode(
+            eventsFunctionsExtension,
+            eventsFunction,
+            codeNamespace,
+            includeFiles,
+            true);
+      };
+      gd::AbstractFunctionMetadata *metadata = &functionMetadata;
+      task.addIncludeFile = [extension, metadata](const gd::String &file) {
+        metadata->AddIncludeFile(file);
+      };
+      codeGenerationTasks->push_back(std::move(task));
+    }
+  }
+
+  return extension;
+}
+
+std::map<gd::String, gd::String>
+EventsFunctionsExtensionsLoader::ComputeExtensionsHashes(
+    const gd::Project &project) {
+  std::map<gd::String, gd::String> ownHashes;
+  std::map<gd::String, std::set<gd::String>> usedExtensionNames;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(i);
+    gd::SerializerElement element;
+    eventsFunctionsExtension.SerializeTo(element);
+
+    std::uint64_t hash = fnvOffsetBasis;
+    std::set<gd::String> namespaces;
+    HashSerializerElement(hash, element, namespaces);
+    ownHashes[eventsFunctionsExtension.GetName()] = ToHexadecimal(hash);
+
+    // An extension uses another one if it's found as the namespace of a type
+    // or of a function in it. It can give false positives, which only make
+    // the extension declared again more often.
+    for (std::size_t j = 0; j < project.GetEventsFunctionsExtensionsCount();
+         ++j) {
+      const gd::String &usedName =
+          project.GetEventsFunctionsExtension(j).GetName();
+      if (i != j && namespaces.count(usedName))
+        usedExtensionNames[eventsFunctionsExtension.GetName()].insert(
+            usedName);
+    }
+  }
+
+  // Functions of used extensions can be inlined in the generated code, so
+  // the hash must change when any of them changes, directly used or not.
+  std::map<gd::String, gd::String> hashes;
+  for (const auto &ownHash : ownHashes) {
+    std::set<gd::String> allUsedExtensionNames;
+    std::vector<gd::String> extensionNamesToVisit = {ownHash.first};
+    while (!extensionNamesToVisit.empty()) {
+      const gd::String extensionName = extensionNamesToVisit.back();
+      extensionNamesToVisit.pop_back();
+      for (const auto &usedName : usedExtensionNames[extensionName]) {
+        if (usedName != ownHash.first &&
+            allUsedExtensionNames.insert(usedName).second)
+          extensionNamesToVisit.push_back(usedName);
+      }
+    }
+
+    std::uint64_t hash = fnvOffsetBasis;
+    HashString(hash, ownHash.second);
+    for (const auto &usedName : allUsedExtensionNames) {
+      HashString(hash, usedName);
+      HashString(hash, ownHashes[usedName]);
+    }
+    HashString(hash, gd::VersionWrapper::FullString());
+    hashes[ownHash.first] = ToHexadecimal(hash);
+  }
+
+  return hashes;
+}
+
+void EventsFunctionsExtensionsLoader::ParseEventsFunctionsExpressions(
+    gd::Project &project) {
+  ExpressionsParser expressionsParser;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(
+        project, project.GetEventsFunctionsExtension(i), expressionsParser);
+  }
+}
+
+void EventsFunctionsExtensionsLoader::SerializeCacheTo(
+    gd::SerializerElement &element) const {
+  element.SetAttribute("version", gd::VersionWrapper::FullString());
+  auto &codesElement = element.AddChild("codes");
+  codesElement.ConsiderAsArrayOf("code");
+  for (const auto &cachedCode : cachedCodes) {
+    auto &codeElement = codesElement.AddChild("code");
+    codeElement.SetAttribute("name", cachedCode.first);
+    codeElement.SetAttribute("hash", cachedCode.second.hash);
+    codeElement.SetAttribute("code", cachedCode.second.code);
+
+    auto &includeFilesElement = codeElement.AddChild("includeFiles");
+    includeFilesElement.ConsiderAsArrayOf("includeFile");
+    for (const auto &includeFile : cachedCode.second.includeFiles)
+      includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+  }
+}
+
+void EventsFunctionsExtensionsLoader::UnserializeCacheFrom(
+    const gd::SerializerElement &element) {
+  cachedCodes.clear();
+  // The code generated by another version can't be used.
+  if (element.GetStringAttribute("version") !=
+      gd::VersionWrapper::FullString())
+    return;
+
+  const auto &codesElement = element.GetChild("codes");
+  codesElement.ConsiderAsArrayOf("code");
+  for (std::size_t i = 0; i < codesElement.GetChildrenCount(); ++i) {
+    const auto &codeElement = codesElement.GetChild(i);
+    auto &cachedCode = cachedCodes[codeElement.GetStringAttribute("name")];
+    cachedCode.hash = codeElement.GetStringAttribute("hash");
+    cachedCode.code = codeElement.GetStringAttribute("code");
+
+    const auto &includeFilesElement = codeElement.GetChild("includeFiles");
+    includeFilesElement.ConsiderAsArrayOf("includeFile");
+    for (std::size_t j = 0; j < includeFilesElement.GetChildrenCount(); ++j) {
+      cachedCode.includeFiles.insert(
+          includeFilesElement.GetChild(j).GetStringValue());
+    }
+  }
+}
+
+}  // namespace gdjs
@@ -0,0 +1,230 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "GDCore/Tools/ThreadPool.h"
+namespace gd {
+class AbstractFileSystem;
+class EventsFunctionsExtension;
+class Platform;
+class PlatformExtension;
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Declare the events functions extensions of a project in a platform,
+ * and generate the code of their functions, behaviors and objects.
+ *
+ * This is the native equivalent of what the editor does when it loads a
+ * project (see `newIDE/app/src/EventsFunctionsExtensionsLoader`), so that a
+ * project can be exported without a JavaScript host.
+ *
+ * The code of the functions, behaviors and objects is generated in parallel.
+ * It's kept in a cache, so that it's only generated again when the extension
+ * (or an extension it uses) changed. The cache can be saved and restored to be
+ * shared between runs.
+ *
+ * When the same project is loaded again (for example after an extension was
+ * modified), the extensions that did not change are not declared again: the
+ * extensions declared during the previous loading are used.
+ *
+ * \ingroup IDE
+ */
+class EventsFunctionsExtensionsLoader {
+ public:
+  /**
+   * \param threadsCount_ The number of threads generating code (0 to generate
+   * it in the calling thread).
+   */
+  explicit EventsFunctionsExtensionsLoader(
+      std::size_t threadsCount_ = gd::ThreadPool::GetDefaultThreadsCount())
+      : threadsCount(threadsCount_),
+        declaredExtensionsProject(nullptr),
+        generatedCodesCount(0),
+        reusedCodesCount(0),
+        declaredExtensionsCount(0),
+        reusedExtensionsCount(0){};
+
+  /**
+   * \brief Declare all the events functions extensions of the project in the
+   * platform, and write the code generated for them in the output directory.
+   *
+   * The code is only generated for the extensions that changed since it was
+   * put in the cache, and the extensions are only declared again if they
+   * changed since the last loading of the same project.
+   *
+   * \return false if the generated code could not be written (see
+   * GetLastError).
+   */
+  bool LoadProjectEventsFunctionsExtensions(gd::Project &project,
+                                            gd::Platform &platform,
+                                            gd::AbstractFileSystem &fs,
+                                            const gd::String &outputDir);
+
+  /**
+   * \brief Remove from the platform the extensions declared for the events
+   * functions extensions of the project.
+   */
+  static void UnloadProjectEventsFunctionsExtensions(
+      const gd::Project &project, gd::Platform &platform);
+
+  /**
+   * \brief Return the file where the code of a function, behavior or object
+   * is written.
+   */
+  static gd::String GetIncludeFileFor(const gd::String &outputDir,
+                                      const gd::String &codeNamespace);
+
+  /**
+   * \brief Return the error that occurred during the last loading.
+   */
+  const gd::String &GetLastError() const { return lastError; };
+
+  /**
+   * \brief Return the number of functions, behaviors and objects whose code
+   * was generated during the last loading.
+   */
+  std::size_t GetGeneratedCodesCount() const { return generatedCodesCount; }
+
+  /**
+   * \brief Return the number of functions, behaviors and objects whose code
+   * was taken from the cache during the last loading.
+   */
+  std::size_t GetReusedCodesCount() const { return reusedCodesCount; }
+
+  /**
+   * \brief Return the number of extensions that were declared during the last
+   * loading.
+   */
+  std::size_t GetDeclaredExtensionsCount() const {
+    return declaredExtensionsCount;
+  }
+
+  /**
+   * \brief Return the number of extensions declared during a previous loading
+   * that were used again during the last loading.
+   */
+  std::size_t GetReusedExtensionsCount() const {
+    return reusedExtensionsCount;
+  }
+
+  /**
+   * \brief Remove all the code from the cache, and forget the extensions
+   * declared for the last loaded project.
+   *
+   * \note This must be called before the last loaded project is destroyed, if
+   * another project can be loaded at the same address.
+   */
+  void ClearCache() {
+    cachedCodes.clear();
+    declaredExtensions.clear();
+    declaredExtensionsProject = nullptr;
+  }
+
+  /**
+   * \brief Serialize the cache, to restore it in another run.
+   */
+  void SerializeCacheTo(gd::SerializerElement &element) const;
+
+  /**
+   * \brief Restore a cache serialized with SerializeCacheTo.
+   */
+  void UnserializeCacheFrom(const gd::SerializerElement &element);
+
+ private:
+  /**
+   * \brief The code of a function, behavior or object, and how to generate
+   * it.
+   */
+  struct CodeGenerationTask {
+    gd::String extensionName;
+    gd::String codeName;  ///< The name of the file of the code, without the
+                          ///< directory and extension.
+    std::function<gd::String(std::set<gd::String> &includeFiles)>
+        generateCode;
+    std::function<void(const gd::String &includeFile)>
+        addIncludeFile;  ///< Add a file to include to the metadata.
+
+    gd::String code;
+    std::set<gd::String> includeFiles;  ///< The files used by the code.
+  };
+
+  /**
+   * \brief Generated code stored in the cache.
+   */
+  struct CachedCode {
+    gd::String hash;  ///< The hash of the extension when it was generated.
+    gd::String code;
+    std::set<gd::String> includeFiles;  ///< With the output directory
+                                        ///< replaced by a placeholder.
+  };
+
+  /**
+   * \brief An extension declared for an events functions extension, with the
+   * code generated for it.
+   */
+  struct DeclaredExtension {
+    gd::String hash;  ///< The hash of the extension when it was declared.
+    const gd::EventsFunctionsExtension *eventsFunctionsExtension;
+    std::shared_ptr<gd::PlatformExtension> extension;
+    std::vector<CodeGenerationTask> codeGenerationTasks;
+  };
+
+  /**
+   * \brief Declare the extension for an events functions extension.
+   *
+   * \param codeGenerationTasks If not null, the tasks to generate the code of
+   * the functions, behaviors and objects are added to this list. Otherwise,
+   * only the metadata are declared.
+   */
+  static std::shared_ptr<gd::PlatformExtension> DeclareEventsFunctionsExtension(
+      gd::Project &project,
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+      const gd::String &outputDir,
+      std::vector<CodeGenerationTask> *codeGenerationTasks);
+
+  /**
+   * \brief Compute, for each extension, a hash of its content, of the content
+   * of the extensions it uses (directly or not) and of the version of
+   * GDevelop: the generated code is the same as long as the hash is the same.
+   */
+  static std::map<gd::String, gd::String> ComputeExtensionsHashes(
+      const gd::Project &project);
+
+  /**
+   * \brief Parse the expressions of the events of the functions.
+   *
+   * Expressions are parsed the first time they are used. This must be done
+   * before generating code from several threads, because the events of a
+   * function can be read when generating the code of other functions.
+   */
+  static void ParseEventsFunctionsExpressions(gd::Project &project);
+
+  std::size_t threadsCount;
+  std::map<gd::String, CachedCode> cachedCodes;  ///< Indexed by code name.
+  std::map<gd::String, DeclaredExtension>
+      declaredExtensions;  ///< Indexed by extension name.
+  const gd::Project *declaredExtensionsProject;
+  gd::String declaredExtensionsOutputDir;
+  std::size_t generatedCodesCount;
+  std::size_t reusedCodesCount;
+  std::size_t declaredExtensionsCount;
+  std::size_t reusedExtensionsCount;
+  gd::String lastError;  ///< The last error that occurred.
+};
+
+}  // namespace gdjs
@@ -135,16 +135,10 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
       return false;
     }
 
-    auto projectUsedResources =
-        gd::SceneResourcesFinder::FindProjectResources(exportedProject);
+    std::set<gd::String> projectUsedResources;
     std::unordered_map<gd::String, std::set<gd::String>> scenesUsedResources;
-    for (std::size_t layoutIndex = 0;
-         layoutIndex < exportedProject.GetLayoutsCount(); layoutIndex++) {
-      auto &layout = exportedProject.GetLayout(layoutIndex);
-      scenesUsedResources[layout.GetName()] =
-          gd::SceneResourcesFinder::FindSceneResources(exportedProject,
-                                                            layout);
-    }
+    gd::SceneResourcesFinder::FindProjectAndScenesResources(
+        exportedProject, projectUsedResources, scenesUsedResources);
 
     // Strip the project (*after* generating events as the events may use
     // stripped things like objects groups...)...
@@ -152,13 +146,38 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
 
     //...and export it
     gd::SerializerElement noRuntimeGameOptions;
-    helper.ExportProjectData(fs, exportedProject, codeOutputDir + "/data.js",
-                             noRuntimeGameOptions, projectUsedResources,
-                             scenesUsedResources);
+    if (options.loadScenesDataLazily) {
+      gd::String error = helper.ExportProjectDataInChunks(
+          fs, exportedProject, codeOutputDir + "/data.js", exportDir,
+          noRuntimeGameOptions, projectUsedResources, scenesUsedResources);
+      if (!error.empty()) {
+        gd::LogError(_("Error during export:\n") + error);
+        return false;
+      }
+    } else {
+      helper.ExportProjectData(fs, exportedProject, codeOutputDir + "/data.js",
+                               noRuntimeGameOptions, projectUsedResources,
+                               scenesUsedResources);
+    }
     includesFiles.push_back(codeOutputDir + "/data.js");
 
-    helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
-    helper.ExportIncludesAndLibs(resourcesFiles, exportDir, false);
+    if (options.bundleScripts) {
+      // Concatenate all the scripts so that the index file only loads one.
+      const gd::String bundleFilename = "bundle.js";
+      if (!helper.ExportBundledIncludes(includesFiles,
+                                        exportDir,
+                                        bundleFilename,
+                                        options.exportSourceMaps)) {
+        gd::LogError(_("Error during export:\n") + helper.GetLastError());
+        return false;
+      }
+      includesFiles = {bundleFilename};
+    } else {
+      helper.ExportIncludesAndLibs(
+          includesFiles, exportDir, options.exportSourceMaps);
+    }
+    helper.ExportIncludesAndLibs(
+        resourcesFiles, exportDir, options.exportSourceMaps);
 
     gd::String source = gdjsRoot + "/Runtime/index.html";
     if (options.target == "cordova")
@@ -166,12 +185,15 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     else if (options.target == "facebookInstantGames")
       source = gdjsRoot + "/Runtime/FacebookInstantGames/index.html";
 
-    if (!helper.ExportPixiIndexFile(exportedProject,
-                                    source,
-                                    exportDir,
-                                    includesFiles,
-                                    /*nonRuntimeScriptsCacheBurst=*/0,
-                                    "")) {
+    // The list of the files containing the data of the scenes is in the
+    // runtime game options, that must then be given to the game.
+    if (!helper.ExportPixiIndexFile(
+            exportedProject,
+            source,
+            exportDir,
+            includesFiles,
+            /*nonRuntimeScriptsCacheBurst=*/0,
+            options.loadScenesDataLazily ? "gdjs.runtimeGameOptions" : "")) {
       gd::LogError(_("Error during export:\n") + lastError);
       return false;
     }
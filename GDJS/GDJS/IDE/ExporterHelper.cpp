@@ -41,6 +41,7 @@
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/Tracing.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
@@ -70,6 +71,15 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
     container.push_back(str);
 }
 
+static gd::String JoinFilenames(const std::vector<gd::String> &filenames) {
+  gd::String output;
+  for (const auto &filename : filenames) {
+    if (!output.empty()) output += ", ";
+    output += filename;
+  }
+  return output;
+}
+
 static gd::String CleanProjectName(gd::String projectName) {
   gd::String partiallyCleanedProjectName = projectName;
 
@@ -100,6 +110,7 @@ ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
+  gd::TraceScope traceScope("Export", "ExportProjectForPixiPreview");
   double previousTime = GetTimeNow();
   fs.MkDir(options.exportPath);
   fs.ClearDir(options.exportPath);
@@ -199,16 +210,10 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     previousTime = LogTimeSpent("Events code export", previousTime);
   }
 
-  auto projectUsedResources =
-      gd::SceneResourcesFinder::FindProjectResources(exportedProject);
+  std::set<gd::String> projectUsedResources;
   std::unordered_map<gd::String, std::set<gd::String>> scenesUsedResources;
-  for (std::size_t layoutIndex = 0;
-       layoutIndex < exportedProject.GetLayoutsCount();
-       layoutIndex++) {
-    auto &layout = exportedProject.GetLayout(layoutIndex);
-    scenesUsedResources[layout.GetName()] =
-        gd::SceneResourcesFinder::FindSceneResources(exportedProject, layout);
-  }
+  gd::SceneResourcesFinder::FindProjectAndScenesResources(
+      exportedProject, projectUsedResources, scenesUsedResources);
 
   // Strip the project (*after* generating events as the events may use stripped
   // things (objects groups...))
@@ -318,6 +323,7 @@ gd::String ExporterHelper::ExportProjectData(
     const gd::SerializerElement &runtimeGameOptions,
     std::set<gd::String> &projectUsedResources,
     std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources) {
+  gd::TraceScope traceScope("Export", "ExportProjectData");
   fs.MkDir(fs.DirNameFrom(filename));
 
   // Save the project to JSON
@@ -335,6 +341,86 @@ gd::String ExporterHelper::ExportProjectData(
   return "";
 }
 
+gd::String ExporterHelper::ExportProjectDataInChunks(
+    gd::AbstractFileSystem &fs,
+    gd::Project &project,
+    gd::String filename,
+    gd::String exportDir,
+    const gd::SerializerElement &runtimeGameOptions,
+    std::set<gd::String> &projectUsedResources,
+    std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources) {
+  gd::TraceScope traceScope("Export", "ExportProjectDataInChunks");
+  fs.MkDir(fs.DirNameFrom(filename));
+  fs.MkDir(exportDir + "/data");
+
+  gd::SerializerElement rootElement;
+  project.SerializeTo(rootElement);
+  SerializeUsedResources(
+      rootElement, projectUsedResources, scenesUsedResources);
+
+  // Move the data of the scenes and external layouts to their own files, and
+  // list them in the options of the game.
+  gd::SerializerElement gameOptions = runtimeGameOptions;
+  gd::SerializerElement &chunksElement =
+      gameOptions.AddChild("projectDataChunks");
+  std::vector<std::pair<gd::String, gd::String>> filesToWrite;
+
+  gd::SerializerElement &layoutChunksElement =
+      chunksElement.AddChild("layouts");
+  layoutChunksElement.ConsiderAsArray();
+  const auto &layoutsElement = rootElement.GetChild("layouts");
+  for (std::size_t i = 0; i < layoutsElement.GetChildrenCount(); ++i) {
+    const auto &layoutElement = layoutsElement.GetChild(i);
+    gd::String file = "data/layout-" + gd::String::From(i) + ".json";
+    filesToWrite.push_back(std::make_pair(
+        exportDir + "/" + file, gd::Serializer::ToJSON(layoutElement)));
+
+    auto &layoutChunkElement = layoutChunksElement.AddChild("");
+    layoutChunkElement.SetAttribute("name",
+                                    layoutElement.GetStringAttribute("name"));
+    layoutChunkElement.SetAttribute("file", file);
+    layoutChunkElement.AddChild("usedResources") =
+        layoutElement.GetChild("usedResources");
+  }
+
+  gd::SerializerElement &externalLayoutChunksElement =
+      chunksElement.AddChild("externalLayouts");
+  externalLayoutChunksElement.ConsiderAsArray();
+  const auto &externalLayoutsElement = rootElement.GetChild("externalLayouts");
+  for (std::size_t i = 0; i < externalLayoutsElement.GetChildrenCount(); ++i) {
+    const auto &externalLayoutElement = externalLayoutsElement.GetChild(i);
+    gd::String file = "data/external-layout-" + gd::String::From(i) + ".json";
+    filesToWrite.push_back(
+        std::make_pair(exportDir + "/" + file,
+                       gd::Serializer::ToJSON(externalLayoutElement)));
+
+    auto &externalLayoutChunkElement = externalLayoutChunksElement.AddChild("");
+    externalLayoutChunkElement.SetAttribute(
+        "name", externalLayoutElement.GetStringAttribute("name"));
+    externalLayoutChunkElement.SetAttribute("file", file);
+    externalLayoutChunkElement.SetAttribute(
+        "associatedLayout",
+        externalLayoutElement.GetStringAttribute("associatedLayout"));
+  }
+
+  rootElement.RemoveChild("layouts");
+  rootElement.AddChild("layouts").ConsiderAsArrayOf("layout");
+  rootElement.RemoveChild("externalLayouts");
+  rootElement.AddChild("externalLayouts").ConsiderAsArrayOf("externalLayout");
+
+  filesToWrite.push_back(std::make_pair(
+      filename,
+      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
+          "gdjs.runtimeGameOptions = " + gd::Serializer::ToJSON(gameOptions) +
+          ";\n"));
+
+  std::vector<gd::String> failedFiles;
+  if (!fs.WriteFiles(filesToWrite, failedFiles))
+    return "Unable to write " + JoinFilenames(failedFiles);
+
+  return "";
+}
+
 void ExporterHelper::SerializeUsedResources(
     gd::SerializerElement &rootElement,
     std::set<gd::String> &projectUsedResources,
@@ -908,9 +994,11 @@ bool ExporterHelper::ExportEventsCode(
     bool exportForPreview) {
   fs.MkDir(outputDir);
 
+  std::vector<std::pair<gd::String, gd::String>> filesToWrite;
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     std::set<gd::String> eventsIncludes;
     const gd::Layout &layout = project.GetLayout(i);
+    gd::TraceScope traceScope("Export", "ExportEventsCode", layout.GetName());
 
     auto &diagnosticReport =
         wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
@@ -921,15 +1009,18 @@ bool ExporterHelper::ExportEventsCode(
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
-    // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    InsertUnique(includesFiles, filename);
 
-      InsertUnique(includesFiles, filename);
-    } else {
-      lastError = _("Unable to write ") + filename;
-      return false;
-    }
+    filesToWrite.push_back(std::make_pair(filename, eventsOutput));
+  }
+
+  // Export the code
+  gd::TraceScope traceScope("Export", "WriteEventsCode");
+  std::vector<gd::String> failedFiles;
+  if (!fs.WriteFiles(filesToWrite, failedFiles)) {
+    lastError = _("Unable to write ") + JoinFilenames(failedFiles);
+    return false;
   }
 
   return true;
@@ -1001,6 +1092,10 @@ bool ExporterHelper::ExportIncludesAndLibs(
     const std::vector<gd::String> &includesFiles,
     gd::String exportDir,
     bool exportSourceMaps) {
+  gd::TraceScope traceScope("Export", "ExportIncludesAndLibs");
+  // Gather all the copies to be done so that the file system can do them as a
+  // batch (possibly in parallel).
+  std::vector<std::pair<gd::String, gd::String>> filesToCopy;
   for (auto &include : includesFiles) {
     if (!fs.IsAbsolute(include)) {
       // By convention, an include file that is relative is relative to
@@ -1011,12 +1106,13 @@ bool ExporterHelper::ExportIncludesAndLibs(
         gd::String path = fs.DirNameFrom(exportDir + "/" + include);
         if (!fs.DirExists(path)) fs.MkDir(path);
 
-        fs.CopyFile(source, exportDir + "/" + include);
+        filesToCopy.push_back(std::make_pair(source, exportDir + "/" + include));
 
         gd::String sourceMap = source + ".map";
         // Copy source map if present
         if (exportSourceMaps && fs.FileExists(sourceMap)) {
-          fs.CopyFile(sourceMap, exportDir + "/" + include + ".map");
+          filesToCopy.push_back(
+              std::make_pair(sourceMap, exportDir + "/" + include + ".map"));
         }
       } else {
         std::cout << "Could not find GDJS include file " << include
@@ -1026,19 +1122,145 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // Note: all the code generated from events are generated in another
       // folder and fall in this case:
       if (fs.FileExists(include)) {
-        fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
+        filesToCopy.push_back(std::make_pair(
+            include, exportDir + "/" + fs.FileNameFrom(include)));
       } else {
         std::cout << "Could not find include file " << include << std::endl;
       }
     }
   }
 
+  std::vector<gd::String> failedFiles;
+  if (!fs.CopyFiles(filesToCopy, failedFiles)) {
+    lastError = _("Unable to copy ") + JoinFilenames(failedFiles);
+    gd::LogError(lastError);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Remove the comment referencing the source map of a script, as the
+ * bundle it's added to has its own source map (or none).
+ */
+static void RemoveSourceMappingUrl(std::string &script) {
+  std::size_t commentPosition = script.rfind("//# sourceMappingURL=");
+  if (commentPosition == std::string::npos) return;
+
+  std::size_t lineEnd = script.find('\n', commentPosition);
+  script.erase(commentPosition,
+               lineEnd == std::string::npos ? std::string::npos
+                                            : lineEnd - commentPosition);
+}
+
+bool ExporterHelper::ExportBundledIncludes(
+    const std::vector<gd::String> &includesFiles,
+    gd::String exportDir,
+    gd::String bundleFilename,
+    bool exportSourceMaps) {
+  gd::TraceScope traceScope("Export", "ExportBundledIncludes");
+
+  // The source map of the bundle is an "index map": it's made of a section
+  // for each bundled file having a source map, starting at the line where the
+  // file was added.
+  gd::SerializerElement sourceMapElement;
+  sourceMapElement.SetAttribute("version", 3);
+  sourceMapElement.SetAttribute("file", bundleFilename);
+  gd::SerializerElement &sectionsElement =
+      sourceMapElement.AddChild("sections");
+  sectionsElement.ConsiderAsArray();
+
+  std::string bundle;
+  std::size_t linesCount = 0;
+  for (auto &include : includesFiles) {
+    // By convention, an include file that is relative is relative to
+    // the "<GDJS Root>/Runtime" folder.
+    bool isRuntimeFile = !fs.IsAbsolute(include);
+    gd::String source =
+        isRuntimeFile ? gdjsRoot + "/Runtime/" + include : include;
+    if (!fs.FileExists(source)) {
+      std::cout << "Could not find include file " << include << std::endl;
+      continue;
+    }
+
+    std::string script = fs.ReadFile(source).Raw();
+    RemoveSourceMappingUrl(script);
+
+    // Start each script on a new line, after a semicolon, so that it can't
+    // be parsed as the continuation of the previous one (and a "use strict"
+    // directive only applies to its own functions, not to the whole bundle).
+    bundle += ";\n";
+    linesCount++;
+
+    gd::String sourceMap = source + ".map";
+    if (exportSourceMaps && isRuntimeFile && fs.FileExists(sourceMap)) {
+      gd::SerializerElement mapElement =
+          gd::Serializer::FromJSON(fs.ReadFile(sourceMap));
+
+      // Sources are relative to the source map: make them relative to the
+      // bundle, which is at the root of the export directory.
+      std::size_t slashPosition = include.Raw().rfind('/');
+      gd::String sourceDir;
+      if (slashPosition != std::string::npos)
+        sourceDir =
+            gd::String::FromUTF8(include.Raw().substr(0, slashPosition + 1));
+      gd::String sourceRoot;
+      if (mapElement.HasChild("sourceRoot")) {
+        sourceRoot = mapElement.GetChild("sourceRoot").GetStringValue();
+        mapElement.RemoveChild("sourceRoot");
+      }
+      if (mapElement.HasChild("sources")) {
+        gd::SerializerElement &sourcesElement = mapElement.GetChild("sources");
+        for (std::size_t i = 0; i < sourcesElement.GetChildrenCount(); ++i) {
+          gd::SerializerElement &sourceElement = sourcesElement.GetChild(i);
+          gd::String mapSource = sourceRoot + sourceElement.GetStringValue();
+          if (mapSource.find("://") == gd::String::npos &&
+              mapSource.Raw().compare(0, 1, "/") != 0)
+            mapSource = sourceDir + mapSource;
+          sourceElement.SetStringValue(mapSource);
+        }
+      }
+
+      gd::SerializerElement &sectionElement = sectionsElement.AddChild("");
+      gd::SerializerElement &offsetElement = sectionElement.AddChild("offset");
+      offsetElement.SetAttribute("line", (int)linesCount);
+      offsetElement.SetAttribute("column", 0);
+      sectionElement.AddChild("map") = mapElement;
+    }
+
+    bool endsWithNewLine = !script.empty() && script.back() == '\n';
+    bundle += script;
+    if (!endsWithNewLine) bundle += '\n';
+    linesCount += std::count(script.begin(), script.end(), '\n') +
+                  (endsWithNewLine ? 0 : 1);
+  }
+
+  std::vector<std::pair<gd::String, gd::String>> filesToWrite;
+  if (exportSourceMaps) {
+    bundle += "//# sourceMappingURL=" +
+              fs.FileNameFrom(bundleFilename).Raw() + ".map\n";
+    filesToWrite.push_back(
+        std::make_pair(exportDir + "/" + bundleFilename + ".map",
+                       gd::Serializer::ToJSON(sourceMapElement)));
+  }
+  filesToWrite.push_back(std::make_pair(exportDir + "/" + bundleFilename,
+                                        gd::String::FromUTF8(bundle)));
+
+  std::vector<gd::String> failedFiles;
+  if (!fs.WriteFiles(filesToWrite, failedFiles)) {
+    lastError = _("Unable to write ") + JoinFilenames(failedFiles);
+    gd::LogError(lastError);
+    return false;
+  }
+
   return true;
 }
 
 void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
                                      gd::Project &project,
                                      gd::String exportDir) {
+  gd::TraceScope traceScope("Export", "ExportResources");
   gd::ProjectResourcesCopier::CopyAllResourcesTo(
       project, fs, exportDir, true, false, false);
 }
@@ -298,7 +298,10 @@ struct ExportOptions {
         exportPath(exportPath_),
         target(""),
         fallbackAuthorId(""),
-        fallbackAuthorUsername(""){};
+        fallbackAuthorUsername(""),
+        bundleScripts(false),
+        exportSourceMaps(false),
+        loadScenesDataLazily(false){};
 
   /**
    * \brief Set the fallback author info (if info not present in project
@@ -322,11 +325,44 @@ struct ExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the scripts of the game (game engine, extensions and events
+   * code) must be concatenated into a single file, so that the game loads one
+   * script instead of hundreds.
+   */
+  ExportOptions &SetBundleScripts(bool enable) {
+    bundleScripts = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the source maps of the scripts must be exported with the
+   * game. When the scripts are bundled, a source map of the bundle is
+   * generated from them.
+   */
+  ExportOptions &SetExportSourceMaps(bool enable) {
+    exportSourceMaps = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the data of each scene and external layout must be exported
+   * in a separate file, so that the game only loads the data of a scene when
+   * it's needed, instead of loading the whole project at startup.
+   */
+  ExportOptions &SetLoadScenesDataLazily(bool enable) {
+    loadScenesDataLazily = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String target;
   gd::String fallbackAuthorUsername;
   gd::String fallbackAuthorId;
+  bool bundleScripts;
+  bool exportSourceMaps;
+  bool loadScenesDataLazily;
 };
 
 /**
@@ -364,6 +400,34 @@ class ExporterHelper {
       std::unordered_map<gd::String, std::set<gd::String>>
           &layersUsedResources);
 
+  /**
+   * \brief Export a project to JSON, like ExportProjectData, but with the data
+   * of each scene and external layout in a separate JSON file.
+   *
+   * The files are listed, with the resources used by each scene, in the
+   * runtime game options (as `projectDataChunks`) so that the game can load
+   * the data of a scene only when it's needed.
+   *
+   * \param fs The abstract file system to use to write the files
+   * \param project The project to be exported.
+   * \param filename The filename where export the project
+   * \param exportDir The directory where the game is exported. The data of the
+   * scenes and external layouts are written in its "data" folder.
+   * \param runtimeGameOptions The content of the extra configuration to store
+   * in gdjs.runtimeGameOptions
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
+   */
+  static gd::String ExportProjectDataInChunks(
+      gd::AbstractFileSystem &fs,
+      gd::Project &project,
+      gd::String filename,
+      gd::String exportDir,
+      const gd::SerializerElement &runtimeGameOptions,
+      std::set<gd::String> &projectUsedResources,
+      std::unordered_map<gd::String, std::set<gd::String>>
+          &scenesUsedResources);
+
   /**
    * \brief Copy all the resources of the project to to the export directory,
    * updating the resources filenames.
@@ -404,11 +468,34 @@ class ExporterHelper {
    * \param exportDir The directory where the files must be copied.
    * \param exportSourceMaps Should the source maps be copied? Should be true on
    * previews only.
+   * \return false if some files could not be copied (see GetLastError).
    */
   bool ExportIncludesAndLibs(const std::vector<gd::String> &includesFiles,
                              gd::String exportDir,
                              bool exportSourceMaps);
 
+  /**
+   * \brief Concatenate all the specified files into a single script, written
+   * in the export directory. Relative files are read from
+   * "<GDJS root>/Runtime" directory.
+   *
+   * Files are concatenated in the order of the includes (which is the order in
+   * which they would be loaded by the index file). The bundle is then the only
+   * file to be included.
+   *
+   * \param includesFiles A vector with filenames to be bundled.
+   * \param exportDir The directory where the bundle must be written.
+   * \param bundleFilename The name of the bundle, relative to the export
+   * directory.
+   * \param exportSourceMaps Should a source map of the bundle be written? It's
+   * made of the source maps of the bundled files.
+   * \return false if the bundle could not be written (see GetLastError).
+   */
+  bool ExportBundledIncludes(const std::vector<gd::String> &includesFiles,
+                             gd::String exportDir,
+                             gd::String bundleFilename,
+                             bool exportSourceMaps);
+
   /**
    * \brief Generate the events JS code, and save them to the export directory.
    *
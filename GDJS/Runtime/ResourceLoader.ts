@@ -152,7 +152,7 @@ namespace gdjs {
       runtimeGame: RuntimeGame,
       resourceDataArray: ResourceData[],
       globalResources: Array<string>,
-      layoutDataArray: Array<LayoutData>
+      layoutDataArray: Array<Pick<LayoutData, 'name' | 'usedResources'>>
     ) {
       this._runtimeGame = runtimeGame;
       this._resources = new Map<string, ResourceData>();
@@ -221,7 +221,7 @@ namespace gdjs {
     setResources(
       resourceDataArray: ResourceData[],
       globalResources: Array<string>,
-      layoutDataArray: Array<LayoutData>
+      layoutDataArray: Array<Pick<LayoutData, 'name' | 'usedResources'>>
     ): void {
       this._globalResources = globalResources;
 
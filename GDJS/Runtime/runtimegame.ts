@@ -20,6 +20,27 @@ namespace gdjs {
   const getGlobalResourceNames = (projectData: ProjectData): Array<string> =>
     projectData.usedResources.map((resource) => resource.name);
 
+  /** Load a JSON file exported with the game. */
+  const loadJsonFile = (url: string): Promise<any> =>
+    new Promise((resolve, reject) => {
+      const xhr = new XMLHttpRequest();
+      xhr.responseType = 'json';
+      xhr.open('GET', url);
+      xhr.onload = () => {
+        if (xhr.status !== 200) {
+          reject(
+            new Error(
+              'HTTP error: ' + xhr.status + '(' + xhr.statusText + ')'
+            )
+          );
+          return;
+        }
+        resolve(xhr.response);
+      };
+      xhr.onerror = () => reject(new Error('Unable to load ' + url));
+      xhr.send();
+    });
+
   let supportedCompressionMethods: ('cs:gzip' | 'cs:deflate')[] | null = null;
   const getSupportedCompressionMethods = (): ('cs:gzip' | 'cs:deflate')[] => {
     if (!!supportedCompressionMethods) {
@@ -51,6 +72,11 @@ namespace gdjs {
     injectExternalLayout?: string;
     /** Script files, used for hot-reloading. */
     scriptFiles?: Array<RuntimeGameOptionsScriptFile>;
+    /**
+     * If set, the data of the scenes and external layouts is not in the
+     * project data, but in separate files that are loaded when needed.
+     */
+    projectDataChunks?: ProjectDataChunksData;
     /** if true, export is a partial preview without events. */
     projectDataOnlyExport?: boolean;
     /** if true, preview is launched from GDevelop native mobile app. */
@@ -181,6 +207,15 @@ namespace gdjs {
      * Optional client to connect to a debugger server.
      */
     _debuggerClient: gdjs.AbstractDebuggerClient | null;
+
+    /**
+     * The loading of the files containing the data of scenes and external
+     * layouts (see `RuntimeGameOptions.projectDataChunks`), by file.
+     */
+    _dataChunksLoadingPromises = new Map<string, Promise<void>>();
+    /** The files of data chunks that are loaded. */
+    _loadedDataChunks = new Set<string>();
+
     _sessionMetricsInitialized: boolean = false;
     _disableMetrics: boolean = false;
     _isPreview: boolean;
@@ -212,7 +247,9 @@ namespace gdjs {
         this,
         data.resources.resources,
         getGlobalResourceNames(data),
-        data.layouts
+        this._options.projectDataChunks
+          ? this._options.projectDataChunks.layouts
+          : data.layouts
       );
 
       this._effectsManager = new gdjs.EffectsManager();
@@ -479,6 +516,13 @@ namespace gdjs {
           return true;
         }
       }
+      const projectDataChunks = this._options.projectDataChunks;
+      if (projectDataChunks) {
+        return projectDataChunks.layouts.some(
+          (layoutDataChunk) =>
+            sceneName === undefined || layoutDataChunk.name === sceneName
+        );
+      }
       return false;
     }
 
@@ -697,6 +741,9 @@ namespace gdjs {
      */
     prioritizeLoadingOfScene(sceneName: string) {
       // Don't await the scene assets to be loaded.
+      this._loadSceneData(sceneName, /* isFirstScene = */ false).catch(
+        (error) => logger.error('Unable to load the scene data:', error)
+      );
       this._resourcesLoader.loadSceneResources(sceneName);
     }
 
@@ -721,7 +768,101 @@ namespace gdjs {
      * parsed.
      */
     areSceneAssetsReady(sceneName: string): boolean {
-      return this._resourcesLoader.areSceneAssetsReady(sceneName);
+      return (
+        this._isSceneDataLoaded(sceneName) &&
+        this._resourcesLoader.areSceneAssetsReady(sceneName)
+      );
+    }
+
+    /**
+     * @returns true if the data of the scene, and of the external layouts
+     * associated to it, is loaded (see `RuntimeGameOptions.projectDataChunks`).
+     */
+    private _isSceneDataLoaded(sceneName: string): boolean {
+      const projectDataChunks = this._options.projectDataChunks;
+      if (!projectDataChunks) {
+        return true;
+      }
+      return (
+        projectDataChunks.layouts.every(
+          (layoutDataChunk) =>
+            layoutDataChunk.name !== sceneName ||
+            this._loadedDataChunks.has(layoutDataChunk.file)
+        ) &&
+        projectDataChunks.externalLayouts.every(
+          (externalLayoutDataChunk) =>
+            externalLayoutDataChunk.associatedLayout !== sceneName ||
+            this._loadedDataChunks.has(externalLayoutDataChunk.file)
+        )
+      );
+    }
+
+    /**
+     * Load the data of a scene, and of the external layouts associated to it,
+     * when they are exported in separate files (see
+     * `RuntimeGameOptions.projectDataChunks`).
+     *
+     * External layouts that are not associated to a scene are loaded with the
+     * first scene.
+     */
+    private async _loadSceneData(
+      sceneName: string,
+      isFirstScene: boolean
+    ): Promise<void> {
+      const projectDataChunks = this._options.projectDataChunks;
+      if (!projectDataChunks) {
+        return;
+      }
+      const loadingPromises: Array<Promise<void>> = [];
+      for (const layoutDataChunk of projectDataChunks.layouts) {
+        if (layoutDataChunk.name === sceneName) {
+          loadingPromises.push(
+            this._loadDataChunk(layoutDataChunk.file, (data: LayoutData) => {
+              this._data.layouts.push(data);
+              this._updateSceneAndExtensionsData();
+            })
+          );
+        }
+      }
+      for (const externalLayoutDataChunk of projectDataChunks.externalLayouts) {
+        const associatedLayout = externalLayoutDataChunk.associatedLayout;
+        if (
+          associatedLayout === sceneName ||
+          (isFirstScene && !this.hasScene(associatedLayout))
+        ) {
+          loadingPromises.push(
+            this._loadDataChunk(
+              externalLayoutDataChunk.file,
+              (data: ExternalLayoutData) => {
+                this._data.externalLayouts.push(data);
+              }
+            )
+          );
+        }
+      }
+      await Promise.all(loadingPromises);
+    }
+
+    private _loadDataChunk<T>(
+      file: string,
+      onLoaded: (data: T) => void
+    ): Promise<void> {
+      let loadingPromise = this._dataChunksLoadingPromises.get(file);
+      if (!loadingPromise) {
+        loadingPromise = loadJsonFile(file).then(
+          (data) => {
+            onLoaded(data);
+            this._loadedDataChunks.add(file);
+          },
+          (error) => {
+            // Allow to try again.
+            this._dataChunksLoadingPromises.delete(file);
+            throw error;
+          }
+        );
+        this._dataChunksLoadingPromises.set(file, loadingPromise);
+      }
+      return loadingPromise;
     }
 
     /**
@@ -763,6 +904,10 @@ namespace gdjs {
           this._loadAssetsWithLoadingScreen(
             /* isFirstScene = */ true,
             async (onProgress) => {
+              const sceneDataLoadingPromise = this._loadSceneData(
+                firstSceneName,
+                /* isFirstScene = */ true
+              );
               // TODO Is a setting needed?
               if (false) {
                 await this._resourcesLoader.loadAllResources(onProgress);
@@ -774,6 +919,7 @@ namespace gdjs {
                 // Don't await as it must not block the first scene from starting.
                 this._resourcesLoader.loadAllSceneInBackground();
               }
+              await sceneDataLoadingPromise;
             },
             progressCallback
           ),
@@ -797,10 +943,13 @@ namespace gdjs {
       await this._loadAssetsWithLoadingScreen(
         /* isFirstLayout = */ false,
         async (onProgress) => {
-          await this._resourcesLoader.loadAndProcessSceneResources(
-            sceneName,
-            onProgress
-          );
+          await Promise.all([
+            this._loadSceneData(sceneName, /* isFirstScene = */ false),
+            this._resourcesLoader.loadAndProcessSceneResources(
+              sceneName,
+              onProgress
+            ),
+          ]);
         },
         progressCallback
       );
@@ -845,10 +994,14 @@ namespace gdjs {
 
     private _getFirstSceneName(): string {
       const firstSceneName = this._data.firstLayout;
-      return this.hasScene(firstSceneName)
-        ? firstSceneName
-        : // There is always at least a scene
-          this.getSceneAndExtensionsData()!.sceneData.name;
+      if (this.hasScene(firstSceneName)) {
+        return firstSceneName;
+      }
+      // There is always at least a scene
+      const projectDataChunks = this._options.projectDataChunks;
+      return projectDataChunks
+        ? projectDataChunks.layouts[0].name
+        : this.getSceneAndExtensionsData()!.sceneData.name;
     }
 
     /**
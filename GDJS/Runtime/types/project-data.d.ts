@@ -20,6 +20,29 @@ declare interface ProjectData {
   eventsFunctionsExtensions: EventsFunctionsExtensionData[];
 }
 
+/**
+ * The files containing the data of the scenes and external layouts, when they
+ * are exported separately from the rest of the project data.
+ */
+declare interface ProjectDataChunksData {
+  layouts: LayoutDataChunkData[];
+  externalLayouts: ExternalLayoutDataChunkData[];
+}
+
+declare interface LayoutDataChunkData {
+  name: string;
+  /** The URL of the file containing the {@link LayoutData}. */
+  file: string;
+  usedResources: ResourceReference[];
+}
+
+declare interface ExternalLayoutDataChunkData {
+  name: string;
+  /** The URL of the file containing the {@link ExternalLayoutData}. */
+  file: string;
+  associatedLayout: string;
+}
+
 declare interface EventsFunctionsVariablesData {
   name: string;
   variables: RootVariableData[];
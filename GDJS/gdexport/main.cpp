@@ -0,0 +1,195 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+/**
+ * \file gdexport: a command line tool exporting a project to a playable game
+ * (or a preview), without the editor or libGD.js.
+ */
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/NativeFileSystem.h"
+#include "GDCore/IDE/PlatformManager.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/EventsFunctionsExtensionsLoader.h"
+#include "GDJS/IDE/Exporter.h"
+#include "GDJS/IDE/ExporterHelper.h"
+
+namespace {
+
+void PrintUsage() {
+  std::cout
+      << "Usage: gdexport --project <game.json> --out <directory> "
+         "--gdjs-root <directory> [options]\n"
+         "\n"
+         "Options:\n"
+         "  --project <file>          The project file to export.\n"
+         "  --out <directory>         The directory where the game is "
+         "exported.\n"
+         "  --gdjs-root <directory>   The directory containing the built "
+         "game engine (\"Runtime\" folder).\n"
+         "  --target <target>         html5 (default), cordova, electron, "
+         "facebookInstantGames or preview.\n"
+         "  --layout <name>           The first scene of a preview.\n"
+         "  --extensions-dir <dir>    The directory containing the compiled "
+         "C++ extensions (" GDEXPORT_DEFAULT_EXTENSIONS_DIR
+         " by default).\n"
+         "  --threads <count>         The number of threads used for file "
+         "operations and code generation (by default, the number of "
+         "cores).\n"
+         "  --cache <file>            A file where the code generated for the "
+         "events functions extensions is kept, to only generate it again for "
+         "the extensions that changed.\n"
+         "  --bundle-scripts <yes|no> Concatenate all the scripts of the game "
+         "into a single file (no by default).\n"
+         "  --source-maps <yes|no>    Export the source maps of the scripts "
+         "(no by default).\n"
+         "  --lazy-scenes <yes|no>    Export the data of each scene in a "
+         "separate file, loaded when the scene is needed (no by default).\n"
+         "  --help                    Show this help.\n"
+         "\n"
+         "Note: extensions declared only in JavaScript (JsExtension.js) are "
+         "not available and their instructions won't be exported.\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::map<gd::String, gd::String> options;
+  options["target"] = "html5";
+  options["extensions-dir"] = GDEXPORT_DEFAULT_EXTENSIONS_DIR;
+  options["threads"] =
+      gd::String::From(gd::ThreadPool::GetDefaultThreadsCount());
+
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = argv[i];
+    if (argument == "--help" || argument == "-h") {
+      PrintUsage();
+      return 0;
+    }
+    if (argument.substr(0, 2) != "--" || i + 1 >= argc) {
+      std::cerr << "Invalid argument: " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    }
+
+    options[argument.substr(2)] = argv[++i];
+  }
+
+  if (options["project"].empty() || options["out"].empty() ||
+      options["gdjs-root"].empty()) {
+    PrintUsage();
+    return 1;
+  }
+
+  const gd::String &target = options["target"];
+  if (target != "html5" && target != "cordova" && target != "electron" &&
+      target != "facebookInstantGames" && target != "preview") {
+    std::cerr << "Unknown target: " << target << std::endl;
+    return 1;
+  }
+
+  gd::NativeFileSystem fs(options["threads"].To<std::size_t>());
+
+  // Initialize the platform with built-in and C++ extensions.
+  gdjs::JsPlatform &platform = gdjs::JsPlatform::Get();
+  gd::ExtensionsLoader::LoadAllExtensions(options["extensions-dir"], platform);
+  gd::ExtensionsLoader::ExtensionsLoadingDone(options["extensions-dir"]);
+  gd::PlatformManager::Get()->AddPlatform(
+      std::shared_ptr<gd::Platform>(&platform, [](gd::Platform *) {}));
+
+  // Load the project.
+  gd::String projectFile = options["project"];
+  fs.MakeAbsolute(projectFile, ".");
+  if (!fs.FileExists(projectFile)) {
+    std::cerr << "Unable to find the project file " << projectFile
+              << std::endl;
+    return 1;
+  }
+
+  gd::Project project;
+  project.AddPlatform(platform);
+  project.UnserializeFrom(gd::Serializer::FromJSON(fs.ReadFile(projectFile)));
+  project.SetProjectFile(projectFile);
+
+  // Declare the events functions extensions and generate their code.
+  std::string codeDirTemplate = fs.GetTempDir().Raw() + "/gdexport-XXXXXX";
+  const char *codeDir = mkdtemp(&codeDirTemplate[0]);
+  if (!codeDir) {
+    std::cerr << "Unable to create a temporary directory." << std::endl;
+    return 1;
+  }
+
+  gdjs::EventsFunctionsExtensionsLoader extensionsLoader(
+      options["threads"].To<std::size_t>());
+  gd::String cacheFile = options["cache"];
+  if (!cacheFile.empty()) {
+    fs.MakeAbsolute(cacheFile, ".");
+    if (fs.FileExists(cacheFile)) {
+      extensionsLoader.UnserializeCacheFrom(
+          gd::Serializer::FromJSON(fs.ReadFile(cacheFile)));
+    }
+  }
+
+  if (!extensionsLoader.LoadProjectEventsFunctionsExtensions(
+          project, platform, fs, gd::String(codeDir) + "/extensions")) {
+    std::cerr << extensionsLoader.GetLastError() << std::endl;
+    return 1;
+  }
+
+  if (!cacheFile.empty()) {
+    gd::SerializerElement cacheElement;
+    extensionsLoader.SerializeCacheTo(cacheElement);
+    if (!fs.WriteToFile(cacheFile, gd::Serializer::ToJSON(cacheElement)))
+      std::cerr << "Unable to write the cache to " << cacheFile << std::endl;
+  }
+
+  // Export the project.
+  gd::String outputDir = options["out"];
+  fs.MakeAbsolute(outputDir, ".");
+
+  gdjs::Exporter exporter(fs, options["gdjs-root"]);
+  exporter.SetCodeOutputDirectory(gd::String(codeDir) + "/code");
+
+  bool success = false;
+  if (target == "preview") {
+    gdjs::PreviewExportOptions previewOptions(project, outputDir);
+    previewOptions.SetLayoutName(options["layout"].empty()
+                                     ? project.GetFirstLayout()
+                                     : options["layout"]);
+    success = exporter.ExportProjectForPixiPreview(previewOptions);
+  } else {
+    gdjs::ExportOptions exportOptions(project, outputDir);
+    if (target != "html5") exportOptions.SetTarget(target);
+    exportOptions.SetBundleScripts(options["bundle-scripts"] == "yes");
+    exportOptions.SetExportSourceMaps(options["source-maps"] == "yes");
+    exportOptions.SetLoadScenesDataLazily(options["lazy-scenes"] == "yes");
+    success = exporter.ExportWholePixiProject(exportOptions);
+  }
+
+  fs.ClearDir(codeDir);
+  rmdir(codeDir);
+  gdjs::EventsFunctionsExtensionsLoader::
+      UnloadProjectEventsFunctionsExtensions(project, platform);
+
+  if (!success) {
+    std::cerr << "Export failed. " << exporter.GetLastError() << std::endl;
+    return 1;
+  }
+
+  std::cout << "Project exported to " << outputDir << std::endl;
+  return 0;
+}
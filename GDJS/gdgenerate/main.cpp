@@ -0,0 +1,145 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+/**
+ * \file gdgenerate: a command line tool writing a synthetic project (see
+ * gd::SyntheticProjectGenerator), using the instructions of the game engine,
+ * to test how the editor, the export and the game engine scale.
+ */
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/SyntheticProjectGenerator.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDJS/Extensions/JsPlatform.h"
+
+namespace {
+
+void PrintUsage() {
+  std::cout
+      << "Usage: gdgenerate --out <game.json> [options]\n"
+         "\n"
+         "Options:\n"
+         "  --out <file>                  The project file to write.\n"
+         "  --seed <number>               Same seed and options give the same "
+         "project (default: 1).\n"
+         "  --scenes <count>\n"
+         "  --objects <count>             Objects per scene.\n"
+         "  --groups <count>              Groups per scene.\n"
+         "  --objects-per-group <count>\n"
+         "  --behaviors <count>           Behaviors per object.\n"
+         "  --instances <count>           Instances per scene.\n"
+         "  --events <count>              Top level events per scene.\n"
+         "  --events-depth <count>        Levels of sub-events.\n"
+         "  --sub-events <count>          Sub-events per event.\n"
+         "  --instructions <count>        Actions per event.\n"
+         "  --expression-complexity <n>   Terms in number expressions.\n"
+         "  --scene-variables <count>\n"
+         "  --global-variables <count>\n"
+         "  --object-variables <count>\n"
+         "  --external-events <count>\n"
+         "  --extensions <count>          Events functions extensions.\n"
+         "  --functions <count>           Functions per extension.\n"
+         "  --object-types <list>         Comma separated object types to "
+         "use (default: all).\n"
+         "  --behavior-types <list>       Comma separated behavior types to "
+         "use (default: all).\n"
+         "  --extensions-dir <dir>        The directory containing the "
+         "compiled C++ extensions (" GDGENERATE_DEFAULT_EXTENSIONS_DIR
+         " by default).\n"
+         "  --help                        Show this help.\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gd::SyntheticProjectOptions options;
+  std::map<gd::String, std::size_t *> counts;
+  counts["scenes"] = &options.scenesCount;
+  counts["objects"] = &options.objectsPerScene;
+  counts["groups"] = &options.groupsPerScene;
+  counts["objects-per-group"] = &options.objectsPerGroup;
+  counts["behaviors"] = &options.behaviorsPerObject;
+  counts["instances"] = &options.instancesPerScene;
+  counts["events"] = &options.eventsPerScene;
+  counts["events-depth"] = &options.eventsDepth;
+  counts["sub-events"] = &options.subEventsPerEvent;
+  counts["instructions"] = &options.instructionsPerEvent;
+  counts["expression-complexity"] = &options.expressionComplexity;
+  counts["scene-variables"] = &options.variablesPerScene;
+  counts["global-variables"] = &options.globalVariablesCount;
+  counts["object-variables"] = &options.variablesPerObject;
+  counts["external-events"] = &options.externalEventsCount;
+  counts["extensions"] = &options.eventsFunctionsExtensionsCount;
+  counts["functions"] = &options.eventsFunctionsPerExtension;
+
+  gd::String outputFile;
+  gd::String extensionsDir = GDGENERATE_DEFAULT_EXTENSIONS_DIR;
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = argv[i];
+    if (argument == "--help" || argument == "-h") {
+      PrintUsage();
+      return 0;
+    }
+    if (argument.substr(0, 2) != "--" || i + 1 >= argc) {
+      std::cerr << "Invalid argument: " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    }
+
+    const gd::String name = argument.substr(2);
+    const gd::String value = argv[++i];
+    if (counts.find(name) != counts.end()) {
+      *counts[name] = value.To<std::size_t>();
+    } else if (name == "seed") {
+      options.seed = value.To<std::uint32_t>();
+    } else if (name == "object-types") {
+      options.objectTypes = value.Split(U',');
+    } else if (name == "behavior-types") {
+      options.behaviorTypes = value.Split(U',');
+    } else if (name == "extensions-dir") {
+      extensionsDir = value;
+    } else if (name == "out") {
+      outputFile = value;
+    } else {
+      std::cerr << "Unknown argument: " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  if (outputFile.empty()) {
+    PrintUsage();
+    return 1;
+  }
+
+  gdjs::JsPlatform &platform = gdjs::JsPlatform::Get();
+  gd::ExtensionsLoader::LoadAllExtensions(extensionsDir, platform);
+  gd::ExtensionsLoader::ExtensionsLoadingDone(extensionsDir);
+
+  gd::Project project;
+  project.SetName("Synthetic project");
+  project.AddPlatform(platform);
+  gd::SyntheticProjectGenerator::Generate(project, platform, options);
+
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+
+  std::ofstream file(outputFile.Raw());
+  if (!file) {
+    std::cerr << "Unable to write " << outputFile << std::endl;
+    return 1;
+  }
+  file << gd::Serializer::ToJSON(element);
+
+  std::cout << "Project written to " << outputFile << std::endl;
+  return 0;
+}
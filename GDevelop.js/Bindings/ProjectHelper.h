@@ -3,6 +3,7 @@
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "GDJS/Extensions/JsPlatform.h"
 
@@ -191,4 +192,25 @@ class ProjectHelper {
 
     return "";
   }
+
+  /**
+   * \brief Forget the translations done, so that texts are translated again
+   * after the language was changed.
+   */
+  static void ClearTranslationsCache() { gd::ClearTranslationsCache(); }
+
+  /**
+   * \brief Return the number of translations requested by the C++ code.
+   */
+  static std::size_t GetTranslationRequestsCount() {
+    return gd::GetTranslationRequestsCount();
+  }
+
+  /**
+   * \brief Return the number of calls made to `getTranslation`, i.e: the
+   * translations that were not already cached.
+   */
+  static std::size_t GetTranslationCallsCount() {
+    return gd::GetTranslationCallsCount();
+  }
 };
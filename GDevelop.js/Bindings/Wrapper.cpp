@@ -93,6 +93,7 @@
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
 #include <GDCore/IDE/ObjectAssetSerializer.h>
+#include <GDCore/Tools/Tracing.h>
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h>
@@ -537,6 +538,13 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_ToJSON ToJSON
 #define STATIC_FromJSON(x) FromJSON(x)
 #define STATIC_SerializeTo SerializeTo
+#define STATIC_Enable Enable
+#define STATIC_Disable Disable
+#define STATIC_IsEnabled IsEnabled
+#define STATIC_SetReceiver SetReceiver
+#define STATIC_GetEventsCount GetEventsCount
+#define STATIC_GetChromeTraceJSON GetChromeTraceJSON
+#define STATIC_Clear Clear
 #define STATIC_IsObject IsObject
 #define STATIC_IsBehavior IsBehavior
 #define STATIC_IsExpression IsExpression
@@ -632,6 +640,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_Month Month
 #define STATIC_Date Date
 #define STATIC_ObjectOrGroupRenamedInScene ObjectOrGroupRenamedInScene
+#define STATIC_ObjectsOrGroupsRenamedInScene ObjectsOrGroupsRenamedInScene
 #define STATIC_ObjectRemovedInScene ObjectRemovedInScene
 #define STATIC_BehaviorsAddedToObjectInScene BehaviorsAddedToObjectInScene
 #define STATIC_ObjectRemovedInEventsFunction \
@@ -643,6 +652,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_ObjectOrGroupRenamedInEventsBasedObject \
   ObjectOrGroupRenamedInEventsBasedObject
 #define STATIC_GlobalObjectOrGroupRenamed GlobalObjectOrGroupRenamed
+#define STATIC_GlobalObjectsOrGroupsRenamed GlobalObjectsOrGroupsRenamed
 #define STATIC_GlobalObjectRemoved GlobalObjectRemoved
 #define STATIC_BehaviorsAddedToGlobalObject BehaviorsAddedToGlobalObject
 #define STATIC_GetAllObjectTypesUsingEventsBasedBehavior \
@@ -677,6 +687,9 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
   SanityCheckObjectInitialInstanceProperty
 #define STATIC_SanityCheckBehaviorsSharedDataProperty \
   SanityCheckBehaviorsSharedDataProperty
+#define STATIC_ClearTranslationsCache ClearTranslationsCache
+#define STATIC_GetTranslationRequestsCount GetTranslationRequestsCount
+#define STATIC_GetTranslationCallsCount GetTranslationCallsCount
 #define STATIC_FindAllGlobalVariables FindAllGlobalVariables
 #define STATIC_FindAllLayoutVariables FindAllLayoutVariables
 #define STATIC_FindAllObjectVariables FindAllObjectVariables
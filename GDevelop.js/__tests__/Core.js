@@ -4575,6 +4575,41 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.Tracing', () => {
+    afterEach(() => {
+      gd.Tracing.disable();
+      gd.Tracing.setReceiver(null);
+      gd.Tracing.clear();
+    });
+
+    it('records spans in the Chrome trace format', () => {
+      expect(gd.Tracing.isEnabled()).toBe(false);
+      gd.Tracing.enable();
+      gd.Serializer.toJSON(new gd.SerializerElement());
+      gd.Tracing.disable();
+
+      expect(gd.Tracing.getEventsCount()).toBe(1);
+      const trace = JSON.parse(gd.Tracing.getChromeTraceJSON());
+      expect(trace.traceEvents[0].name).toBe('ToJSON');
+      expect(trace.traceEvents[0].cat).toBe('Serialization');
+    });
+
+    it('can send spans to a receiver', () => {
+      const names = [];
+      const receiver = new gd.TraceEventsReceiverJS();
+      receiver.onTraceEvent = (event) => {
+        names.push(gd.wrapPointer(event, gd.TraceEvent).getName());
+      };
+      gd.Tracing.setReceiver(receiver);
+      gd.Tracing.enable();
+      gd.Serializer.fromJSON('{}');
+      gd.Tracing.disable();
+
+      expect(names).toEqual(['FromJSON']);
+      expect(gd.Tracing.getEventsCount()).toBe(0);
+    });
+  });
+
   describe('gd.ObjectFolderOrObject (using gd.ObjectsContainer)', () => {
     let project = null;
     let layout = null;
@@ -0,0 +1,113 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeMinimalGDJSMock } = require('../TestUtils/GDJSMocks');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+
+describe.skip('Events functions calls benchmarks', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  /**
+   * Generate the code of a free function and load it, returning its
+   * namespace.
+   */
+  const loadEventsFunction = (gdjs, project, eventsFunction) => {
+    const extension = new gd.EventsFunctionsExtension();
+    const eventsFunctionsExtensionCodeGenerator = new gd.EventsFunctionsExtensionCodeGenerator(
+      project
+    );
+    const includeFiles = new gd.SetString();
+    const code = eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+      extension,
+      eventsFunction,
+      'functionNamespace',
+      includeFiles,
+      true
+    );
+    eventsFunctionsExtensionCodeGenerator.delete();
+    extension.delete();
+    includeFiles.delete();
+
+    return new Function(
+      'gdjs',
+      `Hashtable = gdjs.Hashtable;
+      ${code};
+      return functionNamespace;`
+    )(gdjs);
+  };
+
+  it('Benchmark the overhead of calling events functions', function () {
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    runtimeScene.getOnceTriggers().startNewFrame();
+
+    // A function doing nothing, with objects and number parameters (like a
+    // helper function called for each instance).
+    const eventsFunction = new gd.EventsFunction();
+    const parameters = eventsFunction.getParameters();
+    parameters.insertNewParameter('MyObject', 0).setType('object');
+    parameters.insertNewParameter('MyOtherObject', 1).setType('object');
+    parameters.insertNewParameter('MyNumber', 2).setType('expression');
+    parameters.insertNewParameter('MyString', 3).setType('string');
+    const emptyFunction = loadEventsFunction(gdjs, project, eventsFunction);
+
+    // The same function, returning a number from its parameters.
+    eventsFunction.setFunctionType(gd.EventsFunction.Expression);
+    eventsFunction.getEvents().unserializeFrom(
+      project,
+      gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'SetReturnNumber' },
+              parameters: ['GetArgumentAsNumber("MyNumber") * 2'],
+            },
+          ],
+          events: [],
+        },
+      ])
+    );
+    const expressionFunction = loadEventsFunction(
+      gdjs,
+      project,
+      eventsFunction
+    );
+    eventsFunction.delete();
+    project.delete();
+
+    const myObjectLists = gdjs.Hashtable.newFrom({
+      MyObject: [runtimeScene.createObject('MyObject')],
+    });
+    const myOtherObjectLists = gdjs.Hashtable.newFrom({
+      MyOtherObject: [runtimeScene.createObject('MyOtherObject')],
+    });
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 20,
+      iterationsCount: 100000,
+    })
+      .add('call an empty function', (i) => {
+        emptyFunction.func(
+          runtimeScene,
+          myObjectLists,
+          myOtherObjectLists,
+          i,
+          'Hello'
+        );
+      })
+      .add('call an expression function', (i) => {
+        expressionFunction.func(
+          runtimeScene,
+          myObjectLists,
+          myOtherObjectLists,
+          i,
+          'Hello'
+        );
+      });
+
+    console.log(benchmarkSuite.run());
+  });
+});
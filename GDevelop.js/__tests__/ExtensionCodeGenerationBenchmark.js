@@ -0,0 +1,82 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+
+describe.skip('Extension code generation benchmarks', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  const propertiesCount = 500;
+  const propertyTypes = ['Number', 'String', 'Boolean', 'Choice'];
+
+  /**
+   * Add properties of all types, with their default values.
+   */
+  const addProperties = (propertyDescriptors) => {
+    for (let i = 0; i < propertiesCount; i++) {
+      const type = propertyTypes[i % propertyTypes.length];
+      propertyDescriptors
+        .insertNew('MyProperty' + i, i)
+        .setType(type)
+        .setValue(
+          type === 'Number' ? '' + i : type === 'Boolean' ? 'true' : 'Hello'
+        );
+    }
+  };
+
+  it('Benchmark the code generation of an extension with 500 properties', function () {
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const extension = project.insertNewEventsFunctionsExtension(
+      'MyExtension',
+      0
+    );
+    const eventsBasedBehavior = extension
+      .getEventsBasedBehaviors()
+      .insertNew('MyBehavior', 0);
+    addProperties(eventsBasedBehavior.getPropertyDescriptors());
+    addProperties(eventsBasedBehavior.getSharedPropertyDescriptors());
+    const eventsBasedObject = extension
+      .getEventsBasedObjects()
+      .insertNew('MyObject', 0);
+    addProperties(eventsBasedObject.getPropertyDescriptors());
+
+    const behaviorCodeGenerator = new gd.BehaviorCodeGenerator(project);
+    const objectCodeGenerator = new gd.ObjectCodeGenerator(project);
+    const methodMangledNames = new gd.MapStringString();
+    const includeFiles = new gd.SetString();
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 10,
+      iterationsCount: 20,
+    })
+      .add('generate the code of a behavior', () => {
+        behaviorCodeGenerator.generateRuntimeBehaviorCompleteCode(
+          extension,
+          eventsBasedBehavior,
+          'behaviorNamespace',
+          methodMangledNames,
+          includeFiles,
+          true
+        );
+      })
+      .add('generate the code of an object', () => {
+        objectCodeGenerator.generateRuntimeObjectCompleteCode(
+          extension,
+          eventsBasedObject,
+          'objectNamespace',
+          methodMangledNames,
+          includeFiles,
+          true
+        );
+      });
+
+    console.log(benchmarkSuite.run());
+
+    behaviorCodeGenerator.delete();
+    objectCodeGenerator.delete();
+    methodMangledNames.delete();
+    includeFiles.delete();
+    project.delete();
+  });
+});
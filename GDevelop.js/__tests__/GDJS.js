@@ -208,6 +208,144 @@ describe('libGD.js - GDJS related tests', function () {
 }`
       );
     });
+    it('exports the scripts in a single bundle, with its source map', () => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      project.insertNewLayout('Scene', 0);
+
+      // Prepare a fake file system where each script logs its name and
+      // references its source map.
+      var fs = makeFakeAbstractFileSystem(gd, {});
+      fs.readFile = function (filePath) {
+        if (filePath === '/fake-gdjs-root/Runtime/index.html')
+          return fakeIndexHtmlContent;
+
+        const fileName = path.posix.basename(filePath);
+        if (fileName.endsWith('.js.map')) {
+          return JSON.stringify({
+            version: 3,
+            sources: [fileName.replace(/\.js\.map$/, '.ts')],
+            mappings: 'AAAA',
+            names: [],
+          });
+        }
+        return `console.log("${fileName}");\n//# sourceMappingURL=${fileName}.map\n`;
+      };
+
+      const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+      const exportOptions = new gd.ExportOptions(project, '/fake-export-dir');
+      exportOptions.setBundleScripts(true);
+      exportOptions.setExportSourceMaps(true);
+      expect(exporter.exportWholePixiProject(exportOptions)).toBe(true);
+      exportOptions.delete();
+      exporter.delete();
+      project.delete();
+
+      const writtenFiles = new Map(fs.writeToFile.mock.calls);
+
+      // Check the index.html only includes the bundle.
+      const indexHtml = writtenFiles.get('/fake-export-dir/index.html');
+      expect(indexHtml).toContain('<script src="bundle.js"');
+      expect(indexHtml).not.toContain('gd.js');
+      expect(indexHtml).not.toContain('data.js');
+
+      // Check the bundle contains the scripts, in the order of the includes.
+      const bundle = writtenFiles.get('/fake-export-dir/bundle.js');
+      const bundleLines = bundle.split('\n');
+      const gdLineIndex = bundleLines.indexOf('console.log("gd.js");');
+      const runtimeGameLineIndex = bundleLines.indexOf(
+        'console.log("runtimegame.js");'
+      );
+      const dataLineIndex = bundleLines.indexOf('console.log("data.js");');
+      expect(gdLineIndex).not.toBe(-1);
+      expect(runtimeGameLineIndex).toBeGreaterThan(gdLineIndex);
+      expect(dataLineIndex).toBeGreaterThan(runtimeGameLineIndex);
+      expect(bundleLines[gdLineIndex - 1]).toBe(';');
+
+      // Check the source maps of the scripts are replaced by the one of the
+      // bundle.
+      expect(bundle).not.toContain('sourceMappingURL=gd.js.map');
+      expect(bundle).toContain('//# sourceMappingURL=bundle.js.map');
+
+      // Check the source map of the bundle has a section for each runtime
+      // script, with their sources relative to the bundle.
+      const sourceMap = JSON.parse(
+        writtenFiles.get('/fake-export-dir/bundle.js.map')
+      );
+      expect(sourceMap.version).toBe(3);
+      expect(sourceMap.file).toBe('bundle.js');
+      const pixiRendererSection = sourceMap.sections.find(
+        (section) =>
+          section.map.sources[0] ===
+          'pixi-renderers/runtimescene-pixi-renderer.ts'
+      );
+      expect(pixiRendererSection.offset.column).toBe(0);
+      expect(bundleLines[pixiRendererSection.offset.line]).toBe(
+        'console.log("runtimescene-pixi-renderer.js");'
+      );
+    });
+    it('exports the data of each scene in a separate file', () => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      project.insertNewLayout('Scene 1', 0);
+      project.insertNewLayout('Scene 2', 1);
+      project
+        .insertNewExternalLayout('External layout', 0)
+        .setAssociatedLayout('Scene 2');
+
+      // Prepare a fake file system
+      var fs = makeFakeAbstractFileSystem(gd, {
+        '/fake-gdjs-root/Runtime/index.html': fakeIndexHtmlContent,
+        '/fake-gdjs-root/Runtime/Electron/LICENSE.GDevelop.txt': '',
+      });
+
+      // Export and check the content of written files.
+      const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+      const exportOptions = new gd.ExportOptions(project, '/fake-export-dir');
+      exportOptions.setLoadScenesDataLazily(true);
+      expect(exporter.exportWholePixiProject(exportOptions)).toBe(true);
+      exportOptions.delete();
+      exporter.delete();
+      project.delete();
+
+      const writtenFiles = new Map(fs.writeToFile.mock.calls);
+
+      // Check the scenes and external layouts are written in their own files.
+      expect(
+        JSON.parse(writtenFiles.get('/fake-export-dir/data/layout-1.json'))
+          .name
+      ).toBe('Scene 2');
+      expect(
+        JSON.parse(
+          writtenFiles.get('/fake-export-dir/data/external-layout-0.json')
+        ).name
+      ).toBe('External layout');
+
+      // Check the project data doesn't contain them, but lists their files.
+      const dataJs = [...writtenFiles.entries()].find(([filePath]) =>
+        filePath.endsWith('/data.js')
+      )[1];
+      const gdjs = {};
+      new Function('gdjs', dataJs)(gdjs);
+      expect(gdjs.projectData.layouts).toEqual([]);
+      expect(gdjs.projectData.externalLayouts).toEqual([]);
+      expect(gdjs.runtimeGameOptions.projectDataChunks).toEqual({
+        layouts: [
+          { name: 'Scene 1', file: 'data/layout-0.json', usedResources: [] },
+          { name: 'Scene 2', file: 'data/layout-1.json', usedResources: [] },
+        ],
+        externalLayouts: [
+          {
+            name: 'External layout',
+            file: 'data/external-layout-0.json',
+            associatedLayout: 'Scene 2',
+          },
+        ],
+      });
+
+      // Check the index.html gives the list of files to the game.
+      expect(writtenFiles.get('/fake-export-dir/index.html')).toContain(
+        'gdjs.runtimeGameOptions'
+      );
+    });
   });
 
   describe('LayoutCodeGenerator', () => {
@@ -540,12 +678,35 @@ describe('libGD.js - GDJS related tests', function () {
       );
 
       // ...and objects should be able to get queried...
-      expect(code).toMatch('"MyObject": MyObject');
-      expect(code).toMatch('"MySprite": MySprite');
+      expect(code).toMatch(
+        'eventsFunctionContext._objectsMap["MyObject"] = MyObject;'
+      );
+      expect(code).toMatch(
+        'eventsFunctionContext._objectsMap["MySprite"] = MySprite;'
+      );
 
       // ...and arguments should be able to get queried too:
-      expect(code).toMatch('if (argName === "MyNumber") return MyNumber;');
-      expect(code).toMatch('if (argName === "MyString") return MyString;');
+      expect(code).toMatch('eventsFunctionContext._arguments[0] = MyNumber;');
+      expect(code).toMatch('eventsFunctionContext._arguments[1] = MyString;');
+      expect(code).toMatch(
+        'if (argName === "MyNumber") return this._arguments[0];'
+      );
+      expect(code).toMatch(
+        'if (argName === "MyString") return this._arguments[1];'
+      );
+
+      // The context is declared once, and recycled after the function call:
+      expect(code).toMatch(namespace + '.EventsFunctionContext = class {');
+      expect(code).toMatch(
+        'var eventsFunctionContext = ' +
+          namespace +
+          '.eventsFunctionContextsPool.pop() || new ' +
+          namespace +
+          '.EventsFunctionContext();'
+      );
+      expect(code).toMatch(
+        namespace + '.eventsFunctionContextsPool.push(eventsFunctionContext);'
+      );
 
       // GetArgumentAsString("MyString") should be generated code to query and cast as a string
       // the argument
@@ -644,8 +805,12 @@ describe('libGD.js - GDJS related tests', function () {
       );
 
       // ...and objects should be able to get queried...
-      expect(code).toMatch('"MyObject": MyObject');
-      expect(code).toMatch('"MySprite": MySprite');
+      expect(code).toMatch(
+        'eventsFunctionContext._objectsMap["MyObject"] = MyObject;'
+      );
+      expect(code).toMatch(
+        'eventsFunctionContext._objectsMap["MySprite"] = MySprite;'
+      );
 
       // Variables of both MyObject and MySprite should have 42 added:
       expect(code).toMatch(
@@ -657,6 +822,84 @@ describe('libGD.js - GDJS related tests', function () {
 
       action.delete();
     });
+
+    it('does not recycle the context of an events function using it asynchronously', function () {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const includeFiles = new gd.SetString();
+      const namespace = 'gdjs.eventsFunction.myTest';
+      const extension = new gd.EventsFunctionsExtension();
+      const eventsFunctionsExtensionCodeGenerator = new gd.EventsFunctionsExtensionCodeGenerator(
+        project
+      );
+
+      const generateCode = (eventsFunction) =>
+        eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+          extension,
+          eventsFunction,
+          namespace,
+          includeFiles,
+          true
+        );
+
+      // An asynchronous function.
+      const asyncEventsFunction = new gd.EventsFunction();
+      asyncEventsFunction.setAsync(true);
+      const asyncFunctionCode = generateCode(asyncEventsFunction);
+      expect(asyncFunctionCode).toMatch(
+        'var eventsFunctionContext = new ' +
+          namespace +
+          '.EventsFunctionContext();'
+      );
+      expect(asyncFunctionCode).not.toMatch('eventsFunctionContextsPool');
+
+      // A function with an asynchronous action.
+      const eventsFunction = new gd.EventsFunction();
+      eventsFunction.getEvents().unserializeFrom(
+        project,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [{ type: { value: 'Wait' }, parameters: ['1.5'] }],
+            events: [],
+          },
+        ])
+      );
+      const functionCode = generateCode(eventsFunction);
+      expect(functionCode).toMatch(
+        'var eventsFunctionContext = new ' +
+          namespace +
+          '.EventsFunctionContext();'
+      );
+      expect(functionCode).not.toMatch('eventsFunctionContextsPool');
+
+      // A function with JavaScript code referring to the context.
+      const jsEventsFunction = new gd.EventsFunction();
+      jsEventsFunction.getEvents().unserializeFrom(
+        project,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::JsCode',
+            inlineCode:
+              'setTimeout(() => eventsFunctionContext.getObjects("A"), 1);',
+            parameterObjects: '',
+            useStrict: true,
+            eventsSheetExpanded: false,
+          },
+        ])
+      );
+      expect(generateCode(jsEventsFunction)).not.toMatch(
+        'eventsFunctionContextsPool'
+      );
+
+      asyncEventsFunction.delete();
+      eventsFunction.delete();
+      jsEventsFunction.delete();
+      eventsFunctionsExtensionCodeGenerator.delete();
+      extension.delete();
+      includeFiles.delete();
+      project.delete();
+    });
   });
 
   describe('TextObject', function () {
@@ -630,6 +630,92 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     project.delete();
   });
 
+  it('generates a working function recycling its context', function () {
+    // Create a condition function, true if the parameter is positive and
+    // counting the objects passed as parameter.
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [
+          {
+            type: { value: 'CompareArgumentAsNumber' },
+            parameters: ['"MyNumber"', '>', '0'],
+          },
+        ],
+        actions: [
+          {
+            type: { value: 'SetReturnBoolean' },
+            parameters: ['True'],
+          },
+        ],
+        events: [],
+      },
+      makeAddOneToObjectTestVariableEvent('MyObject'),
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction.setFunctionType(gd.EventsFunction.Condition);
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+    eventsFunction
+      .getParameters()
+      .insertNewParameter('MyObject', 0)
+      .setType('object');
+    eventsFunction
+      .getParameters()
+      .insertNewParameter('MyNumber', 1)
+      .setType('expression');
+
+    const extension = new gd.EventsFunctionsExtension();
+    const eventsFunctionsExtensionCodeGenerator = new gd.EventsFunctionsExtensionCodeGenerator(
+      project
+    );
+    const includeFiles = new gd.SetString();
+    const code = eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+      extension,
+      eventsFunction,
+      'functionNamespace',
+      includeFiles,
+      true
+    );
+
+    // Load the code only once, so that calls share the pool of contexts.
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const functionNamespace = new Function(
+      'gdjs',
+      `Hashtable = gdjs.Hashtable;
+      ${code};
+      return functionNamespace;`
+    )(gdjs);
+
+    runtimeScene.getOnceTriggers().startNewFrame();
+    const myObject = runtimeScene.createObject('MyObject');
+    const myObjectLists = gdjs.Hashtable.newFrom({ MyObject: [myObject] });
+
+    expect(functionNamespace.func(runtimeScene, myObjectLists, 1)).toBe(true);
+    expect(functionNamespace.eventsFunctionContextsPool).toHaveLength(1);
+    const eventsFunctionContext =
+      functionNamespace.eventsFunctionContextsPool[0];
+
+    // The context is reused, without the return value of the previous call.
+    expect(functionNamespace.func(runtimeScene, myObjectLists, -1)).toBe(false);
+    expect(functionNamespace.eventsFunctionContextsPool).toEqual([
+      eventsFunctionContext,
+    ]);
+    expect(myObject.getVariables().get('TestVariable').getAsNumber()).toBe(2);
+
+    // The recycled context does not keep the objects.
+    expect(eventsFunctionContext.getObjectsLists('MyObject')).toBe(null);
+
+    eventsFunctionsExtensionCodeGenerator.delete();
+    extension.delete();
+    includeFiles.delete();
+    eventsFunction.delete();
+    project.delete();
+  });
+
   it('generates working functions with groups', function () {
     // Create events that increment twice the variable of a group, and
     // only once for the 3rd parameter.
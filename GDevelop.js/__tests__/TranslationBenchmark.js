@@ -0,0 +1,67 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+
+describe.skip('Translation benchmarks', function () {
+  let gd = null;
+  let getTranslationCallsCount = 0;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+    gd.getTranslation = (text) => {
+      getTranslationCallsCount++;
+      return text;
+    };
+    gd.ProjectHelper.clearTranslationsCache();
+  });
+
+  /**
+   * Log the number of translations requested by libGD.js (each of them was a
+   * call to JavaScript before translations were cached) and the number of
+   * calls to JavaScript that were actually made.
+   */
+  const measureTranslations = (name, callback) => {
+    const requestsCountBefore = gd.ProjectHelper.getTranslationRequestsCount();
+    const callsCountBefore = getTranslationCallsCount;
+    callback();
+    console.log(
+      `${name}: ${
+        gd.ProjectHelper.getTranslationRequestsCount() - requestsCountBefore
+      } translations requested, ${
+        getTranslationCallsCount - callsCountBefore
+      } calls to getTranslation.`
+    );
+  };
+
+  it('Count the calls to JavaScript made to translate texts at startup', function () {
+    measureTranslations('Declare all the built-in extensions', () => {
+      gd.JsPlatform.get().getAllPlatformExtensions();
+    });
+    measureTranslations('Reload all the built-in extensions', () => {
+      gd.JsPlatform.get().reloadBuiltinExtensions();
+      gd.JsPlatform.get().getAllPlatformExtensions();
+    });
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const layout = project.insertNewLayout('Scene', 0);
+    const projectScopedContainers = gd.ProjectScopedContainers.makeNewProjectScopedContainersForProjectAndLayout(
+      project,
+      layout
+    );
+    measureTranslations('Parse and validate 1000 invalid expressions', () => {
+      const parser = new gd.ExpressionParser2();
+      for (let i = 0; i < 1000; i++) {
+        const expressionNode = parser
+          .parseExpression('1 + "Hello" + MyUnknownObject.X(')
+          .get();
+        const expressionValidator = new gd.ExpressionValidator(
+          gd.JsPlatform.get(),
+          projectScopedContainers,
+          'number',
+          ''
+        );
+        expressionNode.visit(expressionValidator);
+        expressionValidator.delete();
+      }
+      parser.delete();
+    });
+    project.delete();
+  });
+});
@@ -203,6 +203,9 @@ export class ProjectHelper extends EmscriptenObject {
   static sanityCheckBehaviorsSharedDataProperty(behavior: BehaviorsSharedData, propertyName: string, newValue: string): string;
   static sanityCheckObjectProperty(configuration: ObjectConfiguration, propertyName: string, newValue: string): string;
   static sanityCheckObjectInitialInstanceProperty(configuration: ObjectConfiguration, propertyName: string, newValue: string): string;
+  static clearTranslationsCache(): void;
+  static getTranslationRequestsCount(): number;
+  static getTranslationCallsCount(): number;
 }
 
 export class EventsVariablesFinder extends EmscriptenObject {
@@ -644,6 +647,7 @@ export class Behavior extends EmscriptenObject {
   getName(): string;
   getTypeName(): string;
   getProperties(): MapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   initializeContent(): void;
   serializeTo(element: SerializerElement): void;
@@ -667,6 +671,7 @@ export class BehaviorsSharedData extends EmscriptenObject {
   getName(): string;
   getTypeName(): string;
   getProperties(): MapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   initializeContent(): void;
   getPropertiesQuickCustomizationVisibilities(): QuickCustomizationVisibilitiesContainer;
@@ -685,6 +690,7 @@ export class ObjectConfiguration extends EmscriptenObject {
   getType(): string;
   setType(typeName: string): void;
   getProperties(): MapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   getInitialInstanceProperties(instance: InitialInstance): MapStringPropertyDescriptor;
   updateInitialInstanceProperty(instance: InitialInstance, name: string, value: string): boolean;
@@ -748,6 +754,7 @@ export class CustomObjectConfiguration extends ObjectConfiguration {
   clearChildrenConfiguration(): void;
   getChildObjectConfiguration(objectName: string): ObjectConfiguration;
   getProperties(): MapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   getInitialInstanceProperties(instance: InitialInstance): MapStringPropertyDescriptor;
   updateInitialInstanceProperty(instance: InitialInstance, name: string, value: string): boolean;
@@ -1897,6 +1904,7 @@ export class WholeProjectRefactorer extends EmscriptenObject {
   static renameObjectEffectInScene(project: Project, scene: Layout, gdObject: gdObject, oldName: string, newName: string): void;
   static renameObjectEffectInEventsBasedObject(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedObject: EventsBasedObject, gdObject: gdObject, oldName: string, newName: string): void;
   static objectOrGroupRenamedInScene(project: Project, scene: Layout, oldName: string, newName: string, isObjectGroup: boolean): void;
+  static objectsOrGroupsRenamedInScene(project: Project, scene: Layout, oldToNewNames: MapStringString): void;
   static objectRemovedInScene(project: Project, scene: Layout, objectName: string): void;
   static behaviorsAddedToObjectInScene(project: Project, scene: Layout, objectName: string): void;
   static objectOrGroupRenamedInEventsFunction(project: Project, projectScopedContainers: ProjectScopedContainers, eventsFunction: EventsFunction, oldName: string, newName: string, isObjectGroup: boolean): void;
@@ -1904,6 +1912,7 @@ export class WholeProjectRefactorer extends EmscriptenObject {
   static objectOrGroupRenamedInEventsBasedObject(project: Project, projectScopedContainers: ProjectScopedContainers, eventsBasedObject: EventsBasedObject, oldName: string, newName: string, isObjectGroup: boolean): void;
   static objectRemovedInEventsBasedObject(project: Project, eventsBasedObject: EventsBasedObject, objectName: string): void;
   static globalObjectOrGroupRenamed(project: Project, oldName: string, newName: string, isObjectGroup: boolean): void;
+  static globalObjectsOrGroupsRenamed(project: Project, oldToNewNames: MapStringString): void;
   static globalObjectRemoved(project: Project, objectName: string): void;
   static behaviorsAddedToGlobalObject(project: Project, objectName: string): void;
   static getAllObjectTypesUsingEventsBasedBehavior(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedBehavior: EventsBasedBehavior): SetString;
@@ -2840,6 +2849,9 @@ export class ExportOptions extends EmscriptenObject {
   constructor(project: Project, outputPath: string);
   setFallbackAuthor(id: string, username: string): ExportOptions;
   setTarget(target: string): ExportOptions;
+  setBundleScripts(enable: boolean): ExportOptions;
+  setExportSourceMaps(enable: boolean): ExportOptions;
+  setLoadScenesDataLazily(enable: boolean): ExportOptions;
 }
 
 export class Exporter extends EmscriptenObject {
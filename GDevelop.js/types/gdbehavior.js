@@ -6,6 +6,7 @@ declare class gdBehavior {
   getName(): string;
   getTypeName(): string;
   getProperties(): gdMapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   initializeContent(): void;
   serializeTo(element: gdSerializerElement): void;
@@ -5,6 +5,7 @@ declare class gdBehaviorsSharedData {
   getName(): string;
   getTypeName(): string;
   getProperties(): gdMapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   initializeContent(): void;
   getPropertiesQuickCustomizationVisibilities(): gdQuickCustomizationVisibilitiesContainer;
@@ -12,6 +12,7 @@ declare class gdCustomObjectConfiguration extends gdObjectConfiguration {
   clearChildrenConfiguration(): void;
   getChildObjectConfiguration(objectName: string): gdObjectConfiguration;
   getProperties(): gdMapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   getInitialInstanceProperties(instance: gdInitialInstance): gdMapStringPropertyDescriptor;
   updateInitialInstanceProperty(instance: gdInitialInstance, name: string, value: string): boolean;
@@ -3,6 +3,9 @@ declare class gdExportOptions {
   constructor(project: gdProject, outputPath: string): void;
   setFallbackAuthor(id: string, username: string): gdExportOptions;
   setTarget(target: string): gdExportOptions;
+  setBundleScripts(enable: boolean): gdExportOptions;
+  setExportSourceMaps(enable: boolean): gdExportOptions;
+  setLoadScenesDataLazily(enable: boolean): gdExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@ declare class gdObjectConfiguration {
   getType(): string;
   setType(typeName: string): void;
   getProperties(): gdMapStringPropertyDescriptor;
+  getPropertyValue(name: string): string;
   updateProperty(name: string, value: string): boolean;
   getInitialInstanceProperties(instance: gdInitialInstance): gdMapStringPropertyDescriptor;
   updateInitialInstanceProperty(instance: gdInitialInstance, name: string, value: string): boolean;
@@ -6,6 +6,9 @@ declare class gdProjectHelper {
   static sanityCheckBehaviorsSharedDataProperty(behavior: gdBehaviorsSharedData, propertyName: string, newValue: string): string;
   static sanityCheckObjectProperty(configuration: gdObjectConfiguration, propertyName: string, newValue: string): string;
   static sanityCheckObjectInitialInstanceProperty(configuration: gdObjectConfiguration, propertyName: string, newValue: string): string;
+  static clearTranslationsCache(): void;
+  static getTranslationRequestsCount(): number;
+  static getTranslationCallsCount(): number;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdTraceEvent {
+  getCategory(): string;
+  getName(): string;
+  getDetail(): string;
+  getStartTime(): number;
+  getDuration(): number;
+  getThreadId(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,5 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdTraceEventsReceiver {
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdTraceEventsReceiverJS extends gdTraceEventsReceiver {
+  constructor(): void;
+  onTraceEvent(event: gdTraceEvent): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
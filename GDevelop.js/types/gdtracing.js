@@ -0,0 +1,12 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdTracing {
+  static enable(): void;
+  static disable(): void;
+  static isEnabled(): boolean;
+  static setReceiver(receiver: gdTraceEventsReceiver): void;
+  static getEventsCount(): number;
+  static getChromeTraceJSON(): string;
+  static clear(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -33,6 +33,7 @@ declare class gdWholeProjectRefactorer {
   static renameObjectEffectInScene(project: gdProject, scene: gdLayout, gdObject: gdObject, oldName: string, newName: string): void;
   static renameObjectEffectInEventsBasedObject(project: gdProject, eventsFunctionsExtension: gdEventsFunctionsExtension, eventsBasedObject: gdEventsBasedObject, gdObject: gdObject, oldName: string, newName: string): void;
   static objectOrGroupRenamedInScene(project: gdProject, scene: gdLayout, oldName: string, newName: string, isObjectGroup: boolean): void;
+  static objectsOrGroupsRenamedInScene(project: gdProject, scene: gdLayout, oldToNewNames: gdMapStringString): void;
   static objectRemovedInScene(project: gdProject, scene: gdLayout, objectName: string): void;
   static behaviorsAddedToObjectInScene(project: gdProject, scene: gdLayout, objectName: string): void;
   static objectOrGroupRenamedInEventsFunction(project: gdProject, projectScopedContainers: gdProjectScopedContainers, eventsFunction: gdEventsFunction, oldName: string, newName: string, isObjectGroup: boolean): void;
@@ -40,6 +41,7 @@ declare class gdWholeProjectRefactorer {
   static objectOrGroupRenamedInEventsBasedObject(project: gdProject, projectScopedContainers: gdProjectScopedContainers, eventsBasedObject: gdEventsBasedObject, oldName: string, newName: string, isObjectGroup: boolean): void;
   static objectRemovedInEventsBasedObject(project: gdProject, eventsBasedObject: gdEventsBasedObject, objectName: string): void;
   static globalObjectOrGroupRenamed(project: gdProject, oldName: string, newName: string, isObjectGroup: boolean): void;
+  static globalObjectsOrGroupsRenamed(project: gdProject, oldToNewNames: gdMapStringString): void;
   static globalObjectRemoved(project: gdProject, objectName: string): void;
   static behaviorsAddedToGlobalObject(project: gdProject, objectName: string): void;
   static getAllObjectTypesUsingEventsBasedBehavior(project: gdProject, eventsFunctionsExtension: gdEventsFunctionsExtension, eventsBasedBehavior: gdEventsBasedBehavior): gdSetString;
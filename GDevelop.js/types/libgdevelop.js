@@ -132,6 +132,10 @@ declare class libGDevelop {
   SharedPtrSerializerElement: Class<gdSharedPtrSerializerElement>;
   Serializer: Class<gdSerializer>;
   ObjectAssetSerializer: Class<gdObjectAssetSerializer>;
+  TraceEvent: Class<gdTraceEvent>;
+  TraceEventsReceiver: Class<gdTraceEventsReceiver>;
+  TraceEventsReceiverJS: Class<gdTraceEventsReceiverJS>;
+  Tracing: Class<gdTracing>;
   InstructionsList: Class<gdInstructionsList>;
   Instruction: Class<gdInstruction>;
   Expression: Class<gdExpression>;
@@ -32,15 +32,9 @@ export const PropertyField = ({
 
   const updateProperty = React.useCallback(
     (value: string) => {
-      const oldValue = objectConfiguration
-        .getProperties()
-        .get(propertyName)
-        .getValue();
+      const oldValue = objectConfiguration.getPropertyValue(propertyName);
       objectConfiguration.updateProperty(propertyName, value);
-      const newValue = objectConfiguration
-        .getProperties()
-        .get(propertyName)
-        .getValue();
+      const newValue = objectConfiguration.getPropertyValue(propertyName);
       if (onChange && newValue !== oldValue) {
         onChange();
       }
@@ -17,6 +17,49 @@ const newNameGenerator = (
   return potentialName;
 };
 
+export type NewNamesGenerator = {|
+  generate: (name: string, prefix?: string) => string,
+|};
+
+/**
+ * Make a generator of unique names, to be used when a lot of names are
+ * generated at once (for example when pasting a lot of variables).
+ *
+ * The existing names are given once. Names are then generated like
+ * `newNameGenerator` does, but the next number suffix to try is remembered, so
+ * each name is generated in constant time (amortized). Generated names are
+ * considered as used.
+ */
+export const makeNewNamesGenerator = (
+  existingNames: Iterable<string>
+): NewNamesGenerator => {
+  const usedNames: Set<string> = new Set(existingNames);
+  // The next number suffix to try, indexed by the starting suffix and radix.
+  // Names are only added, so the suffixes before it are still used.
+  const nextNumberSuffixes: Map<string, number> = new Map();
+
+  const generateName = (name: string, prefix: string): string => {
+    if (!usedNames.has(name)) return name;
+    if (prefix && !usedNames.has(prefix + name)) return prefix + name;
+
+    const [radix, numberSuffix] = splitNameAndNumberSuffix(prefix + name);
+    const startingNumberSuffix = numberSuffix === null ? 2 : numberSuffix + 1;
+    const key = startingNumberSuffix + ':' + radix;
+    let i = nextNumberSuffixes.get(key) || startingNumberSuffix;
+    while (usedNames.has(radix + i)) i++;
+    nextNumberSuffixes.set(key, i + 1);
+    return radix + i;
+  };
+
+  return {
+    generate: (name: string, prefix?: string = '') => {
+      const newName = generateName(name, prefix);
+      usedNames.add(newName);
+      return newName;
+    },
+  };
+};
+
 export const splitNameAndNumberSuffix = (
   text: string
 ): [string, number | null] => {
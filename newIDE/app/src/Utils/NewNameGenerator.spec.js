@@ -1,6 +1,9 @@
 // @flow
 
-import newNameGenerator, { splitNameAndNumberSuffix } from './NewNameGenerator';
+import newNameGenerator, {
+  makeNewNamesGenerator,
+  splitNameAndNumberSuffix,
+} from './NewNameGenerator';
 
 describe('NewNameGenerator', () => {
   describe('newNameGenerator', () => {
@@ -57,6 +60,32 @@ describe('NewNameGenerator', () => {
     });
   });
 
+  describe('makeNewNamesGenerator', () => {
+    it('should generate the same names as newNameGenerator', () => {
+      const existingNames = ['Object', 'CopyOfObject', 'Object2', 'Enemy5'];
+      const newNamesGenerator = makeNewNamesGenerator(existingNames);
+      expect(newNamesGenerator.generate('Other')).toEqual('Other');
+      expect(newNamesGenerator.generate('Object')).toEqual('Object3');
+      expect(newNamesGenerator.generate('Object', 'CopyOf')).toEqual(
+        'CopyOfObject2'
+      );
+      expect(newNamesGenerator.generate('Enemy5')).toEqual('Enemy6');
+      expect(newNamesGenerator.generate('Enemy')).toEqual('Enemy');
+      expect(newNamesGenerator.generate('Enemy')).toEqual('Enemy2');
+    });
+    it('should generate unique names when the same name is used a lot of times', () => {
+      const newNamesGenerator = makeNewNamesGenerator(['Enemy', 'Enemy3']);
+      const names = [];
+      for (let i = 0; i < 2000; i++) {
+        names.push(newNamesGenerator.generate('Enemy'));
+      }
+      expect(names[0]).toEqual('Enemy2');
+      expect(names[1]).toEqual('Enemy4');
+      expect(names[1999]).toEqual('Enemy2002');
+      expect(new Set(names).size).toEqual(2000);
+    });
+  });
+
   describe('splitNameAndNumberSuffix', () => {
     it('should return the whole text if no number suffix', () => {
       expect(splitNameAndNumberSuffix('NewObject')).toEqual([
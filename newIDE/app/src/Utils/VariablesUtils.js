@@ -1,6 +1,9 @@
 // @flow
 import { mapFor } from './MapFor';
-import newNameGenerator from './NewNameGenerator';
+import newNameGenerator, {
+  makeNewNamesGenerator,
+  type NewNamesGenerator,
+} from './NewNameGenerator';
 import { normalizeString } from './Search';
 import { unserializeFromJSObject } from './Serializer';
 const gd: libGDevelop = global.gd;
@@ -47,18 +50,23 @@ export const insertInVariablesContainer = (
   name: string,
   serializedVariable: any | null,
   index: number,
-  inheritedVariablesContainer: ?gdVariablesContainer
+  inheritedVariablesContainer: ?gdVariablesContainer,
+  newNamesGenerator?: ?NewNamesGenerator
 ): { name: string, variable: gdVariable } => {
-  const newName = newNameGenerator(
-    name,
-    name => {
-      return (
-        variablesContainer.has(name) ||
-        (!!inheritedVariablesContainer && inheritedVariablesContainer.has(name))
+  const prefix = serializedVariable ? 'CopyOf' : undefined;
+  const newName = newNamesGenerator
+    ? newNamesGenerator.generate(name, prefix)
+    : newNameGenerator(
+        name,
+        name => {
+          return (
+            variablesContainer.has(name) ||
+            (!!inheritedVariablesContainer &&
+              inheritedVariablesContainer.has(name))
+          );
+        },
+        prefix
       );
-    },
-    serializedVariable ? 'CopyOf' : undefined
-  );
   const newVariable = new gd.Variable();
   if (serializedVariable) {
     unserializeFromJSObject(newVariable, serializedVariable);
@@ -99,6 +107,25 @@ export const insertInVariableChildren = (
   return newName;
 };
 
+/**
+ * Make a generator of names that are not used in the variables containers, to
+ * insert a lot of variables at once (see `insertInVariablesContainer`).
+ */
+export const makeVariablesContainerNewNamesGenerator = (
+  variablesContainer: gdVariablesContainer,
+  inheritedVariablesContainer: ?gdVariablesContainer
+): NewNamesGenerator => {
+  const existingNames = mapFor(0, variablesContainer.count(), index =>
+    variablesContainer.getNameAt(index)
+  );
+  if (inheritedVariablesContainer) {
+    for (let index = 0; index < inheritedVariablesContainer.count(); index++) {
+      existingNames.push(inheritedVariablesContainer.getNameAt(index));
+    }
+  }
+  return makeNewNamesGenerator(existingNames);
+};
+
 export const hasVariablesContainerSubChildren = (
   variablesContainer: gdVariablesContainer
 ): boolean =>
@@ -70,6 +70,9 @@ export default class GDI18nProvider extends React.Component<Props, State> {
         () => {
           const { i18n } = this.state;
           gd.getTranslation = getTranslationFunction(i18n);
+          // Texts already translated by libGD.js are cached: translate them
+          // again in the new language.
+          gd.ProjectHelper.clearTranslationsCache();
           console.info(`Loaded "${language}" language`);
         }
       );
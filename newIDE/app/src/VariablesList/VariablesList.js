@@ -47,6 +47,7 @@ import {
   insertInVariableChildrenArray,
   insertInVariablesContainer,
   isCollectionVariable,
+  makeVariablesContainerNewNamesGenerator,
 } from '../Utils/VariablesUtils';
 import {
   generateListOfNodesMatchingSearchInVariablesContainer,
@@ -823,6 +824,12 @@ const VariablesList = React.forwardRef<Props, VariablesListInterface>(
         const variablesContent = SafeExtractor.extractArray(clipboardContent);
         if (!variablesContent) return;
 
+        // Generate the names of all the pasted variables at once, instead of
+        // searching the variables for each try.
+        const newNamesGenerator = makeVariablesContainerNewNamesGenerator(
+          props.variablesContainer,
+          props.inheritedVariablesContainer
+        );
         let pastedElementOffsetIndex = 0;
 
         variablesContent.forEach(variableContent => {
@@ -853,7 +860,8 @@ const VariablesList = React.forwardRef<Props, VariablesListInterface>(
               gd.Project.getSafeName(name),
               serializedVariable,
               props.variablesContainer.count(),
-              props.inheritedVariablesContainer
+              props.inheritedVariablesContainer,
+              newNamesGenerator
             );
             newSelectedNodes.push(newName);
           } else {
@@ -879,7 +887,8 @@ const VariablesList = React.forwardRef<Props, VariablesListInterface>(
                 name,
                 serializedVariable,
                 props.variablesContainer.getPosition(targetVariableName) + 1,
-                props.inheritedVariablesContainer
+                props.inheritedVariablesContainer,
+                newNamesGenerator
               );
               newSelectedNodes.push(newName);
             } else {